@@ -976,8 +976,8 @@ static bool InitializeRecomp(HWND hWnd)
             .enableAsyncAudio = true,         // Audio ring buffer for smooth playback
             .enableWorkerThreads = true,      // Worker thread pool for async tasks
             .workerThreadCount = 0,           // Auto-detect (hardware_concurrency - 2)
-            .graphicsQueueDepth = 2,          // Triple buffering (2 queued + 1 presenting)
-            .enableParallelRSP = false        // Experimental RSP threading - disabled
+            .enableParallelRSP = false,       // Experimental RSP threading - disabled
+            .framePolicy = CV64_FRAME_POLICY_LATEST // Present the newest frame, drop stale ones
         };
         
         if (CV64_Threading_Init(&threadConfig)) {
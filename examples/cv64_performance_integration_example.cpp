@@ -10,6 +10,7 @@
 
 #include "../include/cv64_performance_optimizations.h"
 #include "../include/cv64_threading.h"
+#include "../include/cv64_hash.h"
 #include <stdio.h>
 
 /*===========================================================================
@@ -25,8 +26,8 @@ void InitializeCV64Performance() {
         .enableAsyncAudio = true,
         .enableWorkerThreads = true,
         .workerThreadCount = 0,  // Auto-detect based on CPU cores
-        .graphicsQueueDepth = 2,  // Double buffering
-        .enableParallelRSP = false  // Keep disabled unless you know what you're doing
+        .enableParallelRSP = false,  // Keep disabled unless you know what you're doing
+        .framePolicy = CV64_FRAME_POLICY_LATEST  // Present the newest frame
     };
     
     if (CV64_Threading_Init(&threadConfig)) {
@@ -44,6 +45,7 @@ void InitializeCV64Performance() {
         .enableTextureCaching = true,
         .enableFramebufferOptimization = true,
         .enableDrawCallBatching = true,
+        .enableDrawCallMerging = true,
         .maxTextureSize = 2048,  // 1024 for low-end, 4096 for high-end
         .mipmapBias = 0.0f,
         
@@ -129,13 +131,8 @@ GLuint CV64_UploadTextureOptimized(uint32_t tmemAddr,
                                     uint32_t format,
                                     void* pixelData,
                                     uint32_t dataSize) {
-    // Calculate CRC for cache validation
-    // (Simple example - GlideN64 may have its own CRC calculation)
-    uint32_t crc = 0;
-    uint8_t* data = (uint8_t*)pixelData;
-    for (uint32_t i = 0; i < dataSize; i++) {
-        crc = (crc >> 8) ^ data[i];
-    }
+    // Hash texture contents for cache validation
+    uint32_t crc = CV64_Hash_Texture(pixelData, dataSize);
     
     // Check if texture is in cache
     GLuint cachedTexId;
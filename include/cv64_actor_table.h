@@ -0,0 +1,105 @@
+/**
+ * @file cv64_actor_table.h
+ * @brief Castlevania 64 PC Recomp - Live actor table
+ *
+ * Once per VI the game's object tree (rooted at GameStateMgr, linked by the
+ * ObjectHeader next/child pointers) is walked and flattened into one
+ * structure-of-arrays table in host endianness. Consumers such as entity
+ * LOD, animation capture and the optimization stats read the table instead
+ * of chasing N64 pointers themselves.
+ *
+ * Each object gets a handle that stays the same for as long as the object
+ * stays at the same address with the same type ID. Handles of objects that
+ * disappear are never reused for a different object (the slot generation
+ * changes), so a stale handle simply stops resolving.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_ACTOR_TABLE_H
+#define CV64_ACTOR_TABLE_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum objects recorded per frame; the walk stops after this many */
+#define CV64_ACTOR_MAX          512
+
+/** Index value meaning "no such actor" */
+#define CV64_ACTOR_NONE         0xFFFFFFFFu
+
+/**
+ * @brief One frame of the object tree, flattened in walk order
+ *
+ * Column i of every array describes the same object. Positions come from
+ * the object's model (modelInfo +0x40); objects without a model have
+ * modelAddr 0, a zero position and a distance of -1.
+ */
+typedef struct CV64_ActorTable {
+    u32 frame;                          /**< Snapshot frame this table belongs to */
+    u32 count;                          /**< Valid entries */
+    u32 playerIndex;                    /**< Index of the player object, or CV64_ACTOR_NONE */
+    u32 modelCount;                     /**< Entries with a model */
+    bool truncated;                     /**< Walk hit CV64_ACTOR_MAX */
+
+    u32 handle[CV64_ACTOR_MAX];         /**< Stable handle (never 0) */
+    u32 addr[CV64_ACTOR_MAX];           /**< N64 address of the ObjectHeader */
+    u16 typeId[CV64_ACTOR_MAX];         /**< ObjectHeader ID */
+    u16 flags[CV64_ACTOR_MAX];          /**< ObjectHeader flags */
+    u32 modelAddr[CV64_ACTOR_MAX];      /**< N64 address of the model, 0 if none */
+    f32 posX[CV64_ACTOR_MAX];           /**< World position X */
+    f32 posY[CV64_ACTOR_MAX];           /**< World position Y */
+    f32 posZ[CV64_ACTOR_MAX];           /**< World position Z */
+    f32 distToPlayer[CV64_ACTOR_MAX];   /**< Distance to the player, -1 if unknown */
+} CV64_ActorTable;
+
+/**
+ * @brief Walk the object tree and publish a new table
+ *
+ * Called once per VI by CV64_Memory_FrameUpdate (emulation thread). A new
+ * RDRAM pointer or size drops all handles.
+ */
+CV64_API void CV64_Actors_Update(u8* rdram, u32 rdramSize);
+
+/**
+ * @brief Get the most recent table
+ *
+ * Tables are triple-buffered, so this returns a pointer into the live
+ * buffers rather than a copy. A borrowed table stays intact until the
+ * second CV64_Actors_Update after it: always safe on the emulation thread
+ * within a VI. Other threads should use CV64_Actors_BorrowTable and check
+ * CV64_Actors_IsBorrowValid after reading.
+ *
+ * @return Latest table, or NULL before the first walk
+ */
+CV64_API const CV64_ActorTable* CV64_Actors_GetTable(void);
+
+/**
+ * @brief Get the most recent table and its publish generation
+ * @param generation Receives the generation (0 before the first walk); may be NULL
+ * @return Latest table, or NULL before the first walk
+ */
+CV64_API const CV64_ActorTable* CV64_Actors_BorrowTable(u32* generation);
+
+/**
+ * @brief Check that a borrowed table was not overwritten while it was read
+ *
+ * Call after reading; if it returns false, discard what was read and
+ * borrow again.
+ */
+CV64_API bool CV64_Actors_IsBorrowValid(u32 generation);
+
+/**
+ * @brief Find the current index of a handle
+ * @return Index into table, or CV64_ACTOR_NONE if the object is gone
+ */
+CV64_API u32 CV64_Actors_FindHandle(const CV64_ActorTable* table, u32 handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CV64_ACTOR_TABLE_H */
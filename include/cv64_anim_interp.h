@@ -65,10 +65,26 @@ typedef struct CV64_BoneTransform {
     Vec3f   scale;          /**< Bone local scale (usually 1,1,1) */
 } CV64_BoneTransform;
 
+/**
+ * @brief Size of one bone record in guest RDRAM.
+ * 
+ * The guest record has the same fields and offsets as CV64_BoneTransform
+ * (position f32 x3 at 0x00, rotation s16 x3 at 0x0C, scale f32 x3 at 0x14)
+ * in N64 big-endian order.
+ */
+#define CV64_ANIM_GUEST_BONE_SIZE   0x20
+
 /*===========================================================================
  * Skeleton Snapshot — one frame of an entire skeleton
  *===========================================================================*/
 
+/**
+ * @brief A whole skeleton in array-of-structs form.
+ *
+ * Only used at the API boundary: internally poses are kept per component
+ * (one array per position/rotation/scale axis across all entities) so the
+ * interpolation runs over contiguous rows.
+ */
 typedef struct CV64_SkeletonSnapshot {
     Vec3f               root_position;      /**< World-space root position */
     s16                 root_rot_x;         /**< Root rotation X */
@@ -79,25 +95,6 @@ typedef struct CV64_SkeletonSnapshot {
     CV64_BoneTransform  bones[CV64_ANIM_MAX_BONES];
 } CV64_SkeletonSnapshot;
 
-/*===========================================================================
- * Interpolated Entity
- *===========================================================================*/
-
-/**
- * @brief Tracks the previous/current skeleton state for one entity
- *        and produces an interpolated result at render time.
- */
-typedef struct CV64_AnimInterpEntity {
-    u32                     entity_id;      /**< N64 actor/object pointer used as key */
-    bool                    active;         /**< Slot in use */
-    bool                    valid;          /**< Has at least 2 frames captured */
-    u32                     tick_captured;  /**< Game tick of last capture */
-
-    CV64_SkeletonSnapshot   prev;           /**< Previous logic-tick snapshot */
-    CV64_SkeletonSnapshot   curr;           /**< Current logic-tick snapshot */
-    CV64_SkeletonSnapshot   rendered;       /**< Interpolated output (read at render time) */
-} CV64_AnimInterpEntity;
-
 /*===========================================================================
  * Interpolation Configuration
  *===========================================================================*/
@@ -109,6 +106,7 @@ typedef struct CV64_AnimInterpConfig {
     bool    interp_rotation;        /**< Interpolate bone rotations */
     bool    interp_scale;           /**< Interpolate bone scales */
     bool    interp_camera;          /**< Also interpolate camera transforms */
+    bool    interp_quaternion;      /**< Blend bone rotations as quaternions (false = per-axis Euler lerp, the default) */
     f32     blend_sharpness;        /**< 0.0 = full lerp, 1.0 = snap (default 0.0) */
 } CV64_AnimInterpConfig;
 
@@ -171,6 +169,49 @@ CV64_API void CV64_AnimInterp_Capture(
     s16                     root_rot_z
 );
 
+/**
+ * @brief One entry of a batched RDRAM capture.
+ */
+typedef struct CV64_AnimRDRAMCapture {
+    u32     entity_id;          /**< Entity identifier (typically the N64 actor pointer) */
+    u32     bone_array_addr;    /**< N64 address of bone_count guest bone records */
+    u32     bone_count;         /**< Bones to read (clamped to CV64_ANIM_MAX_BONES) */
+    bool    has_root;           /**< Use the root fields below; otherwise keep the previous root */
+    Vec3f   root_position;      /**< World-space root position */
+    s16     root_rot_x;         /**< Root rotation X */
+    s16     root_rot_y;         /**< Root rotation Y */
+    s16     root_rot_z;         /**< Root rotation Z */
+} CV64_AnimRDRAMCapture;
+
+/**
+ * @brief Capture one skeleton straight from guest RDRAM.
+ * 
+ * Same as CV64_AnimInterp_Capture, but the bones are read from the guest
+ * bone array (see CV64_ANIM_GUEST_BONE_SIZE) instead of a caller-built
+ * array. The root transform is kept from the previous capture.
+ * 
+ * @param entity_id           Entity identifier
+ * @param n64_bone_array_addr N64 address of the first bone record
+ * @param bone_count          Number of bones
+ * @return TRUE if captured (FALSE if the range is outside RDRAM, the
+ *         table is full or interpolation is inactive)
+ */
+CV64_API bool CV64_AnimInterp_CaptureFromRDRAM(u32 entity_id, u32 n64_bone_array_addr,
+                                               u32 bone_count);
+
+/**
+ * @brief Capture many skeletons from guest RDRAM in one pass.
+ * 
+ * Call once per logic tick with every animated actor instead of one
+ * Capture per actor. Entries whose bone array is outside RDRAM are skipped.
+ * 
+ * @param captures Array of capture entries
+ * @param count    Number of entries
+ * @return Number of entries captured
+ */
+CV64_API u32 CV64_AnimInterp_CaptureBatchFromRDRAM(const CV64_AnimRDRAMCapture* captures,
+                                                   u32 count);
+
 /**
  * @brief Compute interpolated poses for all tracked entities.
  * 
@@ -190,6 +231,9 @@ CV64_API void CV64_AnimInterp_Update(f32 alpha);
  * Returns NULL if the entity is not tracked or doesn't have
  * enough frames for interpolation yet.
  * 
+ * The snapshot is assembled on the first call after each Update and
+ * stays valid until the entity is removed.
+ * 
  * @param entity_id Entity identifier
  * @return Interpolated skeleton snapshot, or NULL
  */
@@ -221,6 +265,38 @@ CV64_API void CV64_AnimInterp_RemoveAll(void);
  */
 CV64_API u32 CV64_AnimInterp_GetEntityCount(void);
 
+/*===========================================================================
+ * Benchmark
+ *===========================================================================*/
+
+/**
+ * @brief Timings for one entity count, in microseconds per Update
+ */
+typedef struct CV64_AnimInterpBenchResult {
+    u32     entity_count;           /**< Entities interpolated per Update */
+    u32     bone_count;             /**< Bones per entity */
+    f64     euler_us;               /**< Per-axis Euler lerp, one thread */
+    f64     quat_scalar_us;         /**< Quaternion blend, scalar kernel, one thread */
+    f64     quat_simd_us;           /**< Quaternion blend, SIMD kernel, one thread */
+    f64     quat_parallel_us;       /**< Quaternion blend, SIMD kernel, split across the worker pool */
+    f32     max_error_units;        /**< Worst SIMD rotation error vs a double-precision slerp (s16 angle units) */
+} CV64_AnimInterpBenchResult;
+
+/**
+ * @brief Time a full Update at 16, 64 and 128 entities x 64 bones
+ * 
+ * Runs on private pose storage, so it is safe to call while the game is
+ * running. Results are also written to the debug log. Without worker
+ * threads the parallel column measures the inline fallback.
+ * 
+ * @param outResults Optional output array
+ * @param maxResults Capacity of outResults
+ * @param iterations Updates per measurement (0 = 1000)
+ * @return Number of entity counts measured
+ */
+CV64_API u32 CV64_AnimInterp_RunBenchmark(CV64_AnimInterpBenchResult* outResults, u32 maxResults,
+                                          u32 iterations);
+
 #ifdef __cplusplus
 }
 #endif
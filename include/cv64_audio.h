@@ -31,6 +31,7 @@ typedef enum CV64_AudioBackend {
     CV64_AUDIO_BACKEND_DIRECTSOUND, /**< DirectSound */
     CV64_AUDIO_BACKEND_OPENAL,      /**< OpenAL */
     CV64_AUDIO_BACKEND_SDL,         /**< SDL Audio */
+    CV64_AUDIO_BACKEND_HEADLESS,    /**< No device: render as fast as the emulator produces (benchmarks/CI) */
     CV64_AUDIO_BACKEND_COUNT
 } CV64_AudioBackend;
 
@@ -81,8 +82,39 @@ typedef struct CV64_AudioConfig {
     bool enable_hd_music;           /**< Load HD music packs */
     char hd_music_path[260];
     
+    /* Headless backend */
+    char headless_wav_path[260];    /**< WAV file receiving the rendered output (empty = none); created on the first RomOpen, appended to by later ones */
+    bool headless_unthrottled;      /**< Turn the core speed limiter off while emulating headless (default true) */
+    
 } CV64_AudioConfig;
 
+/*===========================================================================
+ * Audio Pipeline Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Throughput and per-stage timing of the output path
+ *
+ * Counters run from ROM open (or the last reset). Stage times are the time
+ * spent inside each stage on the thread that runs it, summed over calls.
+ */
+typedef struct CV64_AudioPipelineStats {
+    CV64_AudioBackend backend;      /**< Backend actually in use */
+    u32 source_rate;                /**< Current AI rate */
+    u32 device_rate;                /**< Output rate */
+    u64 frames_queued;              /**< AI frames handed to the sample ring */
+    u64 frames_rendered;            /**< Output frames produced */
+    f64 wall_seconds;               /**< Wall time covered by the counters */
+    f64 frames_per_second;          /**< frames_rendered / wall_seconds */
+    f64 realtime_factor;            /**< Output seconds rendered per wall second */
+    f64 queue_us;                   /**< AI DMA handling and CV64_Audio_QueueSamples */
+    f64 resample_us;                /**< Ring reads and resampling */
+    f64 mix_us;                     /**< Volume scaling and SFX mixing */
+    f64 sink_us;                    /**< Handing output to the sink (WAV writing when headless) */
+    u64 wav_bytes;                  /**< Sample bytes written to headless_wav_path */
+    bool speed_limiter_off;         /**< Core speed limiter was off (emulation not paced to 60 VI/s) */
+} CV64_AudioPipelineStats;
+
 /*===========================================================================
  * Sound Effect Structure
  *===========================================================================*/
@@ -100,6 +132,19 @@ typedef struct CV64_SoundEffect {
     bool looping;                   /**< TRUE for looping sound */
 } CV64_SoundEffect;
 
+/*===========================================================================
+ * Built-in Sound Effect IDs
+ *===========================================================================*/
+
+/** Sound effects loaded from the assets folder when the audio device opens */
+typedef enum CV64_SFXId {
+    CV64_SFX_NONE = 0,
+    CV64_SFX_ITEM_PICKUP,           /**< assets/ItemPickup.wav */
+    CV64_SFX_POWERUP_PICKUP,        /**< assets/PowerUpPickup.wav */
+    CV64_SFX_GOLD_PICKUP,           /**< assets/GoldPickup.wav */
+    CV64_SFX_BUILTIN_COUNT
+} CV64_SFXId;
+
 /*===========================================================================
  * Music Track Structure
  *===========================================================================*/
@@ -157,12 +202,26 @@ CV64_API u32 CV64_Audio_PlaySFX(u32 sfx_id);
 
 /**
  * @brief Play a 3D positioned sound effect
+ *
+ * Gain and pan follow the listener set with CV64_Audio_SetListenerPosition
+ * and CV64_Audio_SetListenerOrientation.
+ *
  * @param sfx_id Sound effect ID
  * @param position 3D position
- * @return Handle to playing sound
+ * @return Handle to playing sound, or 0 on failure
  */
 CV64_API u32 CV64_Audio_PlaySFX3D(u32 sfx_id, Vec3f* position);
 
+/**
+ * @brief Play a sound effect with explicit gain, pan and looping
+ * @param sfx_id Sound effect ID
+ * @param volume Volume (0.0 - 1.0)
+ * @param pan Pan (-1.0 left, 0.0 center, 1.0 right)
+ * @param loop TRUE to loop until stopped
+ * @return Handle to playing sound, or 0 on failure
+ */
+CV64_API u32 CV64_Audio_PlaySFXEx(u32 sfx_id, f32 volume, f32 pan, bool loop);
+
 /**
  * @brief Stop a playing sound
  * @param handle Sound handle
@@ -183,6 +242,13 @@ CV64_API void CV64_Audio_SetSFXVolume(u32 handle, f32 volume);
  */
 CV64_API void CV64_Audio_SetSFXPosition(u32 handle, Vec3f* position);
 
+/**
+ * @brief Set sound effect pan (non-3D sounds)
+ * @param handle Sound handle
+ * @param pan Pan (-1.0 left, 0.0 center, 1.0 right)
+ */
+CV64_API void CV64_Audio_SetSFXPan(u32 handle, f32 pan);
+
 /*===========================================================================
  * Music Functions
  *===========================================================================*/
@@ -299,6 +365,25 @@ CV64_API bool CV64_Audio_LoadConfig(const char* filepath);
  */
 CV64_API bool CV64_Audio_SaveConfig(const char* filepath);
 
+/**
+ * @brief Get output pipeline statistics
+ * @param stats Receives the statistics
+ */
+CV64_API void CV64_Audio_GetPipelineStats(CV64_AudioPipelineStats* stats);
+
+/**
+ * @brief Restart the pipeline counters
+ */
+CV64_API void CV64_Audio_ResetPipelineStats(void);
+
+/**
+ * @brief Tell the pipeline statistics whether the core speed limiter is on
+ *
+ * Called by the integration layer, which owns the core, whenever it
+ * changes the limiter.
+ */
+CV64_API void CV64_Audio_SetSpeedLimiterState(bool enabled);
+
 /*===========================================================================
  * HD Audio Functions
  *===========================================================================*/
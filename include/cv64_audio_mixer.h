@@ -0,0 +1,114 @@
+/**
+ * @file cv64_audio_mixer.h
+ * @brief Castlevania 64 PC Recomp - Sound effect voice pool
+ *
+ * Backs the CV64_Audio_PlaySFX family. Sounds are registered once as
+ * interleaved stereo s16 at the device rate; each play claims one of
+ * CV64_MIXER_MAX_VOICES voices, which carries its own gain, pan and loop
+ * flag. The device callback mixes every live voice into its buffer with
+ * saturating int16 SIMD adds.
+ *
+ * Voices are handed between the game thread and the callback through
+ * per-voice atomics only: the callback never allocates, locks or waits.
+ * Handles are generation-tagged, so a handle whose sound has finished (and
+ * whose voice was reused) is silently ignored by the control functions.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_AUDIO_MIXER_H
+#define CV64_AUDIO_MIXER_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Voices that can play at once; further plays fail until one finishes */
+#define CV64_MIXER_MAX_VOICES       64
+
+/** Highest registrable sound ID + 1 */
+#define CV64_MIXER_MAX_SOUNDS       256
+
+/** 3D sounds play at full volume up to this distance from the listener */
+#define CV64_MIXER_3D_MIN_DISTANCE  100.0f
+
+/** 3D sounds fade out linearly and are silent from this distance on */
+#define CV64_MIXER_3D_MAX_DISTANCE  3000.0f
+
+/**
+ * @brief Mixer statistics
+ */
+typedef struct CV64_MixerStats {
+    u32 soundCount;             /**< Registered sounds */
+    u32 activeVoices;           /**< Voices mixed by the last callback */
+    u32 peakVoices;             /**< Most voices mixed by one callback */
+    u64 voicesStarted;          /**< Plays that got a voice */
+    u64 voicesDropped;          /**< Plays refused because every voice was busy */
+    u64 mixCount;               /**< Mix calls */
+    f64 lastMixMicros;          /**< Time spent in the last Mix */
+    f64 peakMixMicros;          /**< Longest Mix */
+} CV64_MixerStats;
+
+/**
+ * @brief Register a sound under an ID
+ *
+ * The frames are copied. An ID can only be registered once per mixer
+ * lifetime so a playing voice never sees its data replaced.
+ *
+ * @param sfx_id Sound ID (1 .. CV64_MIXER_MAX_SOUNDS - 1)
+ * @param frames Interleaved stereo s16 samples at the device rate
+ * @param frameCount Number of stereo frames
+ * @return true on success
+ */
+CV64_API bool CV64_Mixer_RegisterSound(u32 sfx_id, const s16* frames, u32 frameCount);
+
+/**
+ * @brief Check if a sound ID has been registered
+ */
+CV64_API bool CV64_Mixer_IsSoundRegistered(u32 sfx_id);
+
+/**
+ * @brief Mix every live voice into a buffer (audio callback)
+ *
+ * Voices are added on top of whatever the buffer already holds.
+ *
+ * @param stream Interleaved stereo s16 buffer
+ * @param frameCount Stereo frames in the buffer
+ */
+CV64_API void CV64_Mixer_Mix(s16* stream, u32 frameCount);
+
+/**
+ * @brief Scale samples in place with saturation
+ * @param samples s16 samples
+ * @param count Sample count
+ * @param gain Gain (0.0 - 1.0)
+ */
+CV64_API void CV64_Mixer_Scale(s16* samples, u32 count, f32 gain);
+
+/**
+ * @brief Stop every voice immediately
+ *
+ * Only call while the audio callback is not running (device paused or
+ * closed).
+ */
+CV64_API void CV64_Mixer_Reset(void);
+
+/**
+ * @brief Stop every voice and free all registered sounds
+ *
+ * Only call once the audio device is closed.
+ */
+CV64_API void CV64_Mixer_Shutdown(void);
+
+/**
+ * @brief Get mixer statistics
+ */
+CV64_API void CV64_Mixer_GetStats(CV64_MixerStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CV64_AUDIO_MIXER_H */
@@ -0,0 +1,129 @@
+/**
+ * @file cv64_audio_resampler.h
+ * @brief Castlevania 64 PC Recomp - Polyphase resampler with rate control
+ *
+ * Converts the game's AI-rate stereo stream to the device rate with a
+ * Kaiser-windowed sinc filter (CV64_RESAMPLER_TAPS taps, one coefficient
+ * row per 1/CV64_RESAMPLER_PHASES of a sample, linearly interpolated
+ * between rows). The dot products run on SSE on x64 and NEON on ARM64.
+ *
+ * The emulator and the audio device run on different clocks, so a fixed
+ * ratio slowly fills or drains whatever buffer sits between them.
+ * UpdateRate() is a small PI controller that nudges the ratio by at most
+ * CV64_RESAMPLER_MAX_ADJUST to hold that buffer at a target fill. The
+ * buffer can then be sized for the configured latency instead of being
+ * padded to hide drift.
+ *
+ * Everything lives inside the object: no allocation, no locks. One thread
+ * (the audio callback) owns an instance.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_AUDIO_RESAMPLER_H
+#define CV64_AUDIO_RESAMPLER_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+
+/** Filter length in input frames (multiple of 4) */
+#define CV64_RESAMPLER_TAPS         16
+
+/** Coefficient rows per input frame */
+#define CV64_RESAMPLER_PHASES       256
+
+/** Input frames the resampler can hold */
+#define CV64_RESAMPLER_MAX_FRAMES   8192
+
+/** Largest ratio correction applied by the rate controller (+/-0.5%) */
+#define CV64_RESAMPLER_MAX_ADJUST   0.005
+
+class CV64_AudioResampler {
+public:
+    CV64_AudioResampler();
+
+    CV64_AudioResampler(const CV64_AudioResampler&) = delete;
+    CV64_AudioResampler& operator=(const CV64_AudioResampler&) = delete;
+
+    /**
+     * @brief Set source and device rates
+     *
+     * The filter is rebuilt only when a rate actually changes; buffered
+     * input and the controller state are kept so a rate switch does not
+     * click.
+     *
+     * @return false if either rate is zero
+     */
+    bool Configure(u32 srcRate, u32 dstRate);
+
+    /**
+     * @brief Drop buffered input and reset the controller
+     */
+    void Reset();
+
+    /**
+     * @brief Input frames to Push() so Render(outFrames) can fill its buffer
+     */
+    u32 FramesWanted(u32 outFrames) const;
+
+    /**
+     * @brief Append interleaved stereo s16 input
+     * @return Frames accepted (short when the input buffer is full)
+     */
+    u32 Push(const s16* frames, u32 count);
+
+    /**
+     * @brief Produce interleaved stereo s16 output
+     * @return Frames produced; fewer than outFrames means input ran out
+     */
+    u32 Render(s16* out, u32 outFrames);
+
+    /**
+     * @brief Input frames buffered and not yet consumed
+     */
+    u32 Buffered() const;
+
+    /**
+     * @brief Feed the controller one fill measurement
+     * @param fillFrames Source frames queued ahead of the resampler
+     * @param targetFrames Desired fill
+     */
+    void UpdateRate(f64 fillFrames, f64 targetFrames);
+
+    /**
+     * @brief Current ratio correction (e.g. 0.001 = consuming 0.1% faster)
+     */
+    f64 RateAdjust() const { return m_adjust; }
+
+    u32 SourceRate() const { return m_srcRate; }
+    u32 DeviceRate() const { return m_dstRate; }
+
+    /**
+     * @brief Name of the filter kernel in use ("sse", "neon", "scalar")
+     */
+    static const char* KernelName();
+
+private:
+    void BuildFilter();
+    void Discard();
+
+    alignas(16) f32 m_coeffs[(CV64_RESAMPLER_PHASES + 1) * CV64_RESAMPLER_TAPS];
+    alignas(16) f32 m_left[CV64_RESAMPLER_MAX_FRAMES + CV64_RESAMPLER_TAPS];
+    alignas(16) f32 m_right[CV64_RESAMPLER_MAX_FRAMES + CV64_RESAMPLER_TAPS];
+
+    u32 m_srcRate = 0;
+    u32 m_dstRate = 0;
+    u32 m_count = 0;        /* Valid frames in m_left/m_right */
+    u64 m_pos = 0;          /* 32.32 index of the first tap of the next output */
+    u64 m_baseStep = 0;     /* 32.32 source frames per output frame */
+    u64 m_step = 0;         /* m_baseStep with the controller correction */
+
+    f64 m_adjust = 0.0;
+    f64 m_smoothed = 0.0;
+    f64 m_integral = 0.0;
+};
+
+#endif /* __cplusplus */
+
+#endif /* CV64_AUDIO_RESAMPLER_H */
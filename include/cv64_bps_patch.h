@@ -18,6 +18,9 @@
 extern "C" {
 #endif
 
+/** Subfolder of the patches folder holding the patched ROM cache */
+#define CV64_BPS_CACHE_DIR "cache"
+
 /**
  * @brief BPS patch result codes
  */
@@ -48,6 +51,11 @@ typedef struct CV64_BPS_PatchInfo {
 /**
  * @brief Apply all BPS patches from the patches folder to the ROM
  * 
+ * Patches are applied as a chain in file name order. The result is cached
+ * in CV64_BPS_CACHE_DIR, keyed by the ROM CRC and the CRC and size of each
+ * patch; a later call with the same inputs maps the cached ROM (checked
+ * against its stored hash) instead of patching again.
+ * 
  * @param romData Pointer to ROM data (will be modified in place)
  * @param romSize Pointer to ROM size (may be updated if patch changes size)
  * @param maxSize Maximum buffer size for output
@@ -55,6 +63,32 @@ typedef struct CV64_BPS_PatchInfo {
  */
 CV64_API CV64_BPS_Result CV64_BPS_ApplyPatches(u8* romData, size_t* romSize, size_t maxSize);
 
+/**
+ * @brief Check whether the patches folder holds any .bps file
+ *
+ * Only lists the folder. Lets a loader use a read-only ROM mapping when
+ * there is nothing to apply.
+ */
+CV64_API bool CV64_BPS_HasPatches(void);
+
+/**
+ * @brief Apply a list of BPS patches to the ROM as a chain
+ *
+ * Each patch is applied only if its source CRC matches the ROM as left by
+ * the patches before it; others are skipped. Patches alternate between
+ * romData and one scratch buffer, so the ROM is copied at most once.
+ *
+ * @param patchPaths Patch file paths, applied in order
+ * @param patchCount Number of paths
+ * @param romData Pointer to ROM data (will be modified in place)
+ * @param romSize Pointer to ROM size (may be updated if patch changes size)
+ * @param maxSize Maximum buffer size for output
+ * @return CV64_BPS_SUCCESS if at least one patch applied; if none did, the
+ *         reason the first patch was skipped (the ROM is unchanged)
+ */
+CV64_API CV64_BPS_Result CV64_BPS_ApplyPatchList(const char* const* patchPaths, u32 patchCount,
+                                                 u8* romData, size_t* romSize, size_t maxSize);
+
 /**
  * @brief Apply a single BPS patch to data
  * 
@@ -17,7 +17,11 @@ extern "C" {
  * 
  * This function loads cv64_graphics.ini, cv64_controls.ini, cv64_audio.ini,
  * and cv64_patches.ini from the patches/ directory and applies their settings
- * to the mupen64plus core and GLideN64 plugin configuration systems.
+ * to the mupen64plus core and GLideN64 plugin configuration systems, and
+ * the [Audio] backend, latency_ms, headless_wav_path and
+ * headless_unthrottled keys to the audio plugin (the CV64_AUDIO_BACKEND,
+ * CV64_AUDIO_LATENCY_MS, CV64_AUDIO_WAV_PATH and
+ * CV64_AUDIO_HEADLESS_UNTHROTTLED environment variables override them).
  * 
  * Should be called after CoreStartup() but before loading plugins.
  * 
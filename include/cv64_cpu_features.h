@@ -0,0 +1,122 @@
+/**
+ * @file cv64_cpu_features.h
+ * @brief Castlevania 64 PC Recomp - Runtime CPU feature detection
+ *
+ * Small header-only helpers for modules that pick a SIMD kernel at run
+ * time. Each query runs CPUID (or the OS equivalent) once and caches the
+ * answer. Kernels that use instructions beyond the compiler baseline are
+ * marked with CV64_CPU_TARGET so GCC/Clang accept the intrinsics; MSVC
+ * needs no annotation.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_CPU_FEATURES_H
+#define CV64_CPU_FEATURES_H
+
+#ifdef __cplusplus
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define CV64_CPU_X64 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define CV64_CPU_ARM64 1
+#include <arm_neon.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <Windows.h>
+#else
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CV64_CPU_TARGET(x) __attribute__((target(x)))
+#else
+#define CV64_CPU_TARGET(x)
+#endif
+
+#ifdef CV64_CPU_X64
+
+struct CV64_CpuIdRegs {
+    unsigned int eax, ebx, ecx, edx;
+};
+
+inline CV64_CpuIdRegs CV64_Cpu_CpuId(unsigned int leaf, unsigned int subleaf = 0) {
+    CV64_CpuIdRegs r = {};
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuidex(regs, (int)leaf, (int)subleaf);
+    r.eax = (unsigned int)regs[0];
+    r.ebx = (unsigned int)regs[1];
+    r.ecx = (unsigned int)regs[2];
+    r.edx = (unsigned int)regs[3];
+#else
+    __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+    return r;
+}
+
+inline bool CV64_Cpu_HasSSE41() {
+    static const bool has = (CV64_Cpu_CpuId(1).ecx & (1u << 19)) != 0;
+    return has;
+}
+
+inline bool CV64_Cpu_HasPCLMUL() {
+    static const bool has = (CV64_Cpu_CpuId(1).ecx & (1u << 1)) != 0;
+    return has;
+}
+
+inline bool CV64_Cpu_HasAVX2() {
+    static const bool has = [] {
+        if (CV64_Cpu_CpuId(0).eax < 7) return false;
+        unsigned int ecx = CV64_Cpu_CpuId(1).ecx;
+        const bool osxsave = (ecx & (1u << 27)) != 0;
+        const bool avx = (ecx & (1u << 28)) != 0;
+        if (!osxsave || !avx) return false;
+        /* OS must save YMM state on context switch */
+#ifdef _MSC_VER
+        if ((_xgetbv(0) & 0x6) != 0x6) return false;
+#else
+        unsigned int xcr0Lo, xcr0Hi;
+        __asm__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+        if ((xcr0Lo & 0x6) != 0x6) return false;
+#endif
+        return (CV64_Cpu_CpuId(7, 0).ebx & (1u << 5)) != 0;
+    }();
+    return has;
+}
+
+#endif /* CV64_CPU_X64 */
+
+#ifdef CV64_CPU_ARM64
+
+inline bool CV64_Cpu_HasArmCRC32() {
+    static const bool has = [] {
+#if defined(_WIN32)
+        return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(__APPLE__)
+        return true;
+#elif defined(__linux__)
+        return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+        return false;
+#endif
+    }();
+    return has;
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+#endif /* __cplusplus */
+
+#endif /* CV64_CPU_FEATURES_H */
@@ -1,8 +1,14 @@
 /**
  * @file cv64_embedded_rom.h
  * @brief Embedded ROM access interface
- * 
+ *
  * Provides access to the ROM embedded as a Windows resource.
+ *
+ * The resource is normally a packed image written by pack_embedded_rom.ps1:
+ * the ROM split into CV64_EMBEDDED_ROM_FRAME_SIZE frames, each compressed
+ * on its own as an LZ4 block and carrying the CRC-32 of its raw bytes.
+ * Frames are decompressed in parallel and checked as they are produced.
+ * A resource without the packed header is used as a raw ROM image.
  */
 
 #ifndef CV64_EMBEDDED_ROM_H
@@ -15,13 +21,64 @@
 extern "C" {
 #endif
 
+/** Packed image magic ("CV64ROMZ") and format version */
+#define CV64_EMBEDDED_ROM_MAGIC      "CV64ROMZ"
+#define CV64_EMBEDDED_ROM_VERSION    1
+
+/** Uncompressed bytes per frame written by the packer */
+#define CV64_EMBEDDED_ROM_FRAME_SIZE (256 * 1024)
+
+/**
+ * @brief Packed image header, followed by frameCount frame entries
+ *
+ * All fields are little-endian. Offsets are from the start of the resource.
+ */
+typedef struct CV64_EmbeddedRomHeader {
+    char magic[8];          /**< CV64_EMBEDDED_ROM_MAGIC */
+    uint32_t version;       /**< CV64_EMBEDDED_ROM_VERSION */
+    uint32_t frameSize;     /**< Uncompressed bytes per frame (last may be short) */
+    uint64_t romSize;       /**< Uncompressed ROM size */
+    uint32_t frameCount;    /**< Number of frame entries */
+    uint32_t reserved;
+} CV64_EmbeddedRomHeader;
+
+typedef struct CV64_EmbeddedRomFrame {
+    uint32_t offset;        /**< Offset of the frame data */
+    uint32_t packedSize;    /**< Stored bytes; equal to the raw size for a stored frame */
+    uint32_t crc;           /**< CRC-32 of the uncompressed frame */
+} CV64_EmbeddedRomFrame;
+
 /**
  * @brief Get pointer to embedded ROM data
+ *
+ * A packed resource is decompressed into a buffer owned by this module on
+ * the first call. Callers that need their own copy should use
+ * CV64_ReadEmbeddedRom() instead, which avoids the extra buffer.
+ *
  * @param[out] size Receives the size of the ROM in bytes
- * @return Pointer to ROM data, or NULL if not found
+ * @return Pointer to ROM data, or NULL if not found or corrupt
  */
 const uint8_t* CV64_GetEmbeddedRom(size_t* size);
 
+/**
+ * @brief Get the uncompressed size of the embedded ROM
+ * @return Size in bytes, or 0 if there is no embedded ROM
+ */
+size_t CV64_GetEmbeddedRomSize(void);
+
+/**
+ * @brief Decompress the embedded ROM into a caller buffer
+ *
+ * Frames are decoded in parallel on the worker pool (or short-lived
+ * threads while the pool is not running) and each is checked against its
+ * CRC. Throughput is logged.
+ *
+ * @param dst Buffer of at least CV64_GetEmbeddedRomSize() bytes
+ * @param capacity Size of dst
+ * @return 1 on success, 0 if there is no ROM, dst is too small or a frame is corrupt
+ */
+int CV64_ReadEmbeddedRom(uint8_t* dst, size_t capacity);
+
 /**
  * @brief Check if embedded ROM is available
  * @return 1 if embedded ROM exists, 0 otherwise
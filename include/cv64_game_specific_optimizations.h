@@ -122,8 +122,9 @@ bool CV64_GameOpt_ShouldSkipParticle(uint32_t particleIndex);
 /**
  * Check if entity should be skipped
  * 
- * @param entityIndex Index of entity
- * @param distanceFromPlayer Distance from player in game units
+ * @param entityIndex Index into the live actor table (cv64_actor_table.h)
+ * @param distanceFromPlayer Distance from player in game units, or negative
+ *        to use the actor table's distance for entityIndex
  * @return true if should skip rendering
  */
 bool CV64_GameOpt_ShouldSkipEntity(uint32_t entityIndex, float distanceFromPlayer);
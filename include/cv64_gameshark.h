@@ -0,0 +1,113 @@
+/**
+ * @file cv64_gameshark.h
+ * @brief Castlevania 64 PC Recomp - Compiled GameShark code engine
+ *
+ * Code lists are plain GameShark text ("81389C3E 0064", one code per line
+ * or comma separated, '#', ';' and '//' start comments). Each list is parsed
+ * and bounds-checked once when it is added and compiled into a compact
+ * bytecode; every VI the enabled lists run as a single flat program against
+ * RDRAM with no per-write validation or logging.
+ *
+ * Supported code types:
+ *   80/A0 XXXXXX 00YY   8-bit write
+ *   81/A1 XXXXXX YYYY   16-bit write
+ *   D0    XXXXXX 00YY   run next code if 8-bit value == YY
+ *   D1    XXXXXX YYYY   run next code if 16-bit value == YYYY
+ *   D2    XXXXXX 00YY   run next code if 8-bit value != YY
+ *   D3    XXXXXX YYYY   run next code if 16-bit value != YYYY
+ *   50    00NNSS VVVV   repeat next 80/81 code NN times, stepping the
+ *                       address by SS and the value by VVVV
+ *
+ * Activator (88/89), boot-time (EE/F0/F1/FF) and other code types are
+ * rejected with an error naming the line.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_GAMESHARK_H
+#define CV64_GAMESHARK_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CV64_GAMESHARK_INVALID_LIST (-1)
+
+/**
+ * @brief Compile error details
+ */
+typedef struct CV64_GameSharkError {
+    u32 line;                   /**< 1-based line of the offending code (0 = none) */
+    char message[128];          /**< Human-readable reason */
+} CV64_GameSharkError;
+
+/**
+ * @brief Engine statistics
+ */
+typedef struct CV64_GameSharkStats {
+    u32 listCount;              /**< Registered code lists */
+    u32 enabledListCount;       /**< Lists in the running program */
+    u32 rejectedListCount;      /**< Enabled lists that do not fit the current RDRAM size */
+    u32 instructionCount;       /**< Bytecode instructions in the running program */
+    u32 writesLastRun;          /**< Writes performed by the last Run */
+    u64 runCount;               /**< Total Run calls that executed the program */
+    f64 lastRunMicros;          /**< Time spent in the last Run */
+} CV64_GameSharkStats;
+
+/**
+ * @brief Parse and compile a code list
+ *
+ * Addresses are checked against the full 8MB RDRAM window here; lists that
+ * reach beyond the RDRAM actually mapped are skipped (and logged once) when
+ * the program is rebuilt for that size.
+ *
+ * @param name Display name used in logs (copied)
+ * @param codes Code list text
+ * @param enabled Initial enable state
+ * @param outError Optional, receives the first compile error
+ * @return List id, or CV64_GAMESHARK_INVALID_LIST if the text did not compile
+ */
+CV64_API s32 CV64_GameShark_AddList(const char* name, const char* codes, bool enabled,
+                                    CV64_GameSharkError* outError);
+
+/**
+ * @brief Remove a code list
+ * @return true if the id was registered
+ */
+CV64_API bool CV64_GameShark_RemoveList(s32 id);
+
+/**
+ * @brief Enable/disable a code list
+ * @return true if the id was registered
+ */
+CV64_API bool CV64_GameShark_SetListEnabled(s32 id, bool enabled);
+
+/**
+ * @brief Check if a code list is enabled
+ */
+CV64_API bool CV64_GameShark_IsListEnabled(s32 id);
+
+/**
+ * @brief Run all enabled code lists once
+ *
+ * Call once per VI from the emulation thread. The program is rebuilt only
+ * when a list changes or the RDRAM size differs from the last call.
+ *
+ * @param rdram RDRAM base (host word order, as handed to CV64_Memory_SetRDRAM)
+ * @param rdramSize RDRAM size in bytes
+ * @return Number of writes performed
+ */
+CV64_API u32 CV64_GameShark_Run(u8* rdram, u32 rdramSize);
+
+/**
+ * @brief Get engine statistics
+ */
+CV64_API void CV64_GameShark_GetStats(CV64_GameSharkStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CV64_GAMESHARK_H */
@@ -340,7 +340,7 @@ void CV64_Optimize_FrameEnd(void);
 
 /**
  * @brief Called before texture load
- * @param crc Texture CRC
+ * @param crc Texture content hash (see CV64_Hash_Texture)
  * @param size Texture size in bytes
  * @return true to proceed with load, false to skip (cached)
  */
@@ -0,0 +1,88 @@
+/**
+ * @file cv64_hash.h
+ * @brief Castlevania 64 PC Recomp - Shared data hashing
+ *
+ * One place for the checksums used by the ROM/patch pipeline and the
+ * texture caches:
+ *
+ * - CV64_Hash_CRC32: standard (zlib/BPS) CRC-32. Uses PCLMULQDQ folding on
+ *   x86-64 or the ARMv8 CRC32 instructions when the CPU has them, and a
+ *   slice-by-16 table otherwise. All backends produce identical results.
+ * - CV64_Hash_XXH3: 64-bit XXH3 (default secret, seed 0). Not a CRC; use it
+ *   when the value only has to identify data inside this process (texture
+ *   cache keys, change detection). Much cheaper than CRC-32 on small inputs
+ *   such as TMEM loads, and uses AVX2 when available.
+ *
+ * Backends are chosen once by CPUID on first use.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_HASH_H
+#define CV64_HASH_H
+
+#include "cv64_types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief CRC-32 (polynomial 0xEDB88320) of a buffer
+ */
+CV64_API u32 CV64_Hash_CRC32(const void* data, size_t size);
+
+/**
+ * @brief Continue a CRC-32 over another chunk
+ *
+ * Start with crc = 0. CV64_Hash_CRC32Update(CV64_Hash_CRC32(a), b) equals
+ * the CRC-32 of a followed by b.
+ */
+CV64_API u32 CV64_Hash_CRC32Update(u32 crc, const void* data, size_t size);
+
+/**
+ * @brief 64-bit XXH3 of a buffer
+ */
+CV64_API u64 CV64_Hash_XXH3(const void* data, size_t size);
+
+/**
+ * @brief 32-bit content hash for texture identity
+ *
+ * Folded XXH3. This is the value texture cache callers should pass as the
+ * "crc" argument of CV64_Perf_CacheTexture / CV64_Optimize_OnTextureLoad.
+ */
+CV64_API u32 CV64_Hash_Texture(const void* data, size_t size);
+
+/**
+ * @brief Name of the CRC-32 backend in use ("pclmul", "armv8-crc", "slice16")
+ */
+CV64_API const char* CV64_Hash_GetCRC32Backend(void);
+
+/**
+ * @brief Per-size benchmark result
+ */
+typedef struct CV64_HashBenchResult {
+    size_t size;                    /**< Buffer size in bytes */
+    double crc32TableMBps;          /**< Slice-by-16 CRC-32 throughput */
+    double crc32MBps;               /**< Dispatched CRC-32 throughput */
+    double xxh3MBps;                /**< XXH3 throughput */
+    double bytewiseMBps;            /**< Old byte-at-a-time CRC-32 throughput */
+} CV64_HashBenchResult;
+
+/**
+ * @brief Benchmark all hash paths for power-of-two sizes from 64 B to 32 MB
+ *
+ * Also checks that every CRC-32 backend agrees. Results are logged.
+ *
+ * @param outResults Optional array receiving up to maxResults entries
+ * @param maxResults Capacity of outResults
+ * @return Number of sizes measured, 0 if a backend mismatch was detected
+ */
+CV64_API u32 CV64_Hash_RunBenchmark(CV64_HashBenchResult* outResults, u32 maxResults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CV64_HASH_H */
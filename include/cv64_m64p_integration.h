@@ -80,6 +80,12 @@ typedef enum {
     M64CMD_STATE_LOAD,
     M64CMD_STATE_SAVE,
     M64CMD_STATE_SET_SLOT,
+    M64CMD_SEND_SDL_KEYDOWN,
+    M64CMD_SEND_SDL_KEYUP,
+    M64CMD_SET_FRAME_CALLBACK,
+    M64CMD_TAKE_NEXT_SCREENSHOT,
+    M64CMD_CORE_STATE_SET,
+    M64CMD_READ_SCREEN,
     M64CMD_RESET,
     M64CMD_ADVANCE_FRAME
 } m64p_command;
@@ -345,9 +351,17 @@ CV64_API int CV64_M64P_GetSpeedFactor(void);
 
 /**
  * @brief Enable/disable speed limiter
+ *
+ * Takes effect immediately while emulation is running; otherwise only the
+ * config value for the next start is updated.
  */
 CV64_API void CV64_M64P_SetSpeedLimiter(bool enabled);
 
+/**
+ * @brief Check if the core speed limiter is on
+ */
+CV64_API bool CV64_M64P_GetSpeedLimiter(void);
+
 /*===========================================================================
  * Frame Callback API (for our patches)
  *===========================================================================*/
@@ -0,0 +1,79 @@
+/**
+ * @file cv64_mapped_file.h
+ * @brief Castlevania 64 PC Recomp - Read-only memory-mapped files
+ *
+ * Maps a whole file into the address space so loaders can parse it in
+ * place instead of reading it into a heap buffer first. Pages are faulted
+ * in on first touch, and a file that is read front to back (a BPS patch,
+ * a ROM image) is mapped with a sequential-access hint so the OS reads
+ * ahead.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_MAPPED_FILE_H
+#define CV64_MAPPED_FILE_H
+
+#include "cv64_types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A mapped file view
+ */
+typedef struct CV64_MappedFile {
+    const u8* data;                 /**< First byte of the file, NULL when not mapped */
+    size_t size;                    /**< File size in bytes */
+    void* fileHandle;               /**< Platform file handle (internal) */
+    void* mapHandle;                /**< Platform mapping handle (internal) */
+} CV64_MappedFile;
+
+/**
+ * @brief Expected access pattern for a range of a mapping
+ */
+typedef enum CV64_MapAdvice {
+    CV64_MAP_ADVICE_NORMAL = 0,     /**< Default read-ahead */
+    CV64_MAP_ADVICE_SEQUENTIAL,     /**< Read front to back: aggressive read-ahead */
+    CV64_MAP_ADVICE_RANDOM,         /**< Scattered reads: no read-ahead */
+    CV64_MAP_ADVICE_WILLNEED        /**< Start reading the range in now */
+} CV64_MapAdvice;
+
+/**
+ * @brief Map a file read-only
+ *
+ * Empty files cannot be mapped and fail like missing ones.
+ *
+ * @param path File path
+ * @param file Receives the view; zeroed on failure
+ * @return true on success
+ */
+CV64_API bool CV64_MappedFile_Open(const char* path, CV64_MappedFile* file);
+
+/**
+ * @brief Hint how a range of the mapping will be accessed
+ *
+ * Only a hint: madvise on POSIX. Windows has no per-range access pattern
+ * for views, so there only CV64_MAP_ADVICE_WILLNEED does anything
+ * (PrefetchVirtualMemory, Windows 8 and later).
+ *
+ * @param file Mapped file
+ * @param offset Start of the range (rounded down to a page)
+ * @param size Range size (clamped to the file)
+ * @param advice Access pattern
+ */
+CV64_API void CV64_MappedFile_Advise(const CV64_MappedFile* file, size_t offset, size_t size,
+                                     CV64_MapAdvice advice);
+
+/**
+ * @brief Unmap a file (safe on a zeroed or already closed view)
+ */
+CV64_API void CV64_MappedFile_Close(CV64_MappedFile* file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CV64_MAPPED_FILE_H */
@@ -156,10 +156,284 @@ CV64_API bool CV64_Memory_ShouldDPadControlCamera(void);
  */
 CV64_API void CV64_Memory_FrameUpdate(void);
 
+/*===========================================================================
+ * Per-Frame RDRAM Snapshot
+ *
+ * Every fixed-address field the hooks watch is gathered once per VI (at the
+ * top of CV64_Memory_FrameUpdate) into one host-endian struct. Consumers
+ * read the snapshot instead of touching RDRAM, so they all see the same
+ * frame and the bounds/lane-swizzle work is done once per field.
+ *===========================================================================*/
+
+/**
+ * @brief Snapshot field identifiers (bit index into validMask)
+ */
+typedef enum CV64_SnapField {
+    CV64_SNAP_PLAYER_PTR = 0,       ///< ptr_PlayerObject
+    CV64_SNAP_GOLD,                 ///< Player_gold
+    CV64_SNAP_IN_GAMEPLAY_LOOP,     ///< inPlayerGameplayLoop
+    CV64_SNAP_GAME_TIME,            ///< game_time
+    CV64_SNAP_IN_FIRST_PERSON,      ///< PLAYER_IS_IN_FIRST_PERSON_VIEW
+    CV64_SNAP_R_LOCK_VIEW,          ///< PLAYER_IS_LOCKING_VIEW_WITH_R
+    CV64_SNAP_PROCESS_GREEN,        ///< processMeter_greenBarSize
+    CV64_SNAP_PROCESS_BLUE,         ///< processMeter_blueBarSize
+    CV64_SNAP_PROCESS_DIVISOR,      ///< processBar_sizeDivisor
+    CV64_SNAP_PROCESS_DIVISIONS,    ///< processMeter_number_of_divisions
+    CV64_SNAP_BOSS_BAR_COLOR,       ///< boss_bar_fill_color
+    CV64_SNAP_FOG_COLOR,            ///< map_fog_color
+    CV64_SNAP_AMBIENT_BRIGHT,       ///< map_ambient_color_brightness
+    CV64_SNAP_DIFFUSE_COLOR,        ///< map_diffuse_color
+    CV64_SNAP_DONT_UPDATE_LIGHTING, ///< dont_update_map_lighting
+    CV64_SNAP_ENEMY_TARGET_PTR,     ///< ptr_enemyTargetGfx
+    CV64_SNAP_PLAYER_POS,           ///< current_player_position (Vec3f)
+    CV64_SNAP_MAP_ID,               ///< map_ID (live)
+    CV64_SNAP_CURRENT_MENU,         ///< current_opened_menu
+    CV64_SNAP_CHARACTER,            ///< getCurrentCharacter
+    CV64_SNAP_HEALTH,               ///< Player_health
+    CV64_SNAP_MAX_HEALTH,           ///< Player_max_health
+    CV64_SNAP_SUBWEAPON,            ///< Subweapon type
+    CV64_SNAP_SUBWEAPON_AMMO,       ///< Subweapon ammo
+    CV64_SNAP_MAP_ENTRANCE,         ///< map_entrance_ID_copy
+    CV64_SNAP_IS_SOFT_RESET,        ///< isSoftReset
+    CV64_SNAP_FADE_SETTINGS,        ///< fade_settings
+    CV64_SNAP_FADE_CURRENT_TIME,    ///< current_fade_time
+    CV64_SNAP_FADE_MAX_TIME,        ///< max_fade_time
+    CV64_SNAP_MAP_FADE_OUT_TIME,    ///< map_fade_out_time
+    CV64_SNAP_READING_TEXT,         ///< PLAYER_IS_READING_TEXT
+    CV64_SNAP_CUTSCENE_ID,          ///< cutscene_ID
+    CV64_SNAP_FOG_DIST_START,       ///< fog_distance_start
+    CV64_SNAP_FOG_DIST_END,         ///< fog_distance_end
+    CV64_SNAP_JEWELS,               ///< Player_red_jewels
+    CV64_SNAP_DIFFICULTY,           ///< save_difficulty
+    CV64_SNAP_SAVE_FILE_NUMBER,     ///< save_file_number
+    CV64_SNAP_POWERUP,              ///< current_PowerUp_level
+    CV64_SNAP_COSTUME,              ///< alternate_costume
+    CV64_SNAP_CONTPAK_FILE_NO,      ///< contPak_file_no
+    CV64_SNAP_HAS_MAX_HEALTH,       ///< PLAYER_HAS_MAX_HEALTH
+    CV64_SNAP_MOONJUMP_BUTTONS,     ///< Button byte tested by the Moon Jump code (D0387D7F)
+    CV64_SNAP_FIELD_COUNT
+} CV64_SnapField;
+
+/**
+ * @brief One frame of watched RDRAM fields, already in host byte order
+ *
+ * Fields are grouped by size so the struct has no interior padding. A
+ * field whose address was outside RDRAM is left at zero and its bit in
+ * validMask is clear.
+ */
+typedef struct CV64_RDRAMSnapshot {
+    u64 validMask;              ///< Bit (1 << CV64_SnapField) per gathered field
+    u32 frame;                  ///< Gather counter (0 = no snapshot yet)
+    u32 cameraMgr;              ///< cameraMgr address, 0 if out of range
+
+    /* 32-bit fields */
+    u32 playerPtr;
+    u32 gold;
+    u32 inGameplayLoop;
+    u32 gameTime;
+    s32 inFirstPerson;
+    s32 rLockView;
+    f32 processGreenSize;
+    f32 processBlueSize;
+    f32 processBarDivisor;
+    u32 processDivisions;
+    u32 bossBarFillColor;
+    u32 fogColor;
+    f32 ambientBrightness;
+    u32 diffuseColor;
+    u32 dontUpdateLighting;
+    u32 enemyTargetGfxPtr;
+    f32 playerPos[3];
+
+    /* 16-bit fields */
+    s16 mapId;
+    u16 currentMenu;
+    s16 character;
+    s16 health;
+    s16 maxHealth;
+    u16 subweapon;
+    u16 subweaponAmmo;
+    s16 mapEntrance;
+    u16 isSoftReset;
+    u16 fadeSettings;
+    u16 fadeCurrentTime;
+    u16 fadeMaxTime;
+    u16 mapFadeOutTime;
+    u16 readingText;
+    u16 cutsceneId;
+    u16 fogDistStart;
+    u16 fogDistEnd;
+
+    /* 8-bit fields */
+    u8 jewels;
+    u8 difficulty;
+    u8 saveFileNumber;
+    u8 powerupLevel;
+    u8 alternateCostume;
+    u8 contPakFileNo;
+    u8 hasMaxHealth;
+    u8 moonJumpButtons;
+} CV64_RDRAMSnapshot;
+
+/** @brief True if the snapshot holds a value for the given field */
+#define CV64_SNAP_HAS(snap, field) ((((snap)->validMask) >> (field)) & 1u)
+
+/**
+ * @brief Get the most recent snapshot
+ *
+ * Snapshots are published through a seqlock, so this is safe on any
+ * thread. The pointer refers to the calling thread's own copy: it never
+ * tears, but it is refreshed by this thread's next call.
+ *
+ * @return Latest snapshot, or NULL if none has been gathered yet
+ */
+CV64_API const CV64_RDRAMSnapshot* CV64_Memory_GetSnapshot(void);
+
+/**
+ * @brief Copy the most recent snapshot into a caller buffer
+ * @param out Receives the snapshot
+ * @return false if none has been gathered yet
+ */
+CV64_API bool CV64_Memory_CopySnapshot(CV64_RDRAMSnapshot* out);
+
+/*===========================================================================
+ * RDRAM Dirty Page Tracking
+ *
+ * When enabled, RDRAM is compared against a shadow copy once per VI (right
+ * after the snapshot gather) and every 4KB page written since the previous
+ * VI is flagged. Caches derived from RDRAM (display lists, textures,
+ * savestate deltas, watchers) can skip rehashing clean pages. The compare
+ * is one streaming pass (AVX2/SSE2/NEON); only dirty pages are copied.
+ *
+ * Offsets are physical RDRAM byte offsets (N64 address & 0x7FFFFF). Pages
+ * are word aligned, so the host lane swizzle does not affect them.
+ *===========================================================================*/
+
+#define CV64_RDRAM_PAGE_SHIFT   12
+#define CV64_RDRAM_PAGE_SIZE    (1u << CV64_RDRAM_PAGE_SHIFT)
+
+/**
+ * @brief Called once per run of consecutive dirty pages
+ * @param offset RDRAM byte offset of the first dirty page
+ * @param size Length of the run in bytes (multiple of CV64_RDRAM_PAGE_SIZE)
+ */
+typedef void (*CV64_DirtyRangeCallback)(u32 offset, u32 size, void* userData);
+
+/**
+ * @brief Result of the most recent diff
+ */
+typedef struct CV64_DirtyStats {
+    u32 frame;              /**< Snapshot frame the bitmap belongs to (0 = none yet) */
+    u32 pageCount;          /**< Pages covered (RDRAM size / 4KB) */
+    u32 dirtyPages;         /**< Pages that changed */
+    u32 dirtyRanges;        /**< Runs of consecutive dirty pages */
+    f64 lastDiffMicros;     /**< Time spent comparing and copying */
+} CV64_DirtyStats;
+
+/**
+ * @brief Enable/disable dirty page tracking (off by default)
+ *
+ * Enabling allocates an RDRAM-sized shadow copy; the first diff after
+ * enabling (or after CV64_Memory_SetRDRAM) reports every page dirty.
+ * Disabling frees the shadow on the next frame.
+ */
+CV64_API void CV64_Memory_SetDirtyTracking(bool enabled);
+
+/**
+ * @brief Check if dirty page tracking is enabled
+ */
+CV64_API bool CV64_Memory_IsDirtyTrackingEnabled(void);
+
+/**
+ * @brief Visit the dirty ranges of the most recent diff in address order
+ *
+ * Like the snapshot, the result describes one VI and is published through
+ * a seqlock, so any thread may call this; ranges come from a per-thread
+ * copy that a concurrent diff cannot tear.
+ *
+ * @return Number of ranges visited (0 if nothing changed or no diff yet)
+ */
+CV64_API u32 CV64_Memory_ForEachDirtyRange(CV64_DirtyRangeCallback callback, void* userData);
+
+/**
+ * @brief Check if any page overlapping [addr, addr + size) changed last VI
+ *
+ * Answers true when tracking is off or no diff has run yet, so callers can
+ * use it unconditionally as a "must rehash" test.
+ *
+ * @param addr N64 virtual address or physical offset
+ * @param size Length in bytes
+ */
+CV64_API bool CV64_Memory_IsRangeDirty(u32 addr, u32 size);
+
+/**
+ * @brief Get statistics for the most recent diff
+ */
+CV64_API void CV64_Memory_GetDirtyStats(CV64_DirtyStats* stats);
+
+/*===========================================================================
+ * Address Watchpoints
+ *
+ * Registered watches are read in one batch per VI (after the snapshot
+ * gather) and compared against the previous VI's values four at a time.
+ * Only watches whose value changed reach the predicate and callback, so
+ * frames where nothing changed cost one gather and one vector compare.
+ *
+ * Values are 1, 2 or 4 bytes, zero-extended to u32 in host order (the
+ * N64's big-endian value); cast to s8/s16/f32 as needed. Callbacks run on
+ * the emulation thread and may add or remove watches.
+ *===========================================================================*/
+
+#define CV64_WATCH_INVALID (-1)
+
+/**
+ * @brief Filter for a changed value; return true to invoke the callback
+ */
+typedef bool (*CV64_WatchPredicate)(u32 oldValue, u32 newValue, void* userData);
+
+/**
+ * @brief Called when a watched value changed and passed the predicate
+ */
+typedef void (*CV64_WatchCallback)(s32 watchId, u32 addr, u32 oldValue, u32 newValue, void* userData);
+
+/**
+ * @brief Watch an RDRAM value for changes
+ *
+ * The first VI after registration only records the current value.
+ *
+ * @param addr N64 address, aligned to size
+ * @param size 1, 2 or 4 bytes
+ * @param predicate Optional filter (NULL = every change)
+ * @param callback Function to call on change
+ * @param userData Passed to predicate and callback
+ * @return Watch id, or CV64_WATCH_INVALID on bad arguments
+ */
+CV64_API s32 CV64_Memory_Watch(u32 addr, u32 size, CV64_WatchPredicate predicate,
+                               CV64_WatchCallback callback, void* userData);
+
+/**
+ * @brief Remove a watch
+ *
+ * If called from a callback, changes already detected in the same VI may
+ * still be delivered for the removed watch.
+ *
+ * @return true if the id was registered
+ */
+CV64_API bool CV64_Memory_Unwatch(s32 watchId);
+
+/**
+ * @brief Number of registered watches
+ */
+CV64_API u32 CV64_Memory_GetWatchCount(void);
+
 /*===========================================================================
  * Gameshark Cheats
  *===========================================================================*/
 
+/* Forest fix, infinite health/sub-weapon and moon jump are built-in code
+ * lists run by the GameShark engine (cv64_gameshark.h) together with any
+ * user lists added through CV64_GameShark_AddList. */
+
 /**
  * @brief Enable/disable camera patch cheat
  * 
@@ -443,6 +717,12 @@ typedef struct CV64_GameInfo {
 
     /* Player status flags */
     bool hasMaxHealth;          /**< True if PLAYER_HAS_MAX_HEALTH is set */
+
+    /* Identity (numeric) */
+    s16 character;              /**< 0=Reinhardt, 1=Carrie (-1 if unavailable) */
+
+    /* Publication */
+    u32 generation;             /**< Frame publish counter (0 = never published) */
 } CV64_GameInfo;
 
 /**
@@ -484,11 +764,24 @@ CV64_API const char* CV64_Memory_GetCharacterName(void);
 
 /**
  * @brief Get full game info structure for window title display
+ *
+ * The emulation thread builds this once per frame in CV64_Memory_FrameUpdate
+ * and publishes it through a seqlock. Any thread may call this; it copies
+ * the latest complete frame without locking and without reading RDRAM.
+ *
  * @param info Output structure to fill
  * @return true if game is running and info is valid
  */
 CV64_API bool CV64_Memory_GetGameInfo(CV64_GameInfo* info);
 
+/**
+ * @brief Generation of the latest published CV64_GameInfo
+ *
+ * Cheap check for pollers: if it matches info.generation from the last
+ * CV64_Memory_GetGameInfo call, nothing new has been published.
+ */
+CV64_API u32 CV64_Memory_GetGameInfoGeneration(void);
+
 /*===========================================================================
  * Day/Night Cycle
  *===========================================================================*/
@@ -539,6 +832,10 @@ CV64_API bool CV64_Memory_IsMapTransition(void);
 
 /**
  * @brief Callback type for map change events
+ *
+ * Called on the emulation thread each time a stage is entered. oldMapId is
+ * the last stage played (title/select screens in between are skipped), or
+ * the title map for the first stage after boot.
  */
 typedef void (*CV64_MapChangeCallback)(s16 oldMapId, s16 newMapId);
 
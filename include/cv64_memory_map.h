@@ -312,6 +312,22 @@ extern "C" {
 #define CV64_ADDR_PLAYER_PARAMS         0x80342BB4  /* player_params (fixed BSS) */
 #define CV64_ADDR_HUD_PARAMETERS        0x80279B08  /* HUD_parameters (fixed BSS) */
 
+/*===========================================================================
+ * Object Header Layout (from the cv64 decomp's ObjectHeader)
+ * Every module and actor starts with this header, and objects form a tree
+ * through the next/child links rooted at GameStateMgr. These offsets come
+ * from the decomp struct layout; unlike the addresses above they have not
+ * been cross-checked against CASTLEVANIA.sym, so walkers must validate
+ * every pointer they follow.
+ *===========================================================================*/
+
+#define CV64_OBJ_OFFSET_ID              0x00    /* s16: object type ID */
+#define CV64_OBJ_OFFSET_FLAGS           0x02    /* s16: object flags */
+#define CV64_OBJ_OFFSET_PARENT          0x14    /* ObjectHeader* parent */
+#define CV64_OBJ_OFFSET_NEXT            0x18    /* ObjectHeader* next sibling */
+#define CV64_OBJ_OFFSET_CHILD           0x1C    /* ObjectHeader* first child */
+#define CV64_OBJ_OFFSET_MODEL           0x24    /* Model* (modelInfo) for actors */
+
 /*===========================================================================
  * Camera State Flags (verified from CASTLEVANIA.sym)
  * Used for accurate gameplay state detection and camera mode awareness
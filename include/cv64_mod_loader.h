@@ -85,7 +85,7 @@ typedef struct {
 
 // Texture replacement entry
 typedef struct {
-    uint32_t originalCRC;     // CRC32 of original N64 texture
+    uint32_t originalCRC;     // CRC32 of original N64 texture (CV64_Hash_CRC32)
     char replacementPath[CV64_MOD_MAX_PATH];
     uint32_t width;
     uint32_t height;
@@ -160,7 +160,7 @@ void CV64_ModLoader_ReloadMods(void);
 
 /**
  * @brief Check if a texture should be replaced
- * @param textureCRC CRC32 of the original texture
+ * @param textureCRC CRC32 of the original texture data (CV64_Hash_CRC32)
  * @param outReplacement Output replacement info if found
  * @return true if replacement exists
  */
@@ -43,6 +43,7 @@ typedef struct {
     bool enableTextureCaching;           ///< Cache textures to reduce uploads
     bool enableFramebufferOptimization;  ///< Optimize framebuffer operations
     bool enableDrawCallBatching;         ///< Batch draw calls to reduce overhead
+    bool enableDrawCallMerging;          ///< Merge adjacent compatible batched draws into one multi-draw
     uint32_t maxTextureSize;             ///< Max texture dimension (1024, 2048, 4096)
     float mipmapBias;                    ///< Mipmap LOD bias (-2.0 to 2.0)
     
@@ -84,9 +85,12 @@ typedef struct {
     
     // Rendering stats
     uint64_t textureUploads;             ///< Texture uploads per second
-    uint64_t drawCalls;                  ///< Draw calls per second
+    uint64_t drawCalls;                  ///< Draw calls issued (after merging)
+    uint64_t drawCallsSubmitted;         ///< Draw calls submitted to the batcher (before merging)
+    double drawSortTimeMs;               ///< Time spent sorting batched draws in the last frame
     uint64_t textureCacheHits;           ///< Texture cache hits
     uint64_t textureCacheMisses;         ///< Texture cache misses
+    uint64_t textureCacheEvictions;      ///< Textures evicted to stay within textureMemoryBudget
     size_t textureCacheSize;             ///< Number of cached textures
     double textureCacheMemoryMB;         ///< Texture cache memory in MB
     
@@ -181,7 +185,7 @@ CV64_VSyncMode CV64_Perf_GetVSyncMode(void);
  * @param width Texture width
  * @param height Texture height
  * @param format Texture format
- * @param crc Texture CRC for validation
+ * @param crc Texture content hash for validation (see CV64_Hash_Texture)
  * @param outTextureId Output OpenGL texture ID if cached
  * @return true if texture found in cache
  */
@@ -191,6 +195,9 @@ bool CV64_Perf_CacheTexture(uint32_t addr, uint32_t width, uint32_t height,
 /**
  * Add texture to cache
  * 
+ * Replaces any entry with the same address/size/format. When cached bytes
+ * exceed textureMemoryBudget the least recently used textures are deleted.
+ * 
  * @param addr Texture address in RDRAM
  * @param width Texture width
  * @param height Texture height
@@ -240,6 +247,21 @@ void CV64_Perf_BeginDrawCallBatching(void);
 void CV64_Perf_AddDrawCall(unsigned int mode, uint32_t vertexCount, uint32_t startIndex,
                            unsigned int texture, uint32_t state);
 
+/**
+ * Add a draw call to the batch with a depth hint
+ * 
+ * Draws sharing texture, state and mode are ordered front to back by depth.
+ * 
+ * @param mode OpenGL primitive mode (GL_TRIANGLES, etc.)
+ * @param vertexCount Number of vertices
+ * @param startIndex Starting vertex index
+ * @param texture OpenGL texture ID
+ * @param state Render state hash
+ * @param depth Normalized view depth (0.0 = near, 1.0 = far)
+ */
+void CV64_Perf_AddDrawCallEx(unsigned int mode, uint32_t vertexCount, uint32_t startIndex,
+                             unsigned int texture, uint32_t state, float depth);
+
 /**
  * Flush all batched draw calls
  * Call this at the end of frame rendering
@@ -51,6 +51,9 @@ typedef struct {
     uint64_t dlCacheMisses;            ///< Display list cache misses
     double dlCacheHitRate;             ///< Cache hit rate percentage
     size_t dlCacheSize;                ///< Number of cached display lists
+    uint64_t dlCacheEvictions;         ///< Display lists evicted (size limit or unused on recycle)
+    uint64_t dlCacheHeapAllocs;        ///< Heap allocations made by the DL cache (init/resize only)
+    uint64_t dlCacheHeapAllocsLastFrame; ///< DL cache heap allocations during the last frame (0 in steady state)
     uint32_t overdrawPixels;           ///< Pixels drawn multiple times
 } CV64_RDPStats;
 
@@ -157,6 +160,62 @@ bool CV64_RDP_ShouldCullTriangle(float x0, float y0, float z0,
                                   float x1, float y1, float z1,
                                   float x2, float y2, float z2);
 
+/**
+ * Cull a batch of triangles
+ * 
+ * Gives exactly the same answer as CV64_RDP_ShouldCullTriangle for every
+ * triangle, using AVX2/SSE/NEON where available.
+ * 
+ * @param xyzSoA Nine float arrays of count elements each, back to back:
+ *               x0, y0, z0, x1, y1, z1, x2, y2, z2
+ * @param count Number of triangles
+ * @param outMask Output bitmask, (count + 63) / 64 words; bit i set if
+ *                triangle i should be culled
+ * @return Number of triangles culled
+ */
+uint32_t CV64_RDP_CullTriangles(const float* xyzSoA, uint32_t count, uint64_t* outMask);
+
+/**
+ * Name of the batch culling kernel in use ("avx2", "sse", "neon", "scalar")
+ */
+const char* CV64_RDP_GetCullBackend(void);
+
+/**
+ * Batch culling benchmark result
+ */
+typedef struct {
+    double perCallMTrisPerSec;         ///< CV64_RDP_ShouldCullTriangle, one call per triangle
+    double scalarBatchMTrisPerSec;     ///< Scalar kernel over SoA input
+    double simdBatchMTrisPerSec;       ///< CV64_RDP_CullTriangles (dispatched kernel)
+    const char* backend;               ///< Kernel used for simdBatchMTrisPerSec
+} CV64_RDPCullBenchResult;
+
+/**
+ * Check every batch culling kernel against the scalar test
+ * 
+ * Random triangles (including NaN, infinities, signed zeros, slivers) with
+ * random culling switches and scissor boxes. Logs the first mismatch.
+ * 
+ * @param iterations Number of random batches
+ * @param seed RNG seed
+ * @return true if all kernels matched bit for bit
+ */
+bool CV64_RDP_RunCullFuzzer(uint32_t iterations, uint32_t seed);
+
+/**
+ * Measure culling throughput: per-call vs scalar batch vs SIMD batch
+ * 
+ * Runs with all culling tests enabled. Culling state and statistics are
+ * restored afterwards.
+ * 
+ * @param triangleCount Triangles per batch
+ * @param iterations Batches per measurement
+ * @param outResult Optional result output
+ * @return true on success
+ */
+bool CV64_RDP_RunCullBenchmark(uint32_t triangleCount, uint32_t iterations,
+                               CV64_RDPCullBenchResult* outResult);
+
 /*===========================================================================
  * Display List Caching
  *===========================================================================*/
@@ -183,6 +242,9 @@ bool CV64_RDP_GetCachedDisplayList(uint32_t address, uint32_t hash);
 /**
  * Cache display list
  * 
+ * Commands are copied into the current generation's arena. If the arena is
+ * full the list is not cached this frame.
+ * 
  * @param address Display list address
  * @param hash Display list hash
  * @param commands RDP commands
@@ -192,7 +254,10 @@ void CV64_RDP_CacheDisplayList(uint32_t address, uint32_t hash,
                                 const void* commands, uint32_t count);
 
 /**
- * Advance frame counter (for cache LRU)
+ * Advance frame counter and recycle the oldest display list arena
+ * 
+ * Cached lists used within the last 120 frames are carried forward; the
+ * rest are evicted.
  */
 void CV64_RDP_AdvanceFrame(void);
 
@@ -12,6 +12,7 @@
 #define CV64_ROM_LOADER_H
 
 #include "cv64_types.h"
+#include "cv64_mapped_file.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -90,6 +91,40 @@ typedef struct CV64_RomInfo {
     
 } CV64_RomInfo;
 
+/*===========================================================================
+ * ROM Image
+ *===========================================================================*/
+
+/**
+ * @brief A ROM file loaded in z64 byte order
+ *
+ * A z64 file that does not have to be modified is used straight from its
+ * file mapping: no heap copy is made. Otherwise the file is converted (or
+ * just copied) from the mapping into an owned buffer in one pass.
+ */
+typedef struct CV64_RomImage {
+    const u8* data;             /**< ROM bytes in z64 order */
+    u64 size;                   /**< ROM size in bytes */
+    u8* buffer;                 /**< Writable copy (== data), NULL when mapped */
+    int file_format;            /**< Format of the file (see CV64_Rom_DetectFormat) */
+    f64 load_ms;                /**< Time spent opening and converting */
+    CV64_MappedFile file;       /**< File mapping (internal) */
+} CV64_RomImage;
+
+/**
+ * @brief ROM load benchmark result
+ */
+typedef struct CV64_RomLoadBenchResult {
+    u64 size;                   /**< ROM size in bytes */
+    int file_format;            /**< Format of the file */
+    f64 read_ms;                /**< fread into a heap buffer + scalar conversion */
+    f64 image_ms;               /**< CV64_Rom_OpenImage */
+    f64 read_private_mb;        /**< Private memory held by the read path */
+    f64 image_private_mb;       /**< Private memory held by the image */
+    f64 scalar_swap_mbps;       /**< Scalar byte-order conversion throughput */
+    f64 swap_mbps;              /**< Dispatched conversion throughput */
+} CV64_RomLoadBenchResult;
+
 /*===========================================================================
  * Known CRC Values for Castlevania 64
  *===========================================================================*/
@@ -160,6 +195,25 @@ CV64_API const char* CV64_Rom_GetVersionName(CV64_RomVersion version);
  */
 CV64_API bool CV64_Rom_Byteswap(u8* data, u64 size);
 
+/**
+ * @brief Copy ROM data into z64 byte order
+ *
+ * Uses pshufb (AVX2/SSSE3) or vrev (NEON) kernels. dst may equal src for
+ * an in-place conversion but must not otherwise overlap it. A trailing
+ * partial word is copied unchanged.
+ *
+ * @param dst Output buffer of size bytes
+ * @param src ROM data
+ * @param size ROM size
+ * @param format Format of src from CV64_Rom_DetectFormat (unknown formats are copied as is)
+ */
+CV64_API void CV64_Rom_ConvertToZ64(u8* dst, const u8* src, u64 size, int format);
+
+/**
+ * @brief Name of the byte-order conversion kernel ("avx2", "ssse3", "neon", "scalar")
+ */
+CV64_API const char* CV64_Rom_GetSwapBackend(void);
+
 /**
  * @brief Detect ROM format (z64, n64, v64)
  * @param data First 4 bytes of ROM
@@ -167,6 +221,32 @@ CV64_API bool CV64_Rom_Byteswap(u8* data, u64 size);
  */
 CV64_API int CV64_Rom_DetectFormat(const u8* data);
 
+/**
+ * @brief Load a ROM file as a z64 image
+ *
+ * @param path Path to ROM file
+ * @param writable Always make an owned copy (e.g. to apply patches)
+ * @param image Output image; release with CV64_Rom_CloseImage
+ * @return true on success
+ */
+CV64_API bool CV64_Rom_OpenImage(const char* path, bool writable, CV64_RomImage* image);
+
+/**
+ * @brief Release a ROM image (safe on a zeroed image)
+ */
+CV64_API void CV64_Rom_CloseImage(CV64_RomImage* image);
+
+/**
+ * @brief Compare the old read-into-memory path with CV64_Rom_OpenImage
+ *
+ * Times both on the given file and measures the private memory each one
+ * holds once the ROM is ready, plus scalar vs SIMD conversion speed.
+ * Results are logged.
+ *
+ * @return true on success
+ */
+CV64_API bool CV64_Rom_RunLoadBenchmark(const char* path, CV64_RomLoadBenchResult* result);
+
 /**
  * @brief Find Castlevania 64 ROM in common locations
  * @param buffer Output path buffer
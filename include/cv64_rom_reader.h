@@ -2,6 +2,11 @@
  * @file cv64_rom_reader.h
  * @brief CV64 ROM Reader - Read and parse data from ROM file
  * 
+ * The ROM file is memory-mapped read-only with a random-access hint, so
+ * reads are memcpy from the page cache rather than seek + fread, and
+ * CV64_ROM_Map hands out views into the file without copying at all.
+ * Bytes are returned in file order (no byteswapping).
+ * 
  * @copyright 2024 CV64 Recomp Team
  */
 
@@ -18,6 +23,16 @@ extern "C" {
 // ROM file handle
 typedef struct CV64_ROMFile_t* CV64_ROMFile;
 
+/**
+ * @brief One read of a batched CV64_ROM_ReadV call
+ */
+typedef struct CV64_ROMReadRequest {
+    uint32_t offset;        // Offset in ROM
+    uint32_t size;          // Bytes to read
+    void* buffer;           // Output buffer, or NULL to only prefetch the range
+    uint32_t bytesRead;     // Set by CV64_ROM_ReadV (short at the end of the ROM)
+} CV64_ROMReadRequest;
+
 /**
  * @brief Open a ROM file for reading
  * @param romPath Path to the ROM file
@@ -41,6 +56,30 @@ void CV64_ROM_Close(CV64_ROMFile rom);
  */
 size_t CV64_ROM_Read(CV64_ROMFile rom, uint32_t offset, void* buffer, size_t size);
 
+/**
+ * @brief Get a read-only view of ROM data without copying
+ * @param rom ROM file handle
+ * @param offset Offset in ROM
+ * @param size Number of bytes the caller will access
+ * @return Pointer into the mapped ROM, or NULL if the range is not inside the ROM.
+ *         Valid until CV64_ROM_Close.
+ */
+const void* CV64_ROM_Map(CV64_ROMFile rom, uint32_t offset, size_t size);
+
+/**
+ * @brief Service many scattered reads in one call
+ *
+ * The requested ranges are sorted, merged where they are close together
+ * and prefetched as a batch before any data is copied, so the page faults
+ * of the whole batch overlap instead of being taken one read at a time.
+ *
+ * @param rom ROM file handle
+ * @param requests Reads to perform (any order; offsets may overlap)
+ * @param count Number of requests
+ * @return Total bytes copied into request buffers
+ */
+size_t CV64_ROM_ReadV(CV64_ROMFile rom, CV64_ROMReadRequest* requests, size_t count);
+
 /**
  * @brief Get ROM file size
  * @param rom ROM file handle
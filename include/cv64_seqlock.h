@@ -0,0 +1,97 @@
+/**
+ * @file cv64_seqlock.h
+ * @brief Castlevania 64 PC Recomp - Single-writer sequence lock
+ *
+ * Publishes a small trivially-copyable struct from one thread (the
+ * emulation thread) to any number of readers without a mutex. The writer
+ * never waits; a reader that overlaps a write simply retries its copy.
+ *
+ * The payload is stored as relaxed atomic words so concurrent copies are
+ * well-defined; the sequence counter is odd while a write is in progress
+ * and its value / 2 is the publish generation.
+ *
+ * Exactly one thread may call Store() at a time. Load() may be called from
+ * any thread.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_SEQLOCK_H
+#define CV64_SEQLOCK_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+template <typename T>
+class CV64_Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "CV64_Seqlock payload must be trivially copyable");
+
+public:
+    CV64_Seqlock() = default;
+
+    CV64_Seqlock(const CV64_Seqlock&) = delete;
+    CV64_Seqlock& operator=(const CV64_Seqlock&) = delete;
+
+    /**
+     * @brief Writer: publish a new value
+     */
+    void Store(const T& value) {
+        u64 words[kWords] = {};
+        memcpy(words, &value, sizeof(T));
+
+        const u32 seq = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; i++) {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }
+        m_sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reader: copy the latest complete value
+     * @param out Receives the value (untouched if nothing was published yet)
+     * @return Publish generation (0 = nothing published yet)
+     */
+    u32 Load(T& out) const {
+        u64 words[kWords];
+        u32 before, after;
+        do {
+            before = m_sequence.load(std::memory_order_acquire);
+            while (before & 1u) {
+                before = m_sequence.load(std::memory_order_acquire);
+            }
+            for (size_t i = 0; i < kWords; i++) {
+                words[i] = m_words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_sequence.load(std::memory_order_relaxed);
+        } while (before != after);
+
+        if (before == 0) return 0;
+        memcpy(&out, words, sizeof(T));
+        return before / 2;
+    }
+
+    /**
+     * @brief Generation of the last completed Store() (0 = none)
+     */
+    u32 Generation() const {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(u64) - 1) / sizeof(u64);
+
+    alignas(64) std::atomic<u32> m_sequence{0};
+    std::atomic<u64> m_words[kWords] = {};
+};
+
+#endif /* __cplusplus */
+
+#endif /* CV64_SEQLOCK_H */
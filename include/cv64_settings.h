@@ -131,7 +131,7 @@ struct CV64_ThreadingSettings {
     bool enableAsyncAudio;         // Async audio mixing
     bool enableWorkerThreads;      // Background worker pool
     int workerThreadCount;         // 0 = auto-detect
-    int graphicsQueueDepth;        // 1-3 (buffering)
+    int graphicsQueueDepth;        // Ignored: the frame mailbox always has 3 slots (kept for ini compatibility)
     bool enableParallelRSP;        // EXPERIMENTAL - usually false
     
     // Performance Overlay
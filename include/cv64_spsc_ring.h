@@ -0,0 +1,179 @@
+/**
+ * @file cv64_spsc_ring.h
+ * @brief Castlevania 64 PC Recomp - Lock-free single-producer/single-consumer ring
+ *
+ * Wait-free ring buffer used to hand audio samples from the emulation
+ * thread (producer) to the audio device callback (consumer). Neither side
+ * ever takes a lock, so a preempted producer can no longer stall the
+ * audio thread (and vice versa).
+ *
+ * The read and write positions live on separate cache lines, and each side
+ * keeps a private cached copy of the other side's position so the shared
+ * line is only touched when the cached value says the ring looks full/empty.
+ * Positions are free-running counters; capacity is a power of two.
+ *
+ * Exactly one thread may call Write() and exactly one thread may call
+ * Read() at a time. Init()/Reset()/Release() require both sides idle.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#ifndef CV64_SPSC_RING_H
+#define CV64_SPSC_RING_H
+
+#include "cv64_types.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+template <typename T>
+class CV64_SpscRing {
+public:
+    CV64_SpscRing() = default;
+    ~CV64_SpscRing() { Release(); }
+
+    CV64_SpscRing(const CV64_SpscRing&) = delete;
+    CV64_SpscRing& operator=(const CV64_SpscRing&) = delete;
+
+    /**
+     * @brief Allocate storage
+     * @param minCapacity Minimum element count (rounded up to a power of two)
+     * @return true on success
+     */
+    bool Init(size_t minCapacity) {
+        Release();
+        size_t capacity = 1;
+        while (capacity < minCapacity) capacity <<= 1;
+        m_buffer = static_cast<T*>(calloc(capacity, sizeof(T)));
+        if (!m_buffer) return false;
+        m_mask = capacity - 1;
+        Reset();
+        return true;
+    }
+
+    /**
+     * @brief Free storage
+     */
+    void Release() {
+        free(m_buffer);
+        m_buffer = nullptr;
+        m_mask = 0;
+    }
+
+    /**
+     * @brief Discard contents and clear counters
+     */
+    void Reset() {
+        m_writePos.store(0, std::memory_order_relaxed);
+        m_readPos.store(0, std::memory_order_relaxed);
+        m_cachedReadPos = 0;
+        m_cachedWritePos = 0;
+        m_underruns.store(0, std::memory_order_relaxed);
+        m_overruns.store(0, std::memory_order_relaxed);
+    }
+
+    bool IsValid() const { return m_buffer != nullptr; }
+    size_t Capacity() const { return m_buffer ? m_mask + 1 : 0; }
+
+    /**
+     * @brief Elements currently queued (approximate from a third thread)
+     */
+    size_t Size() const {
+        return m_writePos.load(std::memory_order_acquire) -
+               m_readPos.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Producer: append up to count elements
+     * @return Elements written. A short write is counted as an overrun.
+     */
+    size_t Write(const T* src, size_t count) {
+        if (!m_buffer || count == 0) return 0;
+
+        const size_t capacity = m_mask + 1;
+        const size_t writePos = m_writePos.load(std::memory_order_relaxed);
+        size_t space = capacity - (writePos - m_cachedReadPos);
+        if (space < count) {
+            m_cachedReadPos = m_readPos.load(std::memory_order_acquire);
+            space = capacity - (writePos - m_cachedReadPos);
+        }
+
+        size_t toWrite = count < space ? count : space;
+        if (toWrite < count) {
+            m_overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (toWrite == 0) return 0;
+
+        size_t start = writePos & m_mask;
+        size_t firstPart = capacity - start;
+        if (firstPart >= toWrite) {
+            memcpy(m_buffer + start, src, toWrite * sizeof(T));
+        } else {
+            memcpy(m_buffer + start, src, firstPart * sizeof(T));
+            memcpy(m_buffer, src + firstPart, (toWrite - firstPart) * sizeof(T));
+        }
+
+        m_writePos.store(writePos + toWrite, std::memory_order_release);
+        return toWrite;
+    }
+
+    /**
+     * @brief Consumer: remove up to count elements
+     * @return Elements read. A short read is counted as an underrun.
+     */
+    size_t Read(T* dst, size_t count) {
+        if (!m_buffer || count == 0) return 0;
+
+        const size_t capacity = m_mask + 1;
+        const size_t readPos = m_readPos.load(std::memory_order_relaxed);
+        size_t available = m_cachedWritePos - readPos;
+        if (available < count) {
+            m_cachedWritePos = m_writePos.load(std::memory_order_acquire);
+            available = m_cachedWritePos - readPos;
+        }
+
+        size_t toRead = count < available ? count : available;
+        if (toRead < count) {
+            m_underruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (toRead == 0) return 0;
+
+        size_t start = readPos & m_mask;
+        size_t firstPart = capacity - start;
+        if (firstPart >= toRead) {
+            memcpy(dst, m_buffer + start, toRead * sizeof(T));
+        } else {
+            memcpy(dst, m_buffer + start, firstPart * sizeof(T));
+            memcpy(dst + firstPart, m_buffer, (toRead - firstPart) * sizeof(T));
+        }
+
+        m_readPos.store(readPos + toRead, std::memory_order_release);
+        return toRead;
+    }
+
+    u64 Underruns() const { return m_underruns.load(std::memory_order_relaxed); }
+    u64 Overruns() const { return m_overruns.load(std::memory_order_relaxed); }
+
+private:
+    // Producer-owned line
+    alignas(64) std::atomic<size_t> m_writePos{0};
+    size_t m_cachedReadPos = 0;
+    std::atomic<u64> m_overruns{0};
+
+    // Consumer-owned line
+    alignas(64) std::atomic<size_t> m_readPos{0};
+    size_t m_cachedWritePos = 0;
+    std::atomic<u64> m_underruns{0};
+
+    // Shared, read-only after Init()
+    alignas(64) T* m_buffer = nullptr;
+    size_t m_mask = 0;
+};
+
+#endif /* __cplusplus */
+
+#endif /* CV64_SPSC_RING_H */
@@ -41,6 +41,14 @@ extern "C" {
  * Thread Manager Configuration
  *===========================================================================*/
 
+/**
+ * @brief How the presenter picks frames out of the triple-buffer mailbox
+ */
+typedef enum {
+    CV64_FRAME_POLICY_LATEST = 0,  ///< Present the newest frame, overwrite/drop older ones
+    CV64_FRAME_POLICY_FIFO         ///< Present every frame in order; producer is refused when full
+} CV64_FramePolicy;
+
 /**
  * @brief Threading configuration options
  */
@@ -49,8 +57,8 @@ typedef struct {
     bool enableAsyncAudio;         ///< Enable async audio mixing (SDL default)
     bool enableWorkerThreads;      ///< Enable worker thread pool
     int workerThreadCount;         ///< Number of worker threads (0 = auto)
-    int graphicsQueueDepth;        ///< Max queued frames (1-3, for triple buffering)
     bool enableParallelRSP;        ///< EXPERIMENTAL: Parallel RSP tasks
+    CV64_FramePolicy framePolicy;  ///< Frame mailbox policy (default LATEST)
 } CV64_ThreadConfig;
 
 /**
@@ -58,12 +66,19 @@ typedef struct {
  */
 typedef struct {
     u64 framesPresentedAsync;      ///< Frames presented asynchronously
-    u64 framesSyncWaits;           ///< Times we had to wait for GPU
-    u64 audioUnderruns;            ///< Audio buffer underruns
+    u64 framesSyncWaits;           ///< Times the producer found no free frame slot (FIFO)
+    u64 framesDropped;             ///< Frames overwritten before presentation (LATEST)
+    u64 audioUnderruns;            ///< Audio reads that found too few samples queued
+    u64 audioOverruns;             ///< Audio writes dropped because the ring was full
     u64 rspTasksQueued;            ///< RSP tasks queued
     u64 rspTasksCompleted;         ///< RSP tasks completed
     double avgPresentLatencyMs;    ///< Average presentation latency
     double avgRspTimeMs;           ///< Average RSP task time
+    u64 workerTasksQueued;         ///< Worker tasks accepted by the pool
+    u64 workerTasksCompleted;      ///< Worker tasks finished
+    u64 workerTasksStolen;         ///< Worker tasks taken from another worker's deque
+    u64 workerTasksRejected;       ///< Submits refused because the task pool was full
+    u64 workerTasksReclaimed;      ///< Tasks taken back and run by their waiter (WaitOrRunTask)
 } CV64_ThreadStats;
 
 /*===========================================================================
@@ -100,20 +115,77 @@ void CV64_Threading_ResetStats(void);
  */
 bool CV64_Threading_IsAsyncGraphicsEnabled(void);
 
+/**
+ * @brief Check if the async audio ring is active
+ * @return true if audio should go through CV64_Audio_QueueSamples
+ */
+bool CV64_Threading_IsAsyncAudioEnabled(void);
+
 /*===========================================================================
  * Graphics Thread API
  *===========================================================================*/
 
 /**
- * @brief Queue a frame for async presentation
- * This allows the CPU to continue while the GPU presents.
- * 
- * @param frameData Pointer to frame data (ownership transferred)
+ * @brief Number of slots in the frame mailbox (triple buffering)
+ */
+#define CV64_FRAME_SLOT_COUNT 3
+
+/**
+ * @brief Timestamps for one frame mailbox slot
+ *
+ * All times are steady-clock nanoseconds; 0 means "not yet".
+ */
+typedef struct {
+    u64 sequence;                  ///< Submit sequence of the frame in this slot
+    u64 acquireNs;                 ///< Producer started writing
+    u64 submitNs;                  ///< Producer published the frame
+    u64 presentNs;                 ///< Presenter picked it up
+    int width;                     ///< Frame width
+    int height;                    ///< Frame height
+} CV64_FrameSlotInfo;
+
+/**
+ * @brief Get a frame buffer to render/capture into
+ *
+ * Returns a preallocated RGBA8 slot (width * height * 4 bytes) owned by the
+ * caller until CV64_Graphics_SubmitFrame(). Slot memory is reused from frame
+ * to frame and only grows when the resolution increases. With the LATEST
+ * policy this always succeeds (the oldest unpresented frame is recycled);
+ * with FIFO it returns NULL while both other slots are still queued.
+ * Call from one producer thread only.
+ *
  * @param width Frame width
  * @param height Frame height
- * @return true if queued successfully, false if queue full
+ * @return Slot memory, or NULL
+ */
+void* CV64_Graphics_AcquireFrame(int width, int height);
+
+/**
+ * @brief Publish the frame obtained from CV64_Graphics_AcquireFrame()
+ * @return true if a frame was pending and has been published
  */
-bool CV64_Graphics_QueueFrame(void* frameData, int width, int height);
+bool CV64_Graphics_SubmitFrame(void);
+
+/**
+ * @brief Copy a frame into the mailbox for async presentation
+ *
+ * Convenience wrapper around AcquireFrame/SubmitFrame. The data is copied;
+ * the caller keeps ownership.
+ *
+ * @param frameData RGBA8 frame data (width * height * 4 bytes)
+ * @param width Frame width
+ * @param height Frame height
+ * @return true if queued, false if no slot was free (FIFO) or async is off
+ */
+bool CV64_Graphics_QueueFrame(const void* frameData, int width, int height);
+
+/**
+ * @brief Read the timestamps of a mailbox slot
+ * @param slot Slot index (0 .. CV64_FRAME_SLOT_COUNT-1)
+ * @param info Output
+ * @return false if slot is out of range
+ */
+bool CV64_Graphics_GetFrameSlotInfo(int slot, CV64_FrameSlotInfo* info);
 
 /**
  * @brief Signal that VI interrupt occurred (frame boundary)
@@ -122,7 +194,7 @@ bool CV64_Graphics_QueueFrame(void* frameData, int width, int height);
 void CV64_Graphics_OnVIInterrupt(void);
 
 /**
- * @brief Wait for GPU to finish presenting all queued frames
+ * @brief Wait for the presenter to finish with all submitted frames
  * Call this before modifying RDRAM that GPU might be reading.
  */
 void CV64_Graphics_WaitForPresent(void);
@@ -139,13 +211,29 @@ void CV64_Graphics_SetTargetFPS(int fps);
 
 /**
  * @brief Queue audio samples for async playback
+ *
+ * Producer side of a lock-free single-producer/single-consumer ring.
+ * Call only from the emulation thread.
+ *
  * @param samples Audio sample data (copied)
  * @param count Number of samples
  * @param frequency Sample rate
- * @return true if queued successfully
+ * @return true if every sample was queued (a partial write counts as an overrun)
  */
 bool CV64_Audio_QueueSamples(const s16* samples, size_t count, int frequency);
 
+/**
+ * @brief Pull queued audio samples
+ *
+ * Consumer side of the ring. Call only from the audio device callback.
+ * Never blocks; a short read counts as an underrun.
+ *
+ * @param out Destination buffer
+ * @param count Number of samples wanted
+ * @return Number of samples copied
+ */
+size_t CV64_Audio_DequeueSamples(s16* out, size_t count);
+
 /**
  * @brief Get current audio queue depth
  * @return Number of samples currently queued
@@ -158,6 +246,46 @@ size_t CV64_Audio_GetQueueDepth(void);
  */
 void CV64_Audio_OnDMAComplete(void);
 
+/**
+ * @brief Audio ring stress test parameters
+ *
+ * Producer and consumer run on their own threads, each moving a chunk of
+ * samples per interval. Pick different rates to force underruns/overruns.
+ */
+typedef struct {
+    u32 durationMs;                ///< Test length (0 = 2000)
+    u32 ringSamples;               ///< Ring capacity in samples (0 = 4096)
+    u32 producerChunk;             ///< Samples written per producer step
+    u32 producerIntervalUs;        ///< Producer step period (0 = free-running)
+    u32 consumerChunk;             ///< Samples read per consumer step
+    u32 consumerIntervalUs;        ///< Consumer step period (0 = free-running)
+} CV64_AudioRingStressConfig;
+
+/**
+ * @brief Audio ring stress test results
+ */
+typedef struct {
+    u64 samplesProduced;           ///< Samples accepted by the ring
+    u64 samplesConsumed;           ///< Samples read back
+    u64 underruns;                 ///< Short reads
+    u64 overruns;                  ///< Short writes
+    u64 sequenceErrors;            ///< Samples that came out of order or corrupted
+    bool passed;                   ///< No sequence errors and nothing lost in flight
+} CV64_AudioRingStressResult;
+
+/**
+ * @brief Run the SPSC audio ring under mismatched producer/consumer rates
+ *
+ * Uses a private ring, so it is safe to call while audio is playing.
+ * Results are also written to the debug log.
+ *
+ * @param config Test parameters (NULL for a default mismatched-rate run)
+ * @param result Output results
+ * @return true if the test ran
+ */
+bool CV64_Audio_RunRingStressTest(const CV64_AudioRingStressConfig* config,
+                                  CV64_AudioRingStressResult* result);
+
 /*===========================================================================
  * Worker Thread Pool API
  *===========================================================================*/
@@ -172,6 +300,21 @@ typedef void (*CV64_TaskCallback)(void* result, void* userdata);
  */
 typedef void* (*CV64_TaskFunc)(void* param);
 
+/**
+ * @brief Worker task priority
+ *
+ * HIGH tasks are picked up before anything else by the next idle worker.
+ * NORMAL tasks submitted from a worker stay on that worker's own deque
+ * (other workers may steal them). LOW tasks only run when no other work
+ * is available anywhere in the pool.
+ */
+typedef enum {
+    CV64_TASK_PRIORITY_HIGH = 0,   ///< Latency sensitive (e.g. texture decode for the next frame)
+    CV64_TASK_PRIORITY_NORMAL,     ///< Default
+    CV64_TASK_PRIORITY_LOW,        ///< Background work (config I/O, screenshot encode)
+    CV64_TASK_PRIORITY_COUNT
+} CV64_TaskPriority;
+
 /**
  * @brief Queue a task for async execution
  * @param func Task function to execute
@@ -183,19 +326,108 @@ typedef void* (*CV64_TaskFunc)(void* param);
 u32 CV64_Worker_QueueTask(CV64_TaskFunc func, void* param, 
                           CV64_TaskCallback callback, void* userdata);
 
+/**
+ * @brief Queue a task with an explicit priority
+ *
+ * Tasks come from a fixed pool; when every slot is in flight the submit
+ * is refused (returns 0) instead of allocating. Submits are also refused
+ * once CV64_Threading_Shutdown() has started.
+ *
+ * @param func Task function to execute
+ * @param param Parameter to pass to task
+ * @param callback Callback when complete (can be NULL)
+ * @param userdata User data for callback
+ * @param priority Scheduling priority
+ * @return Task ID (0 on failure)
+ */
+u32 CV64_Worker_QueueTaskEx(CV64_TaskFunc func, void* param,
+                            CV64_TaskCallback callback, void* userdata,
+                            CV64_TaskPriority priority);
+
 /**
  * @brief Wait for a specific task to complete
+ *
+ * Once shutdown has been requested a task that no worker has started is
+ * run on the calling thread, so the wait cannot outlive the pool.
+ *
  * @param taskId Task ID returned from QueueTask
  * @param timeoutMs Timeout in milliseconds (0 = infinite)
  * @return true if task completed, false on timeout
  */
 bool CV64_Worker_WaitTask(u32 taskId, u32 timeoutMs);
 
+/**
+ * @brief Wait for a task, running it here if no worker has picked it up
+ *
+ * Waits up to timeoutMs for the task to finish. If it has not started by
+ * then it is taken off the pool and run on the calling thread; if it is
+ * already running, waits for it. Either way the task has completed on
+ * return, so its parameter may be released. For latency-sensitive callers
+ * that must not stall behind a busy or stopping pool.
+ *
+ * @param taskId Task ID returned from QueueTask
+ * @param timeoutMs Time to give the pool (0 = take the task back at once)
+ * @return true once the task has completed, false for taskId 0
+ */
+bool CV64_Worker_WaitOrRunTask(u32 taskId, u32 timeoutMs);
+
 /**
  * @brief Wait for all queued tasks to complete
  */
 void CV64_Worker_WaitAll(void);
 
+/**
+ * @brief Run func once per parameter, fanned out, and wait for all of them
+ *
+ * params[1..count-1] go to the worker pool; anything the pool refuses
+ * (it is normally not running yet while the ROM loads at boot) gets a
+ * short-lived thread instead. params[0] always runs on the calling thread,
+ * and a queued task no worker has started within timeoutMs is taken back
+ * and run here too (see CV64_Worker_WaitOrRunTask).
+ *
+ * @param func Task function
+ * @param params One parameter per task
+ * @param count Number of tasks
+ * @param timeoutMs Time to give the pool per task (0 = take unstarted tasks back at once)
+ */
+void CV64_Worker_RunAll(CV64_TaskFunc func, void* const* params, u32 count, u32 timeoutMs);
+
+/**
+ * @brief Worker pool benchmark parameters
+ */
+typedef struct {
+    u32 taskCount;                 ///< Tasks submitted per run (0 = 100000)
+    u32 producerThreads;           ///< Threads submitting concurrently (0 = 1)
+    u32 workIterations;            ///< Busy-work loop iterations per task
+} CV64_WorkerBenchConfig;
+
+/**
+ * @brief Worker pool benchmark results
+ */
+typedef struct {
+    double stealingTasksPerSec;    ///< Throughput of the work-stealing pool
+    double stealingAvgLatencyUs;   ///< Mean submit-to-start latency
+    double stealingP99LatencyUs;   ///< 99th percentile submit-to-start latency
+    double legacyTasksPerSec;      ///< Throughput of the single-lock reference pool
+    double legacyAvgLatencyUs;     ///< Mean submit-to-start latency
+    double legacyP99LatencyUs;     ///< 99th percentile submit-to-start latency
+} CV64_WorkerBenchResult;
+
+/**
+ * @brief Compare the worker pool against the old single-mutex queue
+ *
+ * Runs the same burst of tasks through the live work-stealing pool and
+ * through a temporary mutex + std::queue pool with the same thread count.
+ * Results are also written to the debug log. The threading system must be
+ * initialized with worker threads enabled.
+ *
+ * @param config Benchmark parameters (NULL for defaults)
+ * @param result Output results
+ * @return true if both runs completed
+ */
+bool CV64_Worker_RunBenchmark(const CV64_WorkerBenchConfig* config,
+                              CV64_WorkerBenchResult* result);
+
 /*===========================================================================
  * RSP Threading (EXPERIMENTAL)
  *===========================================================================*/
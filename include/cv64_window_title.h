@@ -2,7 +2,8 @@
  * @file cv64_window_title.h
  * @brief CV64 Window Title Manager - Shows Player Name & Difficulty
  * 
- * Reads game state from memory and updates window title to show:
+ * Reads the game info published by the memory hook and updates the
+ * window title to show:
  * - Player character (Reinhardt or Carrie)
  * - Difficulty mode (Easy or Normal)
  * - Game title
@@ -61,8 +62,12 @@ extern "C" {
 
 /**
  * @brief Initialize window title manager
- * @param rdram Pointer to N64 RDRAM
- * @param rdram_size Size of RDRAM
+ *
+ * Character and difficulty are taken from CV64_Memory_GetGameInfo(), so the
+ * RDRAM arguments are no longer used and kept only for existing callers.
+ *
+ * @param rdram Pointer to N64 RDRAM (unused)
+ * @param rdram_size Size of RDRAM (unused)
  */
 void CV64_WindowTitle_Init(uint8_t* rdram, uint32_t rdram_size);
 
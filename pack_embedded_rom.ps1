@@ -0,0 +1,210 @@
+# pack_embedded_rom.ps1
+# Packs assets\baserom.z64 into the compressed image embedded by src\cv64_embedded_rom.rc
+#
+# The ROM is split into 256 KB frames, each compressed on its own as an LZ4
+# block so the game can decompress them in parallel at startup. Layout
+# (little-endian, see include\cv64_embedded_rom.h):
+#   header  "CV64ROMZ", u32 version, u32 frameSize, u64 romSize, u32 frameCount, u32 reserved
+#   table   frameCount x { u32 offset, u32 packedSize, u32 crc32 of the raw frame }
+#   frames  LZ4 block data; a frame that does not shrink is stored as is
+#
+# Runs as a pre-build step; does nothing when the packed image is newer than
+# both the ROM and this script.
+
+param(
+    [string]$RomPath = "$PSScriptRoot\assets\baserom.z64",
+    [string]$OutPath = "$PSScriptRoot\assets\baserom.z64.lz4",
+    [int]$FrameSize = 262144,
+    [switch]$Force
+)
+
+$ErrorActionPreference = "Stop"
+
+if (!(Test-Path $RomPath)) {
+    Write-Host "ROM not found: $RomPath" -ForegroundColor Red
+    Write-Host "Place the Castlevania 64 (USA) ROM at assets\baserom.z64 and build again." -ForegroundColor Yellow
+    exit 1
+}
+
+if (!$Force -and (Test-Path $OutPath)) {
+    $outTime = (Get-Item $OutPath).LastWriteTimeUtc
+    if ($outTime -gt (Get-Item $RomPath).LastWriteTimeUtc -and
+        $outTime -gt (Get-Item $PSCommandPath).LastWriteTimeUtc) {
+        Write-Host "Packed ROM is up to date: $OutPath" -ForegroundColor Green
+        exit 0
+    }
+}
+
+$packerCode = @'
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+public static class CV64RomPacker
+{
+    const int MinMatch = 4;
+    const int LastLiterals = 5;     // LZ4: the last 5 bytes are always literals
+    const int MatchFindLimit = 12;  // LZ4: no match starts in the last 12 bytes
+    const int MaxOffset = 65535;
+    const int HashBits = 16;
+
+    static uint[] crcTable;
+
+    public static uint Crc32(byte[] data, int offset, int length)
+    {
+        if (crcTable == null) {
+            crcTable = new uint[256];
+            for (uint i = 0; i < 256; i++) {
+                uint c = i;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) != 0 ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+                }
+                crcTable[i] = c;
+            }
+        }
+        uint crc = 0xFFFFFFFFu;
+        for (int i = offset; i < offset + length; i++) {
+            crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    static uint Read32(byte[] d, int i)
+    {
+        return (uint)(d[i] | (d[i + 1] << 8) | (d[i + 2] << 16) | (d[i + 3] << 24));
+    }
+
+    static void WriteLength(List<byte> dst, int length)
+    {
+        while (length >= 255) {
+            dst.Add(255);
+            length -= 255;
+        }
+        dst.Add((byte)length);
+    }
+
+    static void WriteSequence(List<byte> dst, byte[] src, int litStart, int litLength, int offset, int matchLength)
+    {
+        int matchCode = matchLength - MinMatch;
+        int token = (Math.Min(litLength, 15) << 4) | (matchLength > 0 ? Math.Min(matchCode, 15) : 0);
+        dst.Add((byte)token);
+        if (litLength >= 15) {
+            WriteLength(dst, litLength - 15);
+        }
+        for (int i = 0; i < litLength; i++) {
+            dst.Add(src[litStart + i]);
+        }
+        if (matchLength > 0) {
+            dst.Add((byte)offset);
+            dst.Add((byte)(offset >> 8));
+            if (matchCode >= 15) {
+                WriteLength(dst, matchCode - 15);
+            }
+        }
+    }
+
+    // Greedy LZ4 block compressor over src[start, start + length)
+    public static byte[] CompressBlock(byte[] src, int start, int length)
+    {
+        List<byte> dst = new List<byte>(length);
+        int end = start + length;
+        int anchor = start;
+
+        if (length > MatchFindLimit) {
+            int[] table = new int[1 << HashBits];
+            for (int i = 0; i < table.Length; i++) {
+                table[i] = -1;
+            }
+
+            int matchLimit = end - LastLiterals;
+            int findLimit = end - MatchFindLimit;
+            int ip = start;
+            while (ip < findLimit) {
+                uint seq = Read32(src, ip);
+                int h = (int)((seq * 2654435761u) >> (32 - HashBits));
+                int candidate = table[h];
+                table[h] = ip;
+
+                if (candidate < 0 || ip - candidate > MaxOffset || Read32(src, candidate) != seq) {
+                    ip++;
+                    continue;
+                }
+
+                while (ip > anchor && candidate > start && src[ip - 1] == src[candidate - 1]) {
+                    ip--;
+                    candidate--;
+                }
+
+                int matchLength = MinMatch;
+                while (ip + matchLength < matchLimit && src[candidate + matchLength] == src[ip + matchLength]) {
+                    matchLength++;
+                }
+
+                WriteSequence(dst, src, anchor, ip - anchor, ip - candidate, matchLength);
+                ip += matchLength;
+                anchor = ip;
+            }
+        }
+
+        WriteSequence(dst, src, anchor, end - anchor, 0, 0);
+        return dst.ToArray();
+    }
+
+    public static string Pack(string romPath, string outPath, int frameSize)
+    {
+        byte[] rom = File.ReadAllBytes(romPath);
+        int frameCount = (rom.Length + frameSize - 1) / frameSize;
+        byte[][] frames = new byte[frameCount][];
+        uint[] crcs = new uint[frameCount];
+
+        System.Threading.Tasks.Parallel.For(0, frameCount, i => {
+            int start = i * frameSize;
+            int length = Math.Min(frameSize, rom.Length - start);
+            byte[] packed = CompressBlock(rom, start, length);
+            if (packed.Length >= length) {
+                packed = new byte[length];
+                Buffer.BlockCopy(rom, start, packed, 0, length);
+            }
+            frames[i] = packed;
+            crcs[i] = Crc32(rom, start, length);
+        });
+
+        string tmpPath = outPath + ".tmp";
+        long total;
+        using (BinaryWriter w = new BinaryWriter(File.Create(tmpPath))) {
+            w.Write(System.Text.Encoding.ASCII.GetBytes("CV64ROMZ"));
+            w.Write((uint)1);
+            w.Write((uint)frameSize);
+            w.Write((ulong)rom.Length);
+            w.Write((uint)frameCount);
+            w.Write((uint)0);
+
+            uint offset = (uint)(32 + frameCount * 12);
+            for (int i = 0; i < frameCount; i++) {
+                w.Write(offset);
+                w.Write((uint)frames[i].Length);
+                w.Write(crcs[i]);
+                offset += (uint)frames[i].Length;
+            }
+            for (int i = 0; i < frameCount; i++) {
+                w.Write(frames[i]);
+            }
+            total = w.BaseStream.Length;
+        }
+
+        if (File.Exists(outPath)) {
+            File.Delete(outPath);
+        }
+        File.Move(tmpPath, outPath);
+
+        return String.Format("{0} bytes -> {1} bytes ({2:F1}%), {3} frames",
+                             rom.Length, total, total * 100.0 / rom.Length, frameCount);
+    }
+}
+'@
+
+Add-Type -TypeDefinition $packerCode -Language CSharp
+
+Write-Host "Packing embedded ROM..." -ForegroundColor Cyan
+$summary = [CV64RomPacker]::Pack((Resolve-Path $RomPath).Path, [IO.Path]::GetFullPath($OutPath), $FrameSize)
+Write-Host "Packed ROM: $summary" -ForegroundColor Green
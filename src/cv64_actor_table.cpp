@@ -0,0 +1,364 @@
+/**
+ * @file cv64_actor_table.cpp
+ * @brief Castlevania 64 PC Recomp - Live actor table implementation
+ *
+ * The walk is an explicit-stack depth-first traversal from GameStateMgr
+ * (child before next sibling, i.e. the game's own update order). Every
+ * pointer is checked to be a 4-byte aligned KSEG0 address inside the mapped
+ * RDRAM before it is followed, and an object already seen this frame ends
+ * that branch, so a corrupt or cyclic list cannot hang the walk.
+ *
+ * Handles are (generation << 16) | slot. The slot map is a fixed-capacity
+ * open-addressed table keyed by object address; an object keeps its slot
+ * while it is seen every frame with the same type ID. Slots not seen in a
+ * frame are released and their generation bumped.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "../include/cv64_actor_table.h"
+#include "../include/cv64_memory_hook.h"
+#include "../include/cv64_memory_map.h"
+#include <Windows.h>
+#include <atomic>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static void ActorLog(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    OutputDebugStringA("[CV64_ACTORS] ");
+    OutputDebugStringA(buffer);
+    OutputDebugStringA("\n");
+}
+
+/* Slots needed when a full frame of objects is replaced at once */
+#define ACTOR_SLOT_COUNT    (CV64_ACTOR_MAX * 2)
+/* Nodes visited (including rejected pointers) before giving up */
+#define ACTOR_VISIT_LIMIT   (CV64_ACTOR_MAX * 4)
+
+/* Open-addressed address -> slot map: Robin Hood probing, backward-shift deletion */
+#define ACTOR_MAP_SIZE      (ACTOR_SLOT_COUNT * 2)
+#define ACTOR_MAP_MASK      (ACTOR_MAP_SIZE - 1)
+static_assert((ACTOR_MAP_SIZE & ACTOR_MAP_MASK) == 0, "Slot map size must be a power of two");
+
+static inline bool IsObjectPtr(u32 ptr, u32 size, u32 rdramSize) {
+    if ((ptr & 0xFF800000u) != 0x80000000u) return false;
+    if (ptr & 3) return false;
+    return N64_ADDR_TO_OFFSET(ptr) + size <= rdramSize;
+}
+
+static inline u32 LoadU32(const u8* rdram, u32 addr) {
+    u32 v;
+    memcpy(&v, rdram + N64_ADDR_TO_OFFSET(addr), sizeof(v));
+    return v;
+}
+
+static inline u16 LoadU16(const u8* rdram, u32 addr) {
+    u16 v;
+    memcpy(&v, rdram + (N64_ADDR_TO_OFFSET(addr) ^ 2), sizeof(v));
+    return v;
+}
+
+static inline f32 LoadF32(const u8* rdram, u32 addr) {
+    f32 v;
+    memcpy(&v, rdram + N64_ADDR_TO_OFFSET(addr), sizeof(v));
+    return v;
+}
+
+/*===========================================================================
+ * State
+ *===========================================================================*/
+
+struct ActorSlot {
+    u32 addr;
+    u32 lastFrame;      /* Frame the object was last seen (0 = free) */
+    u16 generation;
+    u16 typeId;
+};
+
+struct SlotMapEntry {
+    u32 addr;
+    u16 slot;
+    u16 probe;          /* Distance from home bucket + 1, 0 = empty */
+};
+
+/* Triple buffer: readers borrow the front table, the walk fills the back
+ * one, and the previous front stays intact for one more VI. The published
+ * word packs (generation << 2) | front index; generation 0 = nothing yet. */
+static CV64_ActorTable s_tables[3];
+static std::atomic<u64> s_published{ 0 };
+static u32 s_back_index = 1;        /* Emulation thread only */
+static u32 s_prev_index = 2;        /* Emulation thread only */
+
+/* Emulation thread only */
+static ActorSlot s_slots[ACTOR_SLOT_COUNT];
+static u16 s_free_slots[ACTOR_SLOT_COUNT];
+static u32 s_free_count = 0;
+static SlotMapEntry s_slot_map[ACTOR_MAP_SIZE];
+static u32 s_walk_frame = 0;
+static bool s_slots_ready = false;
+static u8* s_last_rdram = nullptr;
+static u32 s_last_rdram_size = 0;
+
+static inline u32 SlotMapHome(u32 addr) {
+    /* Object addresses share their low bits; mix before masking */
+    u32 h = addr * 0x9E3779B1u;
+    return (h ^ (h >> 16)) & ACTOR_MAP_MASK;
+}
+
+/**
+ * @brief Find the slot of an object address
+ * @return Slot index, or ACTOR_SLOT_COUNT if the address is not tracked
+ */
+static u16 SlotMapFind(u32 addr) {
+    u32 i = SlotMapHome(addr);
+    for (u32 dist = 1;; i = (i + 1) & ACTOR_MAP_MASK, dist++) {
+        const SlotMapEntry& m = s_slot_map[i];
+        /* Robin Hood invariant: once we pass a richer bucket the key is absent */
+        if (m.probe < dist) return ACTOR_SLOT_COUNT;
+        if (m.addr == addr) return m.slot;
+    }
+}
+
+static void SlotMapInsert(u32 addr, u16 slot) {
+    SlotMapEntry entry = { addr, slot, 1 };
+    for (u32 i = SlotMapHome(addr);; i = (i + 1) & ACTOR_MAP_MASK, entry.probe++) {
+        SlotMapEntry& m = s_slot_map[i];
+        if (m.probe == 0) {
+            m = entry;
+            return;
+        }
+        if (m.probe < entry.probe) {
+            SlotMapEntry tmp = m;
+            m = entry;
+            entry = tmp;
+        }
+    }
+}
+
+static void SlotMapErase(u32 addr) {
+    u32 i = SlotMapHome(addr);
+    for (u32 dist = 1;; i = (i + 1) & ACTOR_MAP_MASK, dist++) {
+        if (s_slot_map[i].probe < dist) return;
+        if (s_slot_map[i].addr == addr) break;
+    }
+    u32 next = (i + 1) & ACTOR_MAP_MASK;
+    while (s_slot_map[next].probe > 1) {
+        s_slot_map[i] = s_slot_map[next];
+        s_slot_map[i].probe--;
+        i = next;
+        next = (next + 1) & ACTOR_MAP_MASK;
+    }
+    s_slot_map[i].probe = 0;
+}
+
+static void ResetSlots(void) {
+    memset(s_slot_map, 0, sizeof(s_slot_map));
+    for (u32 i = 0; i < ACTOR_SLOT_COUNT; i++) {
+        /* Keep generations so handles from before the reset stay dead */
+        s_slots[i].addr = 0;
+        s_slots[i].lastFrame = 0;
+        s_slots[i].typeId = 0;
+        if (s_slots[i].generation == 0) s_slots[i].generation = 1;
+        s_free_slots[i] = (u16)(ACTOR_SLOT_COUNT - 1 - i);
+    }
+    s_free_count = ACTOR_SLOT_COUNT;
+    s_slots_ready = true;
+}
+
+static inline u32 MakeHandle(u16 slot) {
+    return ((u32)s_slots[slot].generation << 16) | slot;
+}
+
+static void ReleaseSlot(u16 slot) {
+    ActorSlot& s = s_slots[slot];
+    SlotMapErase(s.addr);
+    s.addr = 0;
+    s.lastFrame = 0;
+    if (++s.generation == 0) s.generation = 1;
+    s_free_slots[s_free_count++] = slot;
+}
+
+/**
+ * @brief Get (or assign) the slot for an object seen this frame
+ * @return Slot index, or ACTOR_SLOT_COUNT if the object was already seen
+ */
+static u16 AcquireSlot(u32 addr, u16 typeId) {
+    u16 slot = SlotMapFind(addr);
+    if (slot != ACTOR_SLOT_COUNT) {
+        ActorSlot& s = s_slots[slot];
+        if (s.lastFrame == s_walk_frame) return ACTOR_SLOT_COUNT;
+        if (s.typeId == typeId) {
+            s.lastFrame = s_walk_frame;
+            return slot;
+        }
+        /* Same address, different object: new identity */
+        ReleaseSlot(slot);
+    }
+
+    if (s_free_count == 0) return ACTOR_SLOT_COUNT;
+    slot = s_free_slots[--s_free_count];
+    ActorSlot& s = s_slots[slot];
+    s.addr = addr;
+    s.typeId = typeId;
+    s.lastFrame = s_walk_frame;
+    SlotMapInsert(addr, slot);
+    return slot;
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+void CV64_Actors_Update(u8* rdram, u32 rdramSize) {
+    if (!rdram || rdramSize == 0) return;
+    if (!s_slots_ready || rdram != s_last_rdram || rdramSize != s_last_rdram_size) {
+        /* New mapping: every address may now be a different object */
+        ResetSlots();
+        s_last_rdram = rdram;
+        s_last_rdram_size = rdramSize;
+    }
+
+    CV64_ActorTable* t = &s_tables[s_back_index];
+
+    /* Frame 0 marks free slots, so never use it */
+    if (++s_walk_frame == 0) s_walk_frame = 1;
+
+    const CV64_RDRAMSnapshot* snap = CV64_Memory_GetSnapshot();
+    const u32 playerPtr = snap ? snap->playerPtr : 0;
+
+    u32 count = 0;
+    u32 modelCount = 0;
+    u32 playerIndex = CV64_ACTOR_NONE;
+    bool truncated = false;
+
+    u32 stack[64];
+    u32 depth = 0;
+    u32 visits = 0;
+    stack[depth++] = CV64_ADDR_GAME_STATE_MGR;
+
+    while (depth > 0) {
+        if (++visits > ACTOR_VISIT_LIMIT || count == CV64_ACTOR_MAX) {
+            truncated = true;
+            break;
+        }
+        const u32 obj = stack[--depth];
+        if (!IsObjectPtr(obj, CV64_OBJ_OFFSET_MODEL + 4, rdramSize)) continue;
+
+        const u16 typeId = LoadU16(rdram, obj + CV64_OBJ_OFFSET_ID);
+        const u16 slot = AcquireSlot(obj, typeId);
+        if (slot == ACTOR_SLOT_COUNT) continue;
+
+        const u32 i = count++;
+        t->handle[i] = MakeHandle(slot);
+        t->addr[i] = obj;
+        t->typeId[i] = typeId;
+        t->flags[i] = LoadU16(rdram, obj + CV64_OBJ_OFFSET_FLAGS);
+
+        u32 model = LoadU32(rdram, obj + CV64_OBJ_OFFSET_MODEL);
+        if (IsObjectPtr(model, CV64_MODEL_OFFSET_POS_Z + 4, rdramSize)) {
+            t->modelAddr[i] = model;
+            t->posX[i] = LoadF32(rdram, model + CV64_MODEL_OFFSET_POS_X);
+            t->posY[i] = LoadF32(rdram, model + CV64_MODEL_OFFSET_POS_Y);
+            t->posZ[i] = LoadF32(rdram, model + CV64_MODEL_OFFSET_POS_Z);
+            modelCount++;
+        } else {
+            t->modelAddr[i] = 0;
+            t->posX[i] = t->posY[i] = t->posZ[i] = 0.0f;
+        }
+        if (obj == playerPtr) playerIndex = i;
+
+        /* Push next first so the child subtree is visited before siblings */
+        if (depth + 2 > sizeof(stack) / sizeof(stack[0])) {
+            truncated = true;
+            continue;
+        }
+        stack[depth++] = LoadU32(rdram, obj + CV64_OBJ_OFFSET_NEXT);
+        stack[depth++] = LoadU32(rdram, obj + CV64_OBJ_OFFSET_CHILD);
+    }
+
+    /* Release objects that were not seen this frame */
+    for (u16 slot = 0; slot < ACTOR_SLOT_COUNT; slot++) {
+        const ActorSlot& s = s_slots[slot];
+        if (s.lastFrame != 0 && s.lastFrame != s_walk_frame) ReleaseSlot(slot);
+    }
+
+    /* Distance column in one pass over the position columns */
+    if (snap && CV64_SNAP_HAS(snap, CV64_SNAP_PLAYER_POS)) {
+        const f32 px = snap->playerPos[0];
+        const f32 py = snap->playerPos[1];
+        const f32 pz = snap->playerPos[2];
+        for (u32 i = 0; i < count; i++) {
+            const f32 dx = t->posX[i] - px;
+            const f32 dy = t->posY[i] - py;
+            const f32 dz = t->posZ[i] - pz;
+            const f32 d = sqrtf(dx * dx + dy * dy + dz * dz);
+            t->distToPlayer[i] = t->modelAddr[i] ? d : -1.0f;
+        }
+    } else {
+        for (u32 i = 0; i < count; i++) t->distToPlayer[i] = -1.0f;
+    }
+
+    static bool s_logged_truncated = false;
+    if (truncated && !s_logged_truncated) {
+        ActorLog("Object walk stopped early (%u objects, %u visits)", count, visits);
+        s_logged_truncated = true;
+    }
+
+    t->frame = snap ? snap->frame : 0;
+    t->count = count;
+    t->playerIndex = playerIndex;
+    t->modelCount = modelCount;
+    t->truncated = truncated;
+
+    const u64 word = s_published.load(std::memory_order_relaxed);
+    const u32 front = (u32)(word & 3);
+    const u32 gen = (u32)(word >> 2) + 1;
+    s_published.store(((u64)gen << 2) | s_back_index, std::memory_order_release);
+    /* The next walk overwrites the table published two VIs ago; keep its
+     * stores behind the publish so IsBorrowValid() sees the new generation */
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const u32 oldest = s_prev_index;
+    s_prev_index = front;
+    s_back_index = oldest;
+}
+
+const CV64_ActorTable* CV64_Actors_BorrowTable(u32* generation) {
+    const u64 word = s_published.load(std::memory_order_acquire);
+    const u32 gen = (u32)(word >> 2);
+    if (generation) *generation = gen;
+    return gen ? &s_tables[word & 3] : nullptr;
+}
+
+const CV64_ActorTable* CV64_Actors_GetTable(void) {
+    return CV64_Actors_BorrowTable(nullptr);
+}
+
+bool CV64_Actors_IsBorrowValid(u32 generation) {
+    if (generation == 0) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const u32 now = (u32)(s_published.load(std::memory_order_relaxed) >> 2);
+    return now - generation <= 1;
+}
+
+u32 CV64_Actors_FindHandle(const CV64_ActorTable* table, u32 handle) {
+    if (!table || handle == 0) return CV64_ACTOR_NONE;
+    for (u32 i = 0; i < table->count; i++) {
+        if (table->handle[i] == handle) return i;
+    }
+    return CV64_ACTOR_NONE;
+}
@@ -10,9 +10,19 @@
 
 #include "../include/cv64_anim_interp.h"
 #include "../include/cv64_patches.h"
+#include "../include/cv64_threading.h"
+#include "../include/cv64_cpu_features.h"
+#include "../include/cv64_memory_hook.h"
+#include "../include/cv64_memory_map.h"
 #include <string.h>
 #include <math.h>
+#include <stdio.h>
 #include <Windows.h>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
 
 /*===========================================================================
  * Constants
@@ -25,10 +35,72 @@
 
 /*===========================================================================
  * Static State
+ *
+ * Poses are stored structure-of-arrays: every component has its own
+ * [entity slot][bone] array, so one skeleton's bones are contiguous per
+ * component and the interpolation loops run with unit stride. Captured
+ * ticks ping-pong between two pose sets (a capture overwrites the older
+ * set instead of copying curr -> prev); the interpolated result goes to a
+ * third set. Entity IDs map to slots through a small open-addressed table.
  *===========================================================================*/
 
+struct PoseSet {
+    alignas(64) f32 pos_x[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) f32 pos_y[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) f32 pos_z[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) s16 rot_x[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) s16 rot_y[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) s16 rot_z[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) f32 scl_x[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) f32 scl_y[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+    alignas(64) f32 scl_z[CV64_ANIM_MAX_ENTITIES][CV64_ANIM_MAX_BONES];
+
+    Vec3f   root_position[CV64_ANIM_MAX_ENTITIES];
+    s16     root_rot_x[CV64_ANIM_MAX_ENTITIES];
+    s16     root_rot_y[CV64_ANIM_MAX_ENTITIES];
+    s16     root_rot_z[CV64_ANIM_MAX_ENTITIES];
+    u32     bone_count[CV64_ANIM_MAX_ENTITIES];
+};
+
+/** Per-slot bookkeeping (everything except the bones) */
+struct EntitySlot {
+    u32     entity_id;      /**< N64 actor/object pointer used as key */
+    u32     tick_captured;  /**< Game tick of last capture */
+    u32     rendered_serial;/**< Update that last wrote the rendered pose */
+    u32     pose_serial;    /**< rendered_serial the GetPose copy was built from */
+    u16     active_index;   /**< Position in s_active_slots */
+    u8      curr_set;       /**< Which of the tick sets holds the current tick */
+    u8      captures;       /**< Captures so far, saturates at 2 */
+};
+
+/** Open-addressed ID map: Robin Hood probing, backward-shift deletion */
+#define ANIM_ID_MAP_SIZE    (CV64_ANIM_MAX_ENTITIES * 2)
+#define ANIM_ID_MAP_MASK    (ANIM_ID_MAP_SIZE - 1)
+static_assert((ANIM_ID_MAP_SIZE & ANIM_ID_MAP_MASK) == 0, "ID map size must be a power of two");
+
+struct IdMapSlot {
+    u32     entity_id;
+    u16     slot;
+    u16     probe;          /**< Distance from home bucket + 1, 0 = empty */
+};
+
 static CV64_AnimInterpConfig    s_config;
-static CV64_AnimInterpEntity    s_entities[CV64_ANIM_MAX_ENTITIES];
+/** Everything an interpolation pass reads and writes */
+struct PoseStore {
+    PoseSet tick[2];        /**< Last two captured ticks, see EntitySlot::curr_set */
+    PoseSet rendered;       /**< Interpolated output */
+};
+
+static PoseStore                s_store;
+static EntitySlot               s_slots[CV64_ANIM_MAX_ENTITIES];
+static IdMapSlot                s_id_map[ANIM_ID_MAP_SIZE];
+static u16                      s_free_slots[CV64_ANIM_MAX_ENTITIES];
+static u32                      s_free_count = 0;
+static u16                      s_active_slots[CV64_ANIM_MAX_ENTITIES];
+static u32                      s_active_count = 0;
+static u16                      s_update_list[CV64_ANIM_MAX_ENTITIES];
+static CV64_SkeletonSnapshot    s_pose_out[CV64_ANIM_MAX_ENTITIES];
+static u32                      s_update_serial = 0;
 static u32                      s_current_tick = 0;
 static bool                     s_initialized = false;
 
@@ -75,37 +147,578 @@ static inline void lerp_vec3f(Vec3f* out, const Vec3f* a, const Vec3f* b, f32 t)
     out->z = lerp_f32(a->z, b->z, t);
 }
 
+/**
+ * @brief Lerp one component row (unit stride, vectorizable)
+ */
+static inline void lerp_row_f32(f32* __restrict out, const f32* __restrict a,
+                                const f32* __restrict b, u32 n, f32 t) {
+    for (u32 i = 0; i < n; i++) {
+        out[i] = a[i] + (b[i] - a[i]) * t;
+    }
+}
+
+/**
+ * @brief Shortest-arc lerp of one s16 angle row
+ */
+static inline void lerp_row_angle(s16* __restrict out, const s16* __restrict a,
+                                  const s16* __restrict b, u32 n, f32 t) {
+    for (u32 i = 0; i < n; i++) {
+        out[i] = lerp_angle_s16(a[i], b[i], t);
+    }
+}
+
 /*===========================================================================
  * Entity Slot Management
  *===========================================================================*/
 
+static inline u32 id_map_home(u32 entity_id) {
+    /* Actor pointers share their low bits; mix before masking */
+    u32 h = entity_id * 0x9E3779B1u;
+    return (h ^ (h >> 16)) & ANIM_ID_MAP_MASK;
+}
+
 /**
  * @brief Find an existing entity slot by ID
- * @return Slot pointer or NULL
+ * @return Slot index, or CV64_ANIM_MAX_ENTITIES if not tracked
  */
-static CV64_AnimInterpEntity* find_entity(u32 entity_id) {
-    for (u32 i = 0; i < CV64_ANIM_MAX_ENTITIES; i++) {
-        if (s_entities[i].active && s_entities[i].entity_id == entity_id) {
-            return &s_entities[i];
+static u32 find_entity(u32 entity_id) {
+    u32 i = id_map_home(entity_id);
+    for (u32 dist = 1;; i = (i + 1) & ANIM_ID_MAP_MASK, dist++) {
+        const IdMapSlot& m = s_id_map[i];
+        /* Robin Hood invariant: once we pass a richer bucket the key is absent */
+        if (m.probe < dist) return CV64_ANIM_MAX_ENTITIES;
+        if (m.entity_id == entity_id) return m.slot;
+    }
+}
+
+static void id_map_insert(u32 entity_id, u16 slot) {
+    IdMapSlot entry = { entity_id, slot, 1 };
+    for (u32 i = id_map_home(entity_id);; i = (i + 1) & ANIM_ID_MAP_MASK, entry.probe++) {
+        IdMapSlot& m = s_id_map[i];
+        if (m.probe == 0) {
+            m = entry;
+            return;
+        }
+        if (m.probe < entry.probe) {
+            IdMapSlot tmp = m;
+            m = entry;
+            entry = tmp;
         }
     }
-    return NULL;
+}
+
+static void id_map_erase(u32 entity_id) {
+    u32 i = id_map_home(entity_id);
+    for (u32 dist = 1;; i = (i + 1) & ANIM_ID_MAP_MASK, dist++) {
+        if (s_id_map[i].probe < dist) return;
+        if (s_id_map[i].entity_id == entity_id) break;
+    }
+    u32 next = (i + 1) & ANIM_ID_MAP_MASK;
+    while (s_id_map[next].probe > 1) {
+        s_id_map[i] = s_id_map[next];
+        s_id_map[i].probe--;
+        i = next;
+        next = (next + 1) & ANIM_ID_MAP_MASK;
+    }
+    s_id_map[i].probe = 0;
 }
 
 /**
- * @brief Allocate a new entity slot
- * @return Slot pointer or NULL if full
+ * @brief Drop every entity (O(1) per slot, pose data is left as garbage)
  */
-static CV64_AnimInterpEntity* alloc_entity(u32 entity_id) {
+static void reset_entities(void) {
+    memset(s_id_map, 0, sizeof(s_id_map));
+    memset(s_slots, 0, sizeof(s_slots));
     for (u32 i = 0; i < CV64_ANIM_MAX_ENTITIES; i++) {
-        if (!s_entities[i].active) {
-            memset(&s_entities[i], 0, sizeof(CV64_AnimInterpEntity));
-            s_entities[i].entity_id = entity_id;
-            s_entities[i].active = true;
-            return &s_entities[i];
+        s_free_slots[i] = (u16)(CV64_ANIM_MAX_ENTITIES - 1 - i);
+    }
+    s_free_count = CV64_ANIM_MAX_ENTITIES;
+    s_active_count = 0;
+}
+
+/**
+ * @brief Allocate a new entity slot
+ * @return Slot index, or CV64_ANIM_MAX_ENTITIES if full
+ */
+static u32 alloc_entity(u32 entity_id) {
+    if (s_free_count == 0) {
+        return CV64_ANIM_MAX_ENTITIES;
+    }
+    u16 slot = s_free_slots[--s_free_count];
+
+    EntitySlot& ent = s_slots[slot];
+    memset(&ent, 0, sizeof(ent));
+    ent.entity_id = entity_id;
+    ent.active_index = (u16)s_active_count;
+    s_active_slots[s_active_count++] = slot;
+    s_store.tick[0].bone_count[slot] = 0;
+    s_store.tick[1].bone_count[slot] = 0;
+
+    id_map_insert(entity_id, slot);
+    return slot;
+}
+
+static void free_entity(u32 slot) {
+    EntitySlot& ent = s_slots[slot];
+    id_map_erase(ent.entity_id);
+
+    /* Swap-remove from the dense active list */
+    u16 last = s_active_slots[--s_active_count];
+    s_active_slots[ent.active_index] = last;
+    s_slots[last].active_index = ent.active_index;
+
+    memset(&ent, 0, sizeof(ent));
+    s_free_slots[s_free_count++] = (u16)slot;
+}
+
+/*===========================================================================
+ * Quaternion Rotation Kernels
+ *
+ * Bone rotations are blended as quaternions instead of per Euler axis, so
+ * a bone turning about an arbitrary axis follows the shortest arc. Each
+ * lane converts prev/curr Euler angles to quaternions (X, then Y, then Z:
+ * q = qz * qy * qx), nlerps with Kapoulkine's slerp-correcting time warp
+ * (within ~1e-3 of true slerp, no acos/sin per bone) and converts back.
+ * The s16 angle range maps to half-angles in [-pi/2, pi/2), so sin/cos
+ * need no range reduction; both use Taylor polynomials good to ~1e-7,
+ * atan uses Abramowitz & Stegun 4.4.49 (2e-8). Measured against an exact
+ * slerp the output stays within ~1.3 s16 units, of which ~1.1 is the s16
+ * rounding itself.
+ *
+ * One template is instantiated per ISA through a small wrapper type; the
+ * scalar wrapper handles tails and the root rotation. Lanes whose three
+ * angles are unchanged pass through untouched.
+ *
+ * Off by default (interp_quaternion): the X-Y-Z order above has not been
+ * checked against the game's matrix code, and with the wrong order the
+ * blend is worse than the per-axis lerp.
+ *===========================================================================*/
+
+/** prev/curr/out angle rows for one skeleton (or one root) */
+struct RotRow {
+    const s16* px;
+    const s16* py;
+    const s16* pz;
+    const s16* cx;
+    const s16* cy;
+    const s16* cz;
+    s16* ox;
+    s16* oy;
+    s16* oz;
+};
+
+typedef void (*RotKernelFunc)(const RotRow& r, u32 begin, u32 end, f32 alpha);
+
+/** s16 angle units -> half-angle radians, and radians -> s16 units */
+#define ROT_UNITS_TO_HALF_RAD   (PI / S16_ANGLE_MAX)
+#define ROT_RAD_TO_UNITS        (S16_ANGLE_MAX * 0.5f / PI)
+
+struct RotVecScalar {
+    typedef f32 F;
+    typedef bool M;
+    enum { W = 1 };
+    static inline F load(const s16* p) { return (f32)*p; }
+    static inline void store(s16* p, F v) { *p = (s16)(s32)lrintf(v); }
+    static inline F set1(f32 v) { return v; }
+    static inline F add(F a, F b) { return a + b; }
+    static inline F sub(F a, F b) { return a - b; }
+    static inline F mul(F a, F b) { return a * b; }
+    static inline F div(F a, F b) { return a / b; }
+    static inline F sqrt(F a) { return sqrtf(a); }
+    static inline F abs(F a) { return fabsf(a); }
+    static inline F min(F a, F b) { return a < b ? a : b; }
+    static inline F max(F a, F b) { return a > b ? a : b; }
+    static inline M lt(F a, F b) { return a < b; }
+    static inline M eq(F a, F b) { return a == b; }
+    static inline M both(M a, M b) { return a && b; }
+    static inline F select(M m, F a, F b) { return m ? a : b; }
+    static inline u32 bits(M m) { return m ? 1u : 0u; }
+};
+
+#ifdef CV64_CPU_X64
+
+struct RotVecSSE {
+    typedef __m128 F;
+    typedef __m128 M;
+    enum { W = 4 };
+    static inline F load(const s16* p) {
+        __m128i v = _mm_loadl_epi64((const __m128i*)p);
+        return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+    }
+    static inline void store(s16* p, F v) {
+        /* Round, wrap to 16 bits (+32768 is -32768), then narrow */
+        __m128i i = _mm_cvtps_epi32(v);
+        i = _mm_srai_epi32(_mm_slli_epi32(i, 16), 16);
+        _mm_storel_epi64((__m128i*)p, _mm_packs_epi32(i, i));
+    }
+    static inline F set1(f32 v) { return _mm_set1_ps(v); }
+    static inline F add(F a, F b) { return _mm_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm_div_ps(a, b); }
+    static inline F sqrt(F a) { return _mm_sqrt_ps(a); }
+    static inline F abs(F a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static inline F min(F a, F b) { return _mm_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm_max_ps(a, b); }
+    static inline M lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+    static inline M eq(F a, F b) { return _mm_cmpeq_ps(a, b); }
+    static inline M both(M a, M b) { return _mm_and_ps(a, b); }
+    static inline F select(M m, F a, F b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static inline u32 bits(M m) { return (u32)_mm_movemask_ps(m); }
+};
+
+struct RotVecAVX2 {
+    typedef __m256 F;
+    typedef __m256 M;
+    enum { W = 8 };
+    CV64_CPU_TARGET("avx2") static inline F load(const s16* p) {
+        return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)p)));
+    }
+    CV64_CPU_TARGET("avx2") static inline void store(s16* p, F v) {
+        __m256i i = _mm256_cvtps_epi32(v);
+        i = _mm256_srai_epi32(_mm256_slli_epi32(i, 16), 16);
+        __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+        _mm_storeu_si128((__m128i*)p, packed);
+    }
+    CV64_CPU_TARGET("avx2") static inline F set1(f32 v) { return _mm256_set1_ps(v); }
+    CV64_CPU_TARGET("avx2") static inline F add(F a, F b) { return _mm256_add_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F div(F a, F b) { return _mm256_div_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F sqrt(F a) { return _mm256_sqrt_ps(a); }
+    CV64_CPU_TARGET("avx2") static inline F abs(F a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    CV64_CPU_TARGET("avx2") static inline F min(F a, F b) { return _mm256_min_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F max(F a, F b) { return _mm256_max_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline M lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    CV64_CPU_TARGET("avx2") static inline M eq(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    CV64_CPU_TARGET("avx2") static inline M both(M a, M b) { return _mm256_and_ps(a, b); }
+    CV64_CPU_TARGET("avx2") static inline F select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+    CV64_CPU_TARGET("avx2") static inline u32 bits(M m) { return (u32)_mm256_movemask_ps(m); }
+};
+
+#endif /* CV64_CPU_X64 */
+
+#ifdef CV64_CPU_ARM64
+
+struct RotVecNEON {
+    typedef float32x4_t F;
+    typedef uint32x4_t M;
+    enum { W = 4 };
+    static inline F load(const s16* p) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(p))); }
+    static inline void store(s16* p, F v) {
+        /* Round to nearest; vmovn keeps the low 16 bits, i.e. wraps */
+        vst1_s16(p, vmovn_s32(vcvtnq_s32_f32(v)));
+    }
+    static inline F set1(f32 v) { return vdupq_n_f32(v); }
+    static inline F add(F a, F b) { return vaddq_f32(a, b); }
+    static inline F sub(F a, F b) { return vsubq_f32(a, b); }
+    static inline F mul(F a, F b) { return vmulq_f32(a, b); }
+    static inline F div(F a, F b) { return vdivq_f32(a, b); }
+    static inline F sqrt(F a) { return vsqrtq_f32(a); }
+    static inline F abs(F a) { return vabsq_f32(a); }
+    static inline F min(F a, F b) { return vminq_f32(a, b); }
+    static inline F max(F a, F b) { return vmaxq_f32(a, b); }
+    static inline M lt(F a, F b) { return vcltq_f32(a, b); }
+    static inline M eq(F a, F b) { return vceqq_f32(a, b); }
+    static inline M both(M a, M b) { return vandq_u32(a, b); }
+    static inline F select(M m, F a, F b) { return vbslq_f32(m, a, b); }
+    static inline u32 bits(M m) {
+        const uint32_t laneBitsInit[4] = { 1, 2, 4, 8 };
+        return vaddvq_u32(vandq_u32(m, vld1q_u32(laneBitsInit)));
+    }
+};
+
+#endif /* CV64_CPU_ARM64 */
+
+/** sin/cos of a half-angle in [-pi/2, pi/2] */
+template <class V>
+static CV64_INLINE void RotSinCos(typename V::F h, typename V::F& s, typename V::F& c) {
+    typedef typename V::F F;
+    const F h2 = V::mul(h, h);
+    F ps = V::set1(-1.0f / 39916800.0f);
+    ps = V::add(V::mul(ps, h2), V::set1(1.0f / 362880.0f));
+    ps = V::add(V::mul(ps, h2), V::set1(-1.0f / 5040.0f));
+    ps = V::add(V::mul(ps, h2), V::set1(1.0f / 120.0f));
+    ps = V::add(V::mul(ps, h2), V::set1(-1.0f / 6.0f));
+    s = V::add(h, V::mul(V::mul(ps, h2), h));
+    F pc = V::set1(1.0f / 479001600.0f);
+    pc = V::add(V::mul(pc, h2), V::set1(-1.0f / 3628800.0f));
+    pc = V::add(V::mul(pc, h2), V::set1(1.0f / 40320.0f));
+    pc = V::add(V::mul(pc, h2), V::set1(-1.0f / 720.0f));
+    pc = V::add(V::mul(pc, h2), V::set1(1.0f / 24.0f));
+    pc = V::add(V::mul(pc, h2), V::set1(-0.5f));
+    c = V::add(V::set1(1.0f), V::mul(pc, h2));
+}
+
+/** atan2(y, x) in radians; atan2(0, 0) = 0 */
+template <class V>
+static CV64_INLINE typename V::F RotAtan2(typename V::F y, typename V::F x) {
+    typedef typename V::F F;
+    const F zero = V::set1(0.0f);
+    const F ax = V::abs(x);
+    const F ay = V::abs(y);
+    const F a = V::div(V::min(ax, ay), V::max(V::max(ax, ay), V::set1(1e-30f)));
+    const F a2 = V::mul(a, a);
+    F p = V::set1(-0.0040540580f);
+    p = V::add(V::mul(p, a2), V::set1(0.0218612288f));
+    p = V::add(V::mul(p, a2), V::set1(-0.0559098861f));
+    p = V::add(V::mul(p, a2), V::set1(0.0964200441f));
+    p = V::add(V::mul(p, a2), V::set1(-0.1390853351f));
+    p = V::add(V::mul(p, a2), V::set1(0.1994653599f));
+    p = V::add(V::mul(p, a2), V::set1(-0.3332985605f));
+    p = V::add(V::mul(p, a2), V::set1(0.9999993329f));
+    F r = V::mul(p, a);
+    r = V::select(V::lt(ax, ay), V::sub(V::set1(PI * 0.5f), r), r);
+    r = V::select(V::lt(x, zero), V::sub(V::set1(PI), r), r);
+    return V::select(V::lt(y, zero), V::sub(zero, r), r);
+}
+
+template <class V>
+static CV64_INLINE void RotEulerToQuat(typename V::F ex, typename V::F ey, typename V::F ez,
+                                       typename V::F q[4]) {
+    typedef typename V::F F;
+    const F k = V::set1(ROT_UNITS_TO_HALF_RAD);
+    F sx, cx, sy, cy, sz, cz;
+    RotSinCos<V>(V::mul(ex, k), sx, cx);
+    RotSinCos<V>(V::mul(ey, k), sy, cy);
+    RotSinCos<V>(V::mul(ez, k), sz, cz);
+    const F cycz = V::mul(cy, cz), sysz = V::mul(sy, sz);
+    const F sycz = V::mul(sy, cz), cysz = V::mul(cy, sz);
+    q[0] = V::add(V::mul(cx, cycz), V::mul(sx, sysz));     /* w */
+    q[1] = V::sub(V::mul(sx, cycz), V::mul(cx, sysz));     /* x */
+    q[2] = V::add(V::mul(cx, sycz), V::mul(sx, cysz));     /* y */
+    q[3] = V::sub(V::mul(cx, cysz), V::mul(sx, sycz));     /* z */
+}
+
+/**
+ * @brief Double-precision slerp for one bone whose result is near gimbal lock
+ *
+ * With the middle (Y) angle near +/-90 degrees the X and Z angles are
+ * ill-conditioned and single-precision error in the quaternion is
+ * amplified by 1/cos(Y), so those few lanes are redone here.
+ */
+static void RotBlendPrecise(const RotRow& r, u32 i, f32 alpha) {
+    const f64 k = 3.14159265358979323846 / 65536.0;
+    f64 qa[4], qb[4];
+    const s16 src[2][3] = { { r.px[i], r.py[i], r.pz[i] }, { r.cx[i], r.cy[i], r.cz[i] } };
+    for (int e = 0; e < 2; e++) {
+        const f64 sx = sin(src[e][0] * k), cx = cos(src[e][0] * k);
+        const f64 sy = sin(src[e][1] * k), cy = cos(src[e][1] * k);
+        const f64 sz = sin(src[e][2] * k), cz = cos(src[e][2] * k);
+        f64* q = e ? qb : qa;
+        q[0] = cx * cy * cz + sx * sy * sz;
+        q[1] = sx * cy * cz - cx * sy * sz;
+        q[2] = cx * sy * cz + sx * cy * sz;
+        q[3] = cx * cy * sz - sx * sy * cz;
+    }
+
+    f64 d = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+    f64 sign = 1.0;
+    if (d < 0.0) {
+        sign = -1.0;
+        d = -d;
+    }
+    f64 wa = 1.0 - alpha, wb = alpha;
+    if (d < 0.9999999) {
+        const f64 theta = acos(d);
+        wa = sin((1.0 - alpha) * theta) / sin(theta);
+        wb = sin(alpha * theta) / sin(theta);
+    }
+    f64 q[4], len = 0.0;
+    for (int c = 0; c < 4; c++) {
+        q[c] = qa[c] * wa + qb[c] * wb * sign;
+        len += q[c] * q[c];
+    }
+    len = sqrt(len);
+    const f64 w = q[0] / len, x = q[1] / len, y = q[2] / len, z = q[3] / len;
+
+    f64 sp = 2.0 * (w * y - z * x);
+    sp = sp > 1.0 ? 1.0 : (sp < -1.0 ? -1.0 : sp);
+    const f64 toUnits = 32768.0 / 3.14159265358979323846;
+    r.ox[i] = (s16)(s32)lrint(atan2(2.0 * (w * x + y * z), 1.0 - 2.0 * (x * x + y * y)) * toUnits);
+    r.oy[i] = (s16)(s32)lrint(asin(sp) * toUnits);
+    r.oz[i] = (s16)(s32)lrint(atan2(2.0 * (w * z + x * y), 1.0 - 2.0 * (y * y + z * z)) * toUnits);
+}
+
+/** |sin Y| above this goes through RotBlendPrecise (Y within ~2.6 deg of +/-90) */
+#define ROT_GIMBAL_SIN          0.999f
+
+/**
+ * @brief Blend rows [begin, end) W lanes at a time
+ * @return First index not processed (the tail is left to the caller)
+ */
+template <class V>
+static CV64_INLINE u32 RotBlend(const RotRow& r, u32 begin, u32 end, f32 alpha) {
+    typedef typename V::F F;
+    const F one = V::set1(1.0f);
+    const F two = V::set1(2.0f);
+    const F zero = V::set1(0.0f);
+    const F t = V::set1(alpha);
+    const F tw = V::set1(alpha * (alpha - 0.5f) * (alpha - 1.0f));
+    const F th2 = V::set1((alpha - 0.5f) * (alpha - 0.5f));
+    const F toUnits = V::set1(ROT_RAD_TO_UNITS);
+
+    u32 i = begin;
+    for (; i + V::W <= end; i += V::W) {
+        const F ax = V::load(r.px + i), ay = V::load(r.py + i), az = V::load(r.pz + i);
+        const F bx = V::load(r.cx + i), by = V::load(r.cy + i), bz = V::load(r.cz + i);
+
+        F qa[4], qb[4];
+        RotEulerToQuat<V>(ax, ay, az, qa);
+        RotEulerToQuat<V>(bx, by, bz, qb);
+
+        /* Shortest arc: flip curr into prev's hemisphere */
+        F d = V::add(V::add(V::mul(qa[0], qb[0]), V::mul(qa[1], qb[1])),
+                     V::add(V::mul(qa[2], qb[2]), V::mul(qa[3], qb[3])));
+        const typename V::M flip = V::lt(d, zero);
+        for (int k = 0; k < 4; k++) {
+            qb[k] = V::select(flip, V::sub(zero, qb[k]), qb[k]);
+        }
+        d = V::abs(d);
+
+        /* t' = t + t(t - 0.5)(t - 1) * k(d): nlerp that tracks slerp */
+        F A = V::add(V::mul(d, V::set1(-1.43519f)), V::set1(3.55645f));
+        A = V::add(V::mul(A, d), V::set1(-3.2452f));
+        A = V::add(V::mul(A, d), V::set1(1.0904f));
+        F B = V::add(V::mul(d, V::set1(0.215638f)), V::set1(-1.06021f));
+        B = V::add(V::mul(B, d), V::set1(0.848013f));
+        const F tt = V::add(t, V::mul(tw, V::add(V::mul(A, th2), B)));
+
+        F q[4];
+        for (int k = 0; k < 4; k++) {
+            q[k] = V::add(qa[k], V::mul(V::sub(qb[k], qa[k]), tt));
+        }
+        const F len = V::sqrt(V::add(V::add(V::mul(q[0], q[0]), V::mul(q[1], q[1])),
+                                     V::add(V::mul(q[2], q[2]), V::mul(q[3], q[3]))));
+        const F inv = V::div(one, len);
+        const F w = V::mul(q[0], inv), x = V::mul(q[1], inv);
+        const F y = V::mul(q[2], inv), z = V::mul(q[3], inv);
+
+        /* Back to X/Y/Z Euler for the same rotation order */
+        const F rx = RotAtan2<V>(V::mul(two, V::add(V::mul(w, x), V::mul(y, z))),
+                                 V::sub(one, V::mul(two, V::add(V::mul(x, x), V::mul(y, y)))));
+        F sp = V::mul(two, V::sub(V::mul(w, y), V::mul(z, x)));
+        sp = V::max(V::min(sp, one), V::set1(-1.0f));
+        const F ry = RotAtan2<V>(sp, V::sqrt(V::max(V::sub(one, V::mul(sp, sp)), zero)));
+        const F rz = RotAtan2<V>(V::mul(two, V::add(V::mul(w, z), V::mul(x, y))),
+                                 V::sub(one, V::mul(two, V::add(V::mul(y, y), V::mul(z, z)))));
+
+        const typename V::M same = V::both(V::both(V::eq(ax, bx), V::eq(ay, by)), V::eq(az, bz));
+        V::store(r.ox + i, V::select(same, bx, V::mul(rx, toUnits)));
+        V::store(r.oy + i, V::select(same, by, V::mul(ry, toUnits)));
+        V::store(r.oz + i, V::select(same, bz, V::mul(rz, toUnits)));
+
+        u32 gimbal = V::bits(V::lt(V::set1(ROT_GIMBAL_SIN), V::abs(sp)));
+        while (gimbal) {
+            const u32 lane = (u32)std::countr_zero(gimbal);
+            gimbal &= gimbal - 1;
+            if (!(V::bits(same) & (1u << lane))) {
+                RotBlendPrecise(r, i + lane, alpha);
+            }
         }
     }
-    return NULL;
+    return i;
+}
+
+static void RotKernelScalar(const RotRow& r, u32 begin, u32 end, f32 alpha) {
+    RotBlend<RotVecScalar>(r, begin, end, alpha);
+}
+
+#ifdef CV64_CPU_X64
+
+static void RotKernelSSE(const RotRow& r, u32 begin, u32 end, f32 alpha) {
+    u32 i = RotBlend<RotVecSSE>(r, begin, end, alpha);
+    RotBlend<RotVecScalar>(r, i, end, alpha);
+}
+
+CV64_CPU_TARGET("avx2")
+static void RotKernelAVX2(const RotRow& r, u32 begin, u32 end, f32 alpha) {
+    u32 i = RotBlend<RotVecAVX2>(r, begin, end, alpha);
+    i = RotBlend<RotVecSSE>(r, i, end, alpha);
+    RotBlend<RotVecScalar>(r, i, end, alpha);
+}
+
+#endif /* CV64_CPU_X64 */
+
+#ifdef CV64_CPU_ARM64
+
+static void RotKernelNEON(const RotRow& r, u32 begin, u32 end, f32 alpha) {
+    u32 i = RotBlend<RotVecNEON>(r, begin, end, alpha);
+    RotBlend<RotVecScalar>(r, i, end, alpha);
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+struct RotBackend {
+    RotKernelFunc kernel;
+    const char* name;
+};
+
+static RotBackend SelectRotBackend() {
+#ifdef CV64_CPU_X64
+    if (CV64_Cpu_HasAVX2()) return { RotKernelAVX2, "avx2" };
+    return { RotKernelSSE, "sse" };
+#elif defined(CV64_CPU_ARM64)
+    return { RotKernelNEON, "neon" };
+#else
+    return { RotKernelScalar, "scalar" };
+#endif
+}
+
+static const RotBackend& GetRotBackend() {
+    static const RotBackend backend = SelectRotBackend();
+    return backend;
+}
+
+/**
+ * @brief Blend n rotations; alpha 0/1 copy the source rows exactly
+ */
+static void interp_rotations(const RotRow& r, u32 n, f32 alpha, RotKernelFunc kernel) {
+    if (alpha <= 0.0f || alpha >= 1.0f) {
+        const bool useCurr = alpha >= 1.0f;
+        memcpy(r.ox, useCurr ? r.cx : r.px, n * sizeof(s16));
+        memcpy(r.oy, useCurr ? r.cy : r.py, n * sizeof(s16));
+        memcpy(r.oz, useCurr ? r.cz : r.pz, n * sizeof(s16));
+        return;
+    }
+    kernel(r, 0, n, alpha);
+}
+
+/**
+ * @brief Find or allocate the slot for a capture and flip its tick sets
+ * @return Slot index, or CV64_ANIM_MAX_ENTITIES if the table is full
+ */
+static u32 begin_capture(u32 entity_id) {
+    u32 slot = find_entity(entity_id);
+    if (slot == CV64_ANIM_MAX_ENTITIES) {
+        slot = alloc_entity(entity_id);
+        if (slot == CV64_ANIM_MAX_ENTITIES) {
+            return slot; /* Table full */
+        }
+    }
+
+    /* The older set becomes curr; the old curr is now prev */
+    s_slots[slot].curr_set ^= 1;
+    return slot;
+}
+
+static void end_capture(u32 slot) {
+    EntitySlot& ent = s_slots[slot];
+    /* Valid once we have at least 2 captures */
+    if (ent.captures < 2) {
+        ent.captures++;
+    }
+    ent.tick_captured = s_current_tick;
+}
+
+static void keep_previous_root(u32 slot) {
+    const u32 cs = s_slots[slot].curr_set;
+    const PoseSet* prev = &s_store.tick[cs ^ 1];
+    PoseSet* curr = &s_store.tick[cs];
+    curr->root_position[slot] = prev->root_position[slot];
+    curr->root_rot_x[slot] = prev->root_rot_x[slot];
+    curr->root_rot_y[slot] = prev->root_rot_y[slot];
+    curr->root_rot_z[slot] = prev->root_rot_z[slot];
 }
 
 /*===========================================================================
@@ -113,87 +726,380 @@ static CV64_AnimInterpEntity* alloc_entity(u32 entity_id) {
  *===========================================================================*/
 
 /**
- * @brief Interpolate a single bone transform
+ * @brief Copy one slot's pose from a tick set into the output set
+ */
+static void snap_skeleton(PoseSet* out, u32 slot, const PoseSet* curr) {
+    const u32 n = curr->bone_count[slot];
+
+    memcpy(out->pos_x[slot], curr->pos_x[slot], n * sizeof(f32));
+    memcpy(out->pos_y[slot], curr->pos_y[slot], n * sizeof(f32));
+    memcpy(out->pos_z[slot], curr->pos_z[slot], n * sizeof(f32));
+    memcpy(out->rot_x[slot], curr->rot_x[slot], n * sizeof(s16));
+    memcpy(out->rot_y[slot], curr->rot_y[slot], n * sizeof(s16));
+    memcpy(out->rot_z[slot], curr->rot_z[slot], n * sizeof(s16));
+    memcpy(out->scl_x[slot], curr->scl_x[slot], n * sizeof(f32));
+    memcpy(out->scl_y[slot], curr->scl_y[slot], n * sizeof(f32));
+    memcpy(out->scl_z[slot], curr->scl_z[slot], n * sizeof(f32));
+
+    out->root_position[slot] = curr->root_position[slot];
+    out->root_rot_x[slot] = curr->root_rot_x[slot];
+    out->root_rot_y[slot] = curr->root_rot_y[slot];
+    out->root_rot_z[slot] = curr->root_rot_z[slot];
+    out->bone_count[slot] = n;
+}
+
+/**
+ * @brief Interpolate one slot's skeleton into the output set
  */
-static void interp_bone(CV64_BoneTransform* out,
-                         const CV64_BoneTransform* prev,
-                         const CV64_BoneTransform* curr,
-                         f32 alpha,
-                         const CV64_AnimInterpConfig* cfg)
+static void interp_skeleton(PoseSet* out,
+                             u32 slot,
+                             const PoseSet* prev,
+                             const PoseSet* curr,
+                             f32 alpha,
+                             const CV64_AnimInterpConfig* cfg,
+                             RotKernelFunc rot_kernel)
 {
-    /* Position */
+    /* If prev has different bone count, don't interpolate — just snap */
+    if (prev->bone_count[slot] != curr->bone_count[slot]) {
+        snap_skeleton(out, slot, curr);
+        return;
+    }
+
+    const u32 n = curr->bone_count[slot];
+    out->bone_count[slot] = n;
+
+    /* Position (root + bones) */
     if (cfg->interp_position) {
-        lerp_vec3f(&out->position, &prev->position, &curr->position, alpha);
+        lerp_vec3f(&out->root_position[slot], &prev->root_position[slot],
+                   &curr->root_position[slot], alpha);
+        lerp_row_f32(out->pos_x[slot], prev->pos_x[slot], curr->pos_x[slot], n, alpha);
+        lerp_row_f32(out->pos_y[slot], prev->pos_y[slot], curr->pos_y[slot], n, alpha);
+        lerp_row_f32(out->pos_z[slot], prev->pos_z[slot], curr->pos_z[slot], n, alpha);
     } else {
-        out->position = curr->position;
+        out->root_position[slot] = curr->root_position[slot];
+        memcpy(out->pos_x[slot], curr->pos_x[slot], n * sizeof(f32));
+        memcpy(out->pos_y[slot], curr->pos_y[slot], n * sizeof(f32));
+        memcpy(out->pos_z[slot], curr->pos_z[slot], n * sizeof(f32));
     }
 
-    /* Rotation (shortest-arc s16 lerp) */
-    if (cfg->interp_rotation) {
-        out->rot_x = lerp_angle_s16(prev->rot_x, curr->rot_x, alpha);
-        out->rot_y = lerp_angle_s16(prev->rot_y, curr->rot_y, alpha);
-        out->rot_z = lerp_angle_s16(prev->rot_z, curr->rot_z, alpha);
+    /* Rotation */
+    if (cfg->interp_rotation && cfg->interp_quaternion) {
+        const RotRow root = {
+            &prev->root_rot_x[slot], &prev->root_rot_y[slot], &prev->root_rot_z[slot],
+            &curr->root_rot_x[slot], &curr->root_rot_y[slot], &curr->root_rot_z[slot],
+            &out->root_rot_x[slot], &out->root_rot_y[slot], &out->root_rot_z[slot]
+        };
+        const RotRow bones = {
+            prev->rot_x[slot], prev->rot_y[slot], prev->rot_z[slot],
+            curr->rot_x[slot], curr->rot_y[slot], curr->rot_z[slot],
+            out->rot_x[slot], out->rot_y[slot], out->rot_z[slot]
+        };
+        interp_rotations(root, 1, alpha, RotKernelScalar);
+        interp_rotations(bones, n, alpha, rot_kernel);
+    } else if (cfg->interp_rotation) {
+        /* Per-axis shortest-arc s16 lerp */
+        out->root_rot_x[slot] = lerp_angle_s16(prev->root_rot_x[slot], curr->root_rot_x[slot], alpha);
+        out->root_rot_y[slot] = lerp_angle_s16(prev->root_rot_y[slot], curr->root_rot_y[slot], alpha);
+        out->root_rot_z[slot] = lerp_angle_s16(prev->root_rot_z[slot], curr->root_rot_z[slot], alpha);
+        lerp_row_angle(out->rot_x[slot], prev->rot_x[slot], curr->rot_x[slot], n, alpha);
+        lerp_row_angle(out->rot_y[slot], prev->rot_y[slot], curr->rot_y[slot], n, alpha);
+        lerp_row_angle(out->rot_z[slot], prev->rot_z[slot], curr->rot_z[slot], n, alpha);
     } else {
-        out->rot_x = curr->rot_x;
-        out->rot_y = curr->rot_y;
-        out->rot_z = curr->rot_z;
+        out->root_rot_x[slot] = curr->root_rot_x[slot];
+        out->root_rot_y[slot] = curr->root_rot_y[slot];
+        out->root_rot_z[slot] = curr->root_rot_z[slot];
+        memcpy(out->rot_x[slot], curr->rot_x[slot], n * sizeof(s16));
+        memcpy(out->rot_y[slot], curr->rot_y[slot], n * sizeof(s16));
+        memcpy(out->rot_z[slot], curr->rot_z[slot], n * sizeof(s16));
     }
 
     /* Scale */
     if (cfg->interp_scale) {
-        lerp_vec3f(&out->scale, &prev->scale, &curr->scale, alpha);
+        lerp_row_f32(out->scl_x[slot], prev->scl_x[slot], curr->scl_x[slot], n, alpha);
+        lerp_row_f32(out->scl_y[slot], prev->scl_y[slot], curr->scl_y[slot], n, alpha);
+        lerp_row_f32(out->scl_z[slot], prev->scl_z[slot], curr->scl_z[slot], n, alpha);
     } else {
-        out->scale = curr->scale;
+        memcpy(out->scl_x[slot], curr->scl_x[slot], n * sizeof(f32));
+        memcpy(out->scl_y[slot], curr->scl_y[slot], n * sizeof(f32));
+        memcpy(out->scl_z[slot], curr->scl_z[slot], n * sizeof(f32));
     }
-
-    out->pad = 0;
 }
 
 /**
- * @brief Interpolate an entire skeleton snapshot
+ * @brief Gather a slot's rendered pose into its AoS snapshot for GetPose
  */
-static void interp_skeleton(CV64_SkeletonSnapshot* out,
-                             const CV64_SkeletonSnapshot* prev,
-                             const CV64_SkeletonSnapshot* curr,
-                             f32 alpha,
-                             const CV64_AnimInterpConfig* cfg)
-{
-    /* Use bone count from current frame */
-    u32 bone_count = curr->bone_count;
-    if (bone_count > CV64_ANIM_MAX_BONES) {
-        bone_count = CV64_ANIM_MAX_BONES;
+static void build_pose_snapshot(u32 slot) {
+    const PoseSet* in = &s_store.rendered;
+    CV64_SkeletonSnapshot* out = &s_pose_out[slot];
+    const u32 n = in->bone_count[slot];
+
+    out->root_position = in->root_position[slot];
+    out->root_rot_x = in->root_rot_x[slot];
+    out->root_rot_y = in->root_rot_y[slot];
+    out->root_rot_z = in->root_rot_z[slot];
+    out->pad = 0;
+    out->bone_count = n;
+
+    for (u32 i = 0; i < n; i++) {
+        CV64_BoneTransform* b = &out->bones[i];
+        b->position.x = in->pos_x[slot][i];
+        b->position.y = in->pos_y[slot][i];
+        b->position.z = in->pos_z[slot][i];
+        b->rot_x = in->rot_x[slot][i];
+        b->rot_y = in->rot_y[slot][i];
+        b->rot_z = in->rot_z[slot][i];
+        b->pad = 0;
+        b->scale.x = in->scl_x[slot][i];
+        b->scale.y = in->scl_y[slot][i];
+        b->scale.z = in->scl_z[slot][i];
     }
+}
 
-    /* If prev has different bone count, don't interpolate — just snap */
-    if (prev->bone_count != curr->bone_count) {
-        memcpy(out, curr, sizeof(CV64_SkeletonSnapshot));
-        return;
+/*===========================================================================
+ * Guest Bone Conversion
+ *
+ * mupen64plus keeps RDRAM as host-order 32-bit words, so the f32 fields of
+ * a guest bone record load as-is and each rotation word holds two s16
+ * halves (the lower address in the upper half). A bone record is eight
+ * words; the kernels load W records, transpose the 8 x W word block into
+ * component rows and split the two rotation words with shifts and a
+ * saturating pack, writing straight into one slot's SoA rows.
+ *===========================================================================*/
+
+typedef void (*GuestBoneKernelFunc)(const u8* src, u32 begin, u32 end, PoseSet* out, u32 slot);
+
+static void GuestBoneKernelScalar(const u8* src, u32 begin, u32 end, PoseSet* out, u32 slot) {
+    for (u32 i = begin; i < end; i++) {
+        u32 w[8];
+        memcpy(w, src + (size_t)i * CV64_ANIM_GUEST_BONE_SIZE, sizeof(w));
+        memcpy(&out->pos_x[slot][i], &w[0], sizeof(f32));
+        memcpy(&out->pos_y[slot][i], &w[1], sizeof(f32));
+        memcpy(&out->pos_z[slot][i], &w[2], sizeof(f32));
+        out->rot_x[slot][i] = (s16)(w[3] >> 16);
+        out->rot_y[slot][i] = (s16)(w[3] & 0xFFFF);
+        out->rot_z[slot][i] = (s16)(w[4] >> 16);
+        memcpy(&out->scl_x[slot][i], &w[5], sizeof(f32));
+        memcpy(&out->scl_y[slot][i], &w[6], sizeof(f32));
+        memcpy(&out->scl_z[slot][i], &w[7], sizeof(f32));
     }
+}
 
-    out->bone_count = bone_count;
+#ifdef CV64_CPU_X64
 
-    /* Root transform */
-    if (cfg->interp_position) {
-        lerp_vec3f(&out->root_position, &prev->root_position, &curr->root_position, alpha);
-    } else {
-        out->root_position = curr->root_position;
+static void GuestBoneKernelSSE(const u8* src, u32 begin, u32 end, PoseSet* out, u32 slot) {
+    u32 i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const u8* p = src + (size_t)i * CV64_ANIM_GUEST_BONE_SIZE;
+        __m128 a0 = _mm_loadu_ps((const f32*)(p + 0x00)), b0 = _mm_loadu_ps((const f32*)(p + 0x10));
+        __m128 a1 = _mm_loadu_ps((const f32*)(p + 0x20)), b1 = _mm_loadu_ps((const f32*)(p + 0x30));
+        __m128 a2 = _mm_loadu_ps((const f32*)(p + 0x40)), b2 = _mm_loadu_ps((const f32*)(p + 0x50));
+        __m128 a3 = _mm_loadu_ps((const f32*)(p + 0x60)), b3 = _mm_loadu_ps((const f32*)(p + 0x70));
+        /* a: pos_x, pos_y, pos_z, rot xy; b: rot z/pad, scl_x, scl_y, scl_z */
+        _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+        _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+        _mm_storeu_ps(&out->pos_x[slot][i], a0);
+        _mm_storeu_ps(&out->pos_y[slot][i], a1);
+        _mm_storeu_ps(&out->pos_z[slot][i], a2);
+        _mm_storeu_ps(&out->scl_x[slot][i], b1);
+        _mm_storeu_ps(&out->scl_y[slot][i], b2);
+        _mm_storeu_ps(&out->scl_z[slot][i], b3);
+
+        const __m128i rxy = _mm_castps_si128(a3);
+        const __m128i rzp = _mm_castps_si128(b0);
+        const __m128i xy = _mm_packs_epi32(_mm_srai_epi32(rxy, 16),
+                                           _mm_srai_epi32(_mm_slli_epi32(rxy, 16), 16));
+        const __m128i z = _mm_srai_epi32(rzp, 16);
+        _mm_storel_epi64((__m128i*)&out->rot_x[slot][i], xy);
+        _mm_storel_epi64((__m128i*)&out->rot_y[slot][i], _mm_srli_si128(xy, 8));
+        _mm_storel_epi64((__m128i*)&out->rot_z[slot][i], _mm_packs_epi32(z, z));
     }
+    GuestBoneKernelScalar(src, i, end, out, slot);
+}
 
-    if (cfg->interp_rotation) {
-        out->root_rot_x = lerp_angle_s16(prev->root_rot_x, curr->root_rot_x, alpha);
-        out->root_rot_y = lerp_angle_s16(prev->root_rot_y, curr->root_rot_y, alpha);
-        out->root_rot_z = lerp_angle_s16(prev->root_rot_z, curr->root_rot_z, alpha);
-    } else {
-        out->root_rot_x = curr->root_rot_x;
-        out->root_rot_y = curr->root_rot_y;
-        out->root_rot_z = curr->root_rot_z;
+CV64_CPU_TARGET("avx2")
+static void GuestBoneKernelAVX2(const u8* src, u32 begin, u32 end, PoseSet* out, u32 slot) {
+    u32 i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const u8* p = src + (size_t)i * CV64_ANIM_GUEST_BONE_SIZE;
+        __m256 r[8];
+        for (int b = 0; b < 8; b++) {
+            r[b] = _mm256_loadu_ps((const f32*)(p + b * CV64_ANIM_GUEST_BONE_SIZE));
+        }
+        /* 8x8 transpose: row b = bone b, column w = word w */
+        const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        const __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        const __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+        const __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+        const __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44), u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+        const __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44), u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        const __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44), u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+        const __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44), u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        const __m256 w0 = _mm256_permute2f128_ps(u0, u4, 0x20);
+        const __m256 w1 = _mm256_permute2f128_ps(u1, u5, 0x20);
+        const __m256 w2 = _mm256_permute2f128_ps(u2, u6, 0x20);
+        const __m256 w3 = _mm256_permute2f128_ps(u3, u7, 0x20);
+        const __m256 w4 = _mm256_permute2f128_ps(u0, u4, 0x31);
+        const __m256 w5 = _mm256_permute2f128_ps(u1, u5, 0x31);
+        const __m256 w6 = _mm256_permute2f128_ps(u2, u6, 0x31);
+        const __m256 w7 = _mm256_permute2f128_ps(u3, u7, 0x31);
+        _mm256_storeu_ps(&out->pos_x[slot][i], w0);
+        _mm256_storeu_ps(&out->pos_y[slot][i], w1);
+        _mm256_storeu_ps(&out->pos_z[slot][i], w2);
+        _mm256_storeu_ps(&out->scl_x[slot][i], w5);
+        _mm256_storeu_ps(&out->scl_y[slot][i], w6);
+        _mm256_storeu_ps(&out->scl_z[slot][i], w7);
+
+        /* packs works per 128-bit lane; the permute restores bone order */
+        const __m256i rxy = _mm256_castps_si256(w3);
+        const __m256i rzp = _mm256_castps_si256(w4);
+        const __m256i xy = _mm256_permute4x64_epi64(
+            _mm256_packs_epi32(_mm256_srai_epi32(rxy, 16),
+                               _mm256_srai_epi32(_mm256_slli_epi32(rxy, 16), 16)), 0xD8);
+        const __m256i z = _mm256_srai_epi32(rzp, 16);
+        const __m256i zz = _mm256_permute4x64_epi64(_mm256_packs_epi32(z, z), 0xD8);
+        _mm_storeu_si128((__m128i*)&out->rot_x[slot][i], _mm256_castsi256_si128(xy));
+        _mm_storeu_si128((__m128i*)&out->rot_y[slot][i], _mm256_extracti128_si256(xy, 1));
+        _mm_storeu_si128((__m128i*)&out->rot_z[slot][i], _mm256_castsi256_si128(zz));
     }
+    GuestBoneKernelSSE(src, i, end, out, slot);
+}
 
-    out->pad = 0;
+#endif /* CV64_CPU_X64 */
 
-    /* Per-bone interpolation */
-    for (u32 i = 0; i < bone_count; i++) {
-        interp_bone(&out->bones[i], &prev->bones[i], &curr->bones[i], alpha, cfg);
+#ifdef CV64_CPU_ARM64
+
+static inline void GuestTranspose4(uint32x4_t& r0, uint32x4_t& r1, uint32x4_t& r2, uint32x4_t& r3) {
+    const uint32x4_t t0 = vtrn1q_u32(r0, r1), t1 = vtrn2q_u32(r0, r1);
+    const uint32x4_t t2 = vtrn1q_u32(r2, r3), t3 = vtrn2q_u32(r2, r3);
+    r0 = vreinterpretq_u32_u64(vtrn1q_u64(vreinterpretq_u64_u32(t0), vreinterpretq_u64_u32(t2)));
+    r1 = vreinterpretq_u32_u64(vtrn1q_u64(vreinterpretq_u64_u32(t1), vreinterpretq_u64_u32(t3)));
+    r2 = vreinterpretq_u32_u64(vtrn2q_u64(vreinterpretq_u64_u32(t0), vreinterpretq_u64_u32(t2)));
+    r3 = vreinterpretq_u32_u64(vtrn2q_u64(vreinterpretq_u64_u32(t1), vreinterpretq_u64_u32(t3)));
+}
+
+static void GuestBoneKernelNEON(const u8* src, u32 begin, u32 end, PoseSet* out, u32 slot) {
+    u32 i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const u32* p = (const u32*)(src + (size_t)i * CV64_ANIM_GUEST_BONE_SIZE);
+        uint32x4_t a0 = vld1q_u32(p + 0), b0 = vld1q_u32(p + 4);
+        uint32x4_t a1 = vld1q_u32(p + 8), b1 = vld1q_u32(p + 12);
+        uint32x4_t a2 = vld1q_u32(p + 16), b2 = vld1q_u32(p + 20);
+        uint32x4_t a3 = vld1q_u32(p + 24), b3 = vld1q_u32(p + 28);
+        GuestTranspose4(a0, a1, a2, a3);
+        GuestTranspose4(b0, b1, b2, b3);
+        vst1q_f32(&out->pos_x[slot][i], vreinterpretq_f32_u32(a0));
+        vst1q_f32(&out->pos_y[slot][i], vreinterpretq_f32_u32(a1));
+        vst1q_f32(&out->pos_z[slot][i], vreinterpretq_f32_u32(a2));
+        vst1q_f32(&out->scl_x[slot][i], vreinterpretq_f32_u32(b1));
+        vst1q_f32(&out->scl_y[slot][i], vreinterpretq_f32_u32(b2));
+        vst1q_f32(&out->scl_z[slot][i], vreinterpretq_f32_u32(b3));
+
+        const int32x4_t rxy = vreinterpretq_s32_u32(a3);
+        vst1_s16(&out->rot_x[slot][i], vshrn_n_s32(rxy, 16));
+        vst1_s16(&out->rot_y[slot][i], vmovn_s32(rxy));
+        vst1_s16(&out->rot_z[slot][i], vshrn_n_s32(vreinterpretq_s32_u32(b0), 16));
+    }
+    GuestBoneKernelScalar(src, i, end, out, slot);
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+static GuestBoneKernelFunc GetGuestBoneKernel() {
+#ifdef CV64_CPU_X64
+    static const GuestBoneKernelFunc kernel =
+        CV64_Cpu_HasAVX2() ? GuestBoneKernelAVX2 : GuestBoneKernelSSE;
+    return kernel;
+#elif defined(CV64_CPU_ARM64)
+    return GuestBoneKernelNEON;
+#else
+    return GuestBoneKernelScalar;
+#endif
+}
+
+/*===========================================================================
+ * Update Jobs
+ *
+ * An Update pass is a list of slots to interpolate. Below
+ * ANIM_PARALLEL_MIN_ENTITIES it runs inline; above, the list is cut into
+ * ANIM_ENTITIES_PER_JOB chunks that go to the worker pool at high priority
+ * while the calling (render) thread takes the first chunk itself. Chunks
+ * touch disjoint slots, so they need no locking. A refused submit simply
+ * runs that chunk inline, and a chunk no worker has started within
+ * ANIM_JOB_WAIT_MS is taken back and run inline too, so a busy or stopping
+ * pool cannot stall the frame.
+ *===========================================================================*/
+
+#define ANIM_PARALLEL_MIN_ENTITIES  32
+#define ANIM_ENTITIES_PER_JOB       16
+#define ANIM_MAX_JOBS               ((CV64_ANIM_MAX_ENTITIES + ANIM_ENTITIES_PER_JOB - 1) / ANIM_ENTITIES_PER_JOB)
+#define ANIM_JOB_WAIT_MS            2
+
+struct InterpJob {
+    PoseStore*                      store;
+    const EntitySlot*               slots;
+    const u16*                      list;
+    u32                             begin;
+    u32                             end;
+    f32                             alpha;
+    const CV64_AnimInterpConfig*    cfg;
+    RotKernelFunc                   rot_kernel;
+};
+
+static void run_interp_job(const InterpJob* job) {
+    PoseStore* store = job->store;
+    for (u32 i = job->begin; i < job->end; i++) {
+        const u32 slot = job->list[i];
+        const u32 cs = job->slots[slot].curr_set;
+        interp_skeleton(&store->rendered, slot, &store->tick[cs ^ 1], &store->tick[cs],
+                        job->alpha, job->cfg, job->rot_kernel);
+    }
+}
+
+static void* interp_job_task(void* param) {
+    run_interp_job((const InterpJob*)param);
+    return NULL;
+}
+
+/**
+ * @brief Interpolate every slot in list[0, count)
+ * @param parallel Allow splitting across the worker pool
+ */
+static void run_interp_pass(PoseStore* store, const EntitySlot* slots, const u16* list,
+                            u32 count, f32 alpha, const CV64_AnimInterpConfig* cfg,
+                            RotKernelFunc rot_kernel, bool parallel) {
+    InterpJob jobs[ANIM_MAX_JOBS];
+    u32 job_count = 0;
+    for (u32 begin = 0; begin < count; begin += ANIM_ENTITIES_PER_JOB) {
+        InterpJob& job = jobs[job_count++];
+        job.store = store;
+        job.slots = slots;
+        job.list = list;
+        job.begin = begin;
+        job.end = (count - begin > ANIM_ENTITIES_PER_JOB) ? begin + ANIM_ENTITIES_PER_JOB : count;
+        job.alpha = alpha;
+        job.cfg = cfg;
+        job.rot_kernel = rot_kernel;
+    }
+
+    if (!parallel || count < ANIM_PARALLEL_MIN_ENTITIES) {
+        for (u32 j = 0; j < job_count; j++) {
+            run_interp_job(&jobs[j]);
+        }
+        return;
+    }
+
+    u32 task_ids[ANIM_MAX_JOBS] = {};
+    for (u32 j = 1; j < job_count; j++) {
+        task_ids[j] = CV64_Worker_QueueTaskEx(interp_job_task, &jobs[j], NULL, NULL,
+                                              CV64_TASK_PRIORITY_HIGH);
+    }
+    run_interp_job(&jobs[0]);
+    for (u32 j = 1; j < job_count; j++) {
+        if (task_ids[j] != 0) {
+            CV64_Worker_WaitOrRunTask(task_ids[j], ANIM_JOB_WAIT_MS);
+        } else {
+            run_interp_job(&jobs[j]);
+        }
     }
 }
 
@@ -206,8 +1112,9 @@ bool CV64_AnimInterp_Init(void) {
         return true;
     }
 
-    memset(s_entities, 0, sizeof(s_entities));
+    reset_entities();
     s_current_tick = 0;
+    s_update_serial = 0;
 
     /* Default configuration */
     s_config.enabled          = true;
@@ -216,10 +1123,14 @@ bool CV64_AnimInterp_Init(void) {
     s_config.interp_rotation  = true;
     s_config.interp_scale     = true;
     s_config.interp_camera    = true;
+    s_config.interp_quaternion = false;    /* Euler order not yet verified against the game */
     s_config.blend_sharpness  = 0.0f;
 
     s_initialized = true;
-    LogInfo("Animation interpolation system initialized");
+    char msg[96];
+    snprintf(msg, sizeof(msg), "Animation interpolation system initialized (rotation kernel: %s)",
+             GetRotBackend().name);
+    LogInfo(msg);
     return true;
 }
 
@@ -228,7 +1139,7 @@ void CV64_AnimInterp_Shutdown(void) {
         return;
     }
 
-    memset(s_entities, 0, sizeof(s_entities));
+    reset_entities();
     s_initialized = false;
     LogInfo("Animation interpolation system shut down");
 }
@@ -275,17 +1186,12 @@ void CV64_AnimInterp_Capture(
         return;
     }
 
-    /* Find or allocate slot */
-    CV64_AnimInterpEntity* ent = find_entity(entity_id);
-    if (!ent) {
-        ent = alloc_entity(entity_id);
-        if (!ent) {
-            return; /* Table full */
-        }
+    u32 slot = begin_capture(entity_id);
+    if (slot == CV64_ANIM_MAX_ENTITIES) {
+        return;
     }
-
-    /* Shift curr → prev */
-    memcpy(&ent->prev, &ent->curr, sizeof(CV64_SkeletonSnapshot));
+    const u32 cs = s_slots[slot].curr_set;
+    PoseSet* curr = &s_store.tick[cs];
 
     // Safety clamp (double‑defense)
     u32 safe_count = bone_count;
@@ -293,23 +1199,92 @@ void CV64_AnimInterp_Capture(
         safe_count = CV64_ANIM_MAX_BONES;
     }
 
-    ent->curr.bone_count = safe_count;
-    memcpy(ent->curr.bones, bones, safe_count * sizeof(CV64_BoneTransform));
+    /* Scatter the caller's AoS bones into the component rows */
+    curr->bone_count[slot] = safe_count;
+    for (u32 i = 0; i < safe_count; i++) {
+        const CV64_BoneTransform* b = &bones[i];
+        curr->pos_x[slot][i] = b->position.x;
+        curr->pos_y[slot][i] = b->position.y;
+        curr->pos_z[slot][i] = b->position.z;
+        curr->rot_x[slot][i] = b->rot_x;
+        curr->rot_y[slot][i] = b->rot_y;
+        curr->rot_z[slot][i] = b->rot_z;
+        curr->scl_x[slot][i] = b->scale.x;
+        curr->scl_y[slot][i] = b->scale.y;
+        curr->scl_z[slot][i] = b->scale.z;
+    }
+
+    /* A missing root position keeps the previous tick's value */
+    curr->root_position[slot] = root_pos ? *root_pos
+                                         : s_store.tick[cs ^ 1].root_position[slot];
+    curr->root_rot_x[slot] = root_rot_x;
+    curr->root_rot_y[slot] = root_rot_y;
+    curr->root_rot_z[slot] = root_rot_z;
 
+    end_capture(slot);
+}
 
-    if (root_pos) {
-        ent->curr.root_position = *root_pos;
+u32 CV64_AnimInterp_CaptureBatchFromRDRAM(const CV64_AnimRDRAMCapture* captures, u32 count) {
+    if (!s_initialized || !s_config.enabled || !captures) {
+        return 0;
     }
-    ent->curr.root_rot_x = root_rot_x;
-    ent->curr.root_rot_y = root_rot_y;
-    ent->curr.root_rot_z = root_rot_z;
-    ent->curr.pad = 0;
 
-    /* Mark valid once we have at least 2 captures */
-    if (ent->tick_captured > 0) {
-        ent->valid = true;
+    if (!CV64_Patches_IsEnabled(CV64_PATCH_FRAMERATE_UNLOCK)) {
+        return 0;
     }
-    ent->tick_captured = s_current_tick;
+
+    const u8* rdram = CV64_Memory_GetRDRAM();
+    const u32 rdram_size = CV64_Memory_GetRDRAMSize();
+    if (!rdram || rdram_size == 0) {
+        return 0;
+    }
+
+    const GuestBoneKernelFunc kernel = GetGuestBoneKernel();
+    u32 captured = 0;
+    for (u32 c = 0; c < count; c++) {
+        const CV64_AnimRDRAMCapture& cap = captures[c];
+        u32 n = cap.bone_count;
+        if (n == 0) {
+            continue;
+        }
+        if (n > CV64_ANIM_MAX_BONES) {
+            n = CV64_ANIM_MAX_BONES;
+        }
+        if ((cap.bone_array_addr & 3) != 0 ||
+            !N64_ADDR_IS_VALID(cap.bone_array_addr, n * CV64_ANIM_GUEST_BONE_SIZE, rdram_size)) {
+            continue;
+        }
+
+        const u32 slot = begin_capture(cap.entity_id);
+        if (slot == CV64_ANIM_MAX_ENTITIES) {
+            continue;
+        }
+        PoseSet* curr = &s_store.tick[s_slots[slot].curr_set];
+        kernel(rdram + N64_ADDR_TO_OFFSET(cap.bone_array_addr), 0, n, curr, slot);
+        curr->bone_count[slot] = n;
+
+        if (cap.has_root) {
+            curr->root_position[slot] = cap.root_position;
+            curr->root_rot_x[slot] = cap.root_rot_x;
+            curr->root_rot_y[slot] = cap.root_rot_y;
+            curr->root_rot_z[slot] = cap.root_rot_z;
+        } else {
+            keep_previous_root(slot);
+        }
+
+        end_capture(slot);
+        captured++;
+    }
+    return captured;
+}
+
+bool CV64_AnimInterp_CaptureFromRDRAM(u32 entity_id, u32 n64_bone_array_addr, u32 bone_count) {
+    CV64_AnimRDRAMCapture cap;
+    memset(&cap, 0, sizeof(cap));
+    cap.entity_id = entity_id;
+    cap.bone_array_addr = n64_bone_array_addr;
+    cap.bone_count = bone_count;
+    return CV64_AnimInterp_CaptureBatchFromRDRAM(&cap, 1) == 1;
 }
 
 void CV64_AnimInterp_Update(f32 alpha) {
@@ -336,21 +1311,27 @@ void CV64_AnimInterp_Update(f32 alpha) {
     if (alpha < 0.0f) alpha = 0.0f;
     if (alpha > 1.0f) alpha = 1.0f;
 
-    for (u32 i = 0; i < CV64_ANIM_MAX_ENTITIES; i++) {
-        // Ensure no stale or corrupted slot can be used
-        if (i >= CV64_ANIM_MAX_ENTITIES) break;
-        CV64_AnimInterpEntity* ent = &s_entities[i];
-        if (!ent->active || !ent->valid) {
+    if (++s_update_serial == 0) s_update_serial = 1;
+
+    u32 count = 0;
+    for (u32 i = 0; i < s_active_count; i++) {
+        const u32 slot = s_active_slots[i];
+        EntitySlot& ent = s_slots[slot];
+        if (ent.captures < 2) {
             continue;
         }
 
         /* Stale entity — hasn't been captured in a while, skip */
-        if (s_current_tick > ent->tick_captured + 2) {
+        if (s_current_tick > ent.tick_captured + 2) {
             continue;
         }
 
-        interp_skeleton(&ent->rendered, &ent->prev, &ent->curr, alpha, &s_config);
+        s_update_list[count++] = (u16)slot;
+        ent.rendered_serial = s_update_serial;
     }
+
+    run_interp_pass(&s_store, s_slots, s_update_list, count, alpha, &s_config,
+                    GetRotBackend().kernel, true);
 }
 
 const CV64_SkeletonSnapshot* CV64_AnimInterp_GetPose(u32 entity_id) {
@@ -358,12 +1339,21 @@ const CV64_SkeletonSnapshot* CV64_AnimInterp_GetPose(u32 entity_id) {
         return NULL;
     }
 
-    CV64_AnimInterpEntity* ent = find_entity(entity_id);
-    if (!ent || !ent->valid) {
+    u32 slot = find_entity(entity_id);
+    if (slot == CV64_ANIM_MAX_ENTITIES) {
+        return NULL;
+    }
+    EntitySlot& ent = s_slots[slot];
+    if (ent.captures < 2 || ent.rendered_serial == 0) {
         return NULL;
     }
 
-    return &ent->rendered;
+    /* Only entities actually drawn pay for the AoS gather, once per Update */
+    if (ent.pose_serial != ent.rendered_serial) {
+        build_pose_snapshot(slot);
+        ent.pose_serial = ent.rendered_serial;
+    }
+    return &s_pose_out[slot];
 }
 
 /*===========================================================================
@@ -371,23 +1361,177 @@ const CV64_SkeletonSnapshot* CV64_AnimInterp_GetPose(u32 entity_id) {
  *===========================================================================*/
 
 void CV64_AnimInterp_RemoveEntity(u32 entity_id) {
-    CV64_AnimInterpEntity* ent = find_entity(entity_id);
-    if (ent) {
-        memset(ent, 0, sizeof(CV64_AnimInterpEntity));
+    u32 slot = find_entity(entity_id);
+    if (slot != CV64_ANIM_MAX_ENTITIES) {
+        free_entity(slot);
     }
 }
 
 void CV64_AnimInterp_RemoveAll(void) {
-    memset(s_entities, 0, sizeof(s_entities));
+    reset_entities();
     LogInfo("All interpolation entities cleared (map transition)");
 }
 
 u32 CV64_AnimInterp_GetEntityCount(void) {
-    u32 count = 0;
-    for (u32 i = 0; i < CV64_ANIM_MAX_ENTITIES; i++) {
-        if (s_entities[i].active) {
-            count++;
+    return s_active_count;
+}
+
+/*===========================================================================
+ * Benchmark
+ *===========================================================================*/
+
+static void bench_euler_to_quat(s16 ex, s16 ey, s16 ez, f64 q[4]) {
+    const f64 k = 3.14159265358979323846 / 65536.0;
+    const f64 sx = sin(ex * k), cx = cos(ex * k);
+    const f64 sy = sin(ey * k), cy = cos(ey * k);
+    const f64 sz = sin(ez * k), cz = cos(ez * k);
+    q[0] = cx * cy * cz + sx * sy * sz;
+    q[1] = sx * cy * cz - cx * sy * sz;
+    q[2] = cx * sy * cz + sx * cy * sz;
+    q[3] = cx * cy * sz - sx * sy * cz;
+}
+
+/**
+ * @brief Angle between a blended rotation and the exact slerp, in s16 units
+ */
+static f64 bench_rotation_error(s16 px, s16 py, s16 pz, s16 cx, s16 cy, s16 cz,
+                                s16 ox, s16 oy, s16 oz, f64 alpha) {
+    f64 a[4], b[4], o[4];
+    bench_euler_to_quat(px, py, pz, a);
+    bench_euler_to_quat(cx, cy, cz, b);
+    bench_euler_to_quat(ox, oy, oz, o);
+
+    f64 d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    if (d < 0.0) {
+        for (int k = 0; k < 4; k++) b[k] = -b[k];
+        d = -d;
+    }
+    f64 wa = 1.0 - alpha, wb = alpha;
+    if (d < 0.9999999) {
+        const f64 theta = acos(d);
+        wa = sin((1.0 - alpha) * theta) / sin(theta);
+        wb = sin(alpha * theta) / sin(theta);
+    }
+    f64 ref[4], len = 0.0;
+    for (int k = 0; k < 4; k++) {
+        ref[k] = a[k] * wa + b[k] * wb;
+        len += ref[k] * ref[k];
+    }
+    len = sqrt(len);
+
+    f64 dot = 0.0;
+    for (int k = 0; k < 4; k++) dot += ref[k] / len * o[k];
+    dot = fabs(dot);
+    if (dot > 1.0) dot = 1.0;
+    return 2.0 * acos(dot) * (32768.0 / 3.14159265358979323846);
+}
+
+u32 CV64_AnimInterp_RunBenchmark(CV64_AnimInterpBenchResult* outResults, u32 maxResults,
+                                 u32 iterations) {
+    if (iterations == 0) {
+        iterations = 1000;
+    }
+
+    /* Private storage: every slot holds a full skeleton mid-animation */
+    std::unique_ptr<PoseStore> store(new PoseStore());
+    std::vector<EntitySlot> slots(CV64_ANIM_MAX_ENTITIES);
+    std::vector<u16> list(CV64_ANIM_MAX_ENTITIES);
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> angle(-32768, 32767);
+    std::uniform_int_distribution<int> delta(-2048, 2048);
+    std::uniform_real_distribution<f32> coord(-500.0f, 500.0f);
+
+    for (u32 slot = 0; slot < CV64_ANIM_MAX_ENTITIES; slot++) {
+        memset(&slots[slot], 0, sizeof(EntitySlot));
+        slots[slot].curr_set = 1;
+        list[slot] = (u16)slot;
+        PoseSet* prev = &store->tick[0];
+        PoseSet* curr = &store->tick[1];
+        prev->bone_count[slot] = curr->bone_count[slot] = CV64_ANIM_MAX_BONES;
+        prev->root_position[slot] = { coord(rng), coord(rng), coord(rng) };
+        curr->root_position[slot] = prev->root_position[slot];
+        for (u32 b = 0; b < CV64_ANIM_MAX_BONES; b++) {
+            prev->pos_x[slot][b] = coord(rng);
+            prev->pos_y[slot][b] = coord(rng);
+            prev->pos_z[slot][b] = coord(rng);
+            curr->pos_x[slot][b] = prev->pos_x[slot][b] + 1.0f;
+            curr->pos_y[slot][b] = prev->pos_y[slot][b];
+            curr->pos_z[slot][b] = prev->pos_z[slot][b] - 1.0f;
+            /* A typical per-tick turn, with some bones at rest */
+            prev->rot_x[slot][b] = (s16)angle(rng);
+            prev->rot_y[slot][b] = (s16)angle(rng);
+            prev->rot_z[slot][b] = (s16)angle(rng);
+            const bool moving = (b % 8) != 0;
+            curr->rot_x[slot][b] = (s16)(prev->rot_x[slot][b] + (moving ? delta(rng) : 0));
+            curr->rot_y[slot][b] = (s16)(prev->rot_y[slot][b] + (moving ? delta(rng) : 0));
+            curr->rot_z[slot][b] = (s16)(prev->rot_z[slot][b] + (moving ? delta(rng) : 0));
+            prev->scl_x[slot][b] = prev->scl_y[slot][b] = prev->scl_z[slot][b] = 1.0f;
+            curr->scl_x[slot][b] = curr->scl_y[slot][b] = curr->scl_z[slot][b] = 1.0f;
+        }
+    }
+
+    CV64_AnimInterpConfig cfg_euler = s_config;
+    cfg_euler.interp_position = cfg_euler.interp_rotation = cfg_euler.interp_scale = true;
+    cfg_euler.interp_quaternion = false;
+    CV64_AnimInterpConfig cfg_quat = cfg_euler;
+    cfg_quat.interp_quaternion = true;
+
+    const RotBackend& simd = GetRotBackend();
+    using Clock = std::chrono::steady_clock;
+    auto time_pass = [&](u32 count, const CV64_AnimInterpConfig* cfg,
+                         RotKernelFunc kernel, bool parallel) -> f64 {
+        auto start = Clock::now();
+        for (u32 it = 0; it < iterations; it++) {
+            /* Alpha sweeps (0, 1) like a 120 Hz render over 30 Hz ticks */
+            const f32 alpha = 0.125f + 0.25f * (f32)(it & 3);
+            run_interp_pass(store.get(), slots.data(), list.data(), count, alpha, cfg,
+                            kernel, parallel);
+        }
+        return std::chrono::duration<f64, std::micro>(Clock::now() - start).count() / iterations;
+    };
+
+    static const u32 kEntityCounts[] = { 16, 64, 128 };
+    u32 written = 0;
+    for (u32 c = 0; c < sizeof(kEntityCounts) / sizeof(kEntityCounts[0]); c++) {
+        CV64_AnimInterpBenchResult r;
+        r.entity_count = kEntityCounts[c];
+        r.bone_count = CV64_ANIM_MAX_BONES;
+        r.euler_us = time_pass(r.entity_count, &cfg_euler, simd.kernel, false);
+        r.quat_scalar_us = time_pass(r.entity_count, &cfg_quat, RotKernelScalar, false);
+        r.quat_simd_us = time_pass(r.entity_count, &cfg_quat, simd.kernel, false);
+        r.quat_parallel_us = time_pass(r.entity_count, &cfg_quat, simd.kernel, true);
+
+        /* Accuracy of the SIMD kernel on this data set */
+        const f32 alpha = 0.375f;
+        run_interp_pass(store.get(), slots.data(), list.data(), r.entity_count, alpha,
+                        &cfg_quat, simd.kernel, false);
+        f64 max_err = 0.0;
+        const PoseSet* prev = &store->tick[0];
+        const PoseSet* curr = &store->tick[1];
+        const PoseSet* out = &store->rendered;
+        for (u32 slot = 0; slot < r.entity_count; slot++) {
+            for (u32 b = 0; b < CV64_ANIM_MAX_BONES; b++) {
+                f64 err = bench_rotation_error(
+                    prev->rot_x[slot][b], prev->rot_y[slot][b], prev->rot_z[slot][b],
+                    curr->rot_x[slot][b], curr->rot_y[slot][b], curr->rot_z[slot][b],
+                    out->rot_x[slot][b], out->rot_y[slot][b], out->rot_z[slot][b], alpha);
+                if (err > max_err) max_err = err;
+            }
+        }
+        r.max_error_units = (f32)max_err;
+
+        char msg[256];
+        snprintf(msg, sizeof(msg),
+                 "Benchmark %3u entities x %u bones: euler %.1f us, quat scalar %.1f us, "
+                 "quat %s %.1f us, quat %s parallel %.1f us, max error %.2f units",
+                 r.entity_count, r.bone_count, r.euler_us, r.quat_scalar_us,
+                 simd.name, r.quat_simd_us, simd.name, r.quat_parallel_us, r.max_error_units);
+        LogInfo(msg);
+
+        if (outResults && c < maxResults) {
+            outResults[c] = r;
         }
+        written++;
     }
-    return count;
+    return written;
 }
@@ -0,0 +1,573 @@
+/**
+ * @file cv64_audio_mixer.cpp
+ * @brief Castlevania 64 PC Recomp - Sound effect voice pool implementation
+ *
+ * Voice life cycle (state word, one per voice):
+ *
+ *   FREE --(game thread CAS)--> CLAIMED --(fill, release store)--> PENDING
+ *   PENDING --(callback)--> PLAYING --(end of sound / stop)--> FREE
+ *
+ * Only the claiming thread touches a CLAIMED voice and only the callback
+ * touches a PLAYING voice's play position, so the hand-off needs no lock.
+ * Gains live in one 64-bit control word together with the voice handle;
+ * the game thread updates it with a CAS that fails once the voice belongs
+ * to a different handle. Stop requests are a separate word holding the
+ * handle to stop.
+ *
+ * Gains are Q15 (32768 = unity). Unity voices take a plain saturating-add
+ * kernel; everything else goes through a multiply-round-add kernel (SSE2 on
+ * x64, NEON on ARM64) whose rounding matches the scalar tail bit for bit.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "../include/cv64_audio_mixer.h"
+#include "../include/cv64_audio.h"
+#include "../include/cv64_cpu_features.h"
+#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static void MixerLog(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    OutputDebugStringA("[CV64_MIXER] ");
+    OutputDebugStringA(buffer);
+    OutputDebugStringA("\n");
+}
+
+#define MIXER_UNITY_Q15     32768u
+#define MIXER_PI            3.14159265358979f
+#define MIXER_SQRT2         1.41421356237310f
+
+static inline f32 Clamp(f32 v, f32 lo, f32 hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static inline u32 ToQ15(f32 gain) {
+    return (u32)lrintf(Clamp(gain, 0.0f, 1.0f) * (f32)MIXER_UNITY_Q15);
+}
+
+static inline s16 SatS16(s32 v) {
+    return (s16)(v < -32768 ? -32768 : (v > 32767 ? 32767 : v));
+}
+
+/*===========================================================================
+ * Mix Kernels
+ *
+ * count is in samples (interleaved L/R), gains in Q15 with the multiply
+ * path limited to 32767 so they fit a signed lane.
+ *===========================================================================*/
+
+static void AddKernelScalar(s16* out, const s16* src, u32 begin, u32 count) {
+    for (u32 i = begin; i < count; i++) {
+        out[i] = SatS16((s32)out[i] + src[i]);
+    }
+}
+
+template <bool ACCUM>
+static void MulKernelScalar(s16* out, const s16* src, u32 begin, u32 count, s16 gl, s16 gr) {
+    for (u32 i = begin; i < count; i++) {
+        const s32 g = (i & 1) ? gr : gl;
+        const s32 p = ((s32)src[i] * g + 0x4000) >> 15;
+        out[i] = ACCUM ? SatS16((s32)out[i] + p) : (s16)p;
+    }
+}
+
+#if defined(CV64_CPU_X64)
+
+static void AddKernel(s16* out, const s16* src, u32 count) {
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_adds_epi16(o, s));
+    }
+    AddKernelScalar(out, src, i, count);
+}
+
+template <bool ACCUM>
+static void MulKernel(s16* out, const s16* src, u32 count, s16 gl, s16 gr) {
+    const __m128i g = _mm_set_epi16(gr, gl, gr, gl, gr, gl, gr, gl);
+    const __m128i round = _mm_set1_epi32(0x4000);
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        /* Full 32-bit products from the low/high halves, then round,
+         * shift back to Q0 and narrow with saturation */
+        const __m128i lo = _mm_mullo_epi16(s, g);
+        const __m128i hi = _mm_mulhi_epi16(s, g);
+        const __m128i p0 = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), round), 15);
+        const __m128i p1 = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), round), 15);
+        __m128i p = _mm_packs_epi32(p0, p1);
+        if (ACCUM) p = _mm_adds_epi16(_mm_loadu_si128((const __m128i*)(out + i)), p);
+        _mm_storeu_si128((__m128i*)(out + i), p);
+    }
+    MulKernelScalar<ACCUM>(out, src, i, count, gl, gr);
+}
+
+#define MIXER_KERNEL_NAME "sse2"
+
+#elif defined(CV64_CPU_ARM64)
+
+static void AddKernel(s16* out, const s16* src, u32 count) {
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_s16(out + i, vqaddq_s16(vld1q_s16(out + i), vld1q_s16(src + i)));
+    }
+    AddKernelScalar(out, src, i, count);
+}
+
+template <bool ACCUM>
+static void MulKernel(s16* out, const s16* src, u32 count, s16 gl, s16 gr) {
+    const s16 gains[8] = { gl, gr, gl, gr, gl, gr, gl, gr };
+    const int16x8_t g = vld1q_s16(gains);
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        /* vqrdmulh is (2*s*g + 0x8000) >> 16, the same rounding as the
+         * scalar (s*g + 0x4000) >> 15 */
+        int16x8_t p = vqrdmulhq_s16(vld1q_s16(src + i), g);
+        if (ACCUM) p = vqaddq_s16(vld1q_s16(out + i), p);
+        vst1q_s16(out + i, p);
+    }
+    MulKernelScalar<ACCUM>(out, src, i, count, gl, gr);
+}
+
+#define MIXER_KERNEL_NAME "neon"
+
+#else
+
+static void AddKernel(s16* out, const s16* src, u32 count) {
+    AddKernelScalar(out, src, 0, count);
+}
+
+template <bool ACCUM>
+static void MulKernel(s16* out, const s16* src, u32 count, s16 gl, s16 gr) {
+    MulKernelScalar<ACCUM>(out, src, 0, count, gl, gr);
+}
+
+#define MIXER_KERNEL_NAME "scalar"
+
+#endif
+
+static void MixSamples(s16* out, const s16* src, u32 count, u32 gl, u32 gr) {
+    if (gl == MIXER_UNITY_Q15 && gr == MIXER_UNITY_Q15) {
+        AddKernel(out, src, count);
+    } else {
+        MulKernel<true>(out, src, count,
+                        (s16)(gl > 32767 ? 32767 : gl), (s16)(gr > 32767 ? 32767 : gr));
+    }
+}
+
+/*===========================================================================
+ * State
+ *===========================================================================*/
+
+struct MixerSound {
+    std::atomic<const s16*> frames;     /* Published after frameCount */
+    u32 frameCount;
+};
+
+enum : u32 {
+    VOICE_FREE = 0,
+    VOICE_CLAIMED,
+    VOICE_PENDING,
+    VOICE_PLAYING,
+};
+
+struct alignas(64) MixerVoice {
+    std::atomic<u32> state;
+    std::atomic<u32> stopHandle;
+    std::atomic<u64> control;           /* handle << 32 | gainL << 16 | gainR */
+
+    /* Written by the claiming thread before PENDING is published */
+    const s16* frames;
+    u32 frameCount;
+    bool loop;
+
+    /* Callback only */
+    u32 position;
+};
+
+/* Game-thread copy of what each voice was started with, used to recompute
+ * gains when the voice or the listener moves */
+struct VoiceParams {
+    u32 handle;
+    u32 generation;
+    f32 volume;
+    f32 pan;
+    bool is3d;
+    Vec3f position;
+};
+
+static MixerSound s_sounds[CV64_MIXER_MAX_SOUNDS];
+static MixerVoice s_voices[CV64_MIXER_MAX_VOICES];
+static VoiceParams s_params[CV64_MIXER_MAX_VOICES];
+static std::atomic<u32> s_next_voice{0};
+static std::atomic<u32> s_sfx_master_q15{MIXER_UNITY_Q15};
+
+static Vec3f s_listener_pos = { 0.0f, 0.0f, 0.0f };
+static Vec3f s_listener_fwd = { 0.0f, 0.0f, -1.0f };
+static Vec3f s_listener_up = { 0.0f, 1.0f, 0.0f };
+
+static std::atomic<u32> s_sound_count{0};
+static std::atomic<u64> s_voices_started{0};
+static std::atomic<u64> s_voices_dropped{0};
+static std::atomic<u32> s_active_voices{0};
+static std::atomic<u32> s_peak_voices{0};
+static std::atomic<u64> s_mix_count{0};
+static std::atomic<f64> s_last_mix_micros{0.0};
+static std::atomic<f64> s_peak_mix_micros{0.0};
+
+static inline u32 MakeHandle(u32 slot, u32 generation) {
+    return ((generation & 0xFFFFFFu) << 8) | (slot + 1);
+}
+
+/** @return Voice slot of a handle, or CV64_MIXER_MAX_VOICES if malformed */
+static inline u32 HandleSlot(u32 handle) {
+    const u32 slot = (handle & 0xFFu) - 1;
+    return slot < CV64_MIXER_MAX_VOICES ? slot : CV64_MIXER_MAX_VOICES;
+}
+
+static inline u64 MakeControl(u32 handle, u32 gl, u32 gr) {
+    return ((u64)handle << 32) | ((u64)gl << 16) | gr;
+}
+
+/*===========================================================================
+ * Gain / Pan
+ *===========================================================================*/
+
+/* Constant-power pan scaled so the center position is unity on both sides */
+static void PanGains(f32 volume, f32 pan, u32* gl, u32* gr) {
+    volume = Clamp(volume, 0.0f, 1.0f);
+    const f32 angle = (Clamp(pan, -1.0f, 1.0f) + 1.0f) * 0.25f * MIXER_PI;
+    *gl = ToQ15(volume * (std::min)(1.0f, cosf(angle) * MIXER_SQRT2));
+    *gr = ToQ15(volume * (std::min)(1.0f, sinf(angle) * MIXER_SQRT2));
+}
+
+static void SpatialGains(const VoiceParams& p, u32* gl, u32* gr) {
+    const f32 dx = p.position.x - s_listener_pos.x;
+    const f32 dy = p.position.y - s_listener_pos.y;
+    const f32 dz = p.position.z - s_listener_pos.z;
+    const f32 dist = sqrtf(dx * dx + dy * dy + dz * dz);
+
+    f32 attenuation = 1.0f;
+    if (dist >= CV64_MIXER_3D_MAX_DISTANCE) {
+        attenuation = 0.0f;
+    } else if (dist > CV64_MIXER_3D_MIN_DISTANCE) {
+        attenuation = 1.0f - (dist - CV64_MIXER_3D_MIN_DISTANCE) /
+                             (CV64_MIXER_3D_MAX_DISTANCE - CV64_MIXER_3D_MIN_DISTANCE);
+    }
+
+    /* Listener right = forward x up */
+    const Vec3f& f = s_listener_fwd;
+    const Vec3f& u = s_listener_up;
+    f32 rx = f.y * u.z - f.z * u.y;
+    f32 ry = f.z * u.x - f.x * u.z;
+    f32 rz = f.x * u.y - f.y * u.x;
+    const f32 rlen = sqrtf(rx * rx + ry * ry + rz * rz);
+
+    f32 pan = 0.0f;
+    if (dist > 1e-3f && rlen > 1e-6f) {
+        pan = (dx * rx + dy * ry + dz * rz) / (dist * rlen);
+    }
+    PanGains(p.volume * attenuation, pan, gl, gr);
+}
+
+static void VoiceGains(const VoiceParams& p, u32* gl, u32* gr) {
+    if (p.is3d) {
+        SpatialGains(p, gl, gr);
+    } else {
+        PanGains(p.volume, p.pan, gl, gr);
+    }
+}
+
+/** Push new gains to a voice unless it now belongs to another handle */
+static void UpdateVoiceGains(u32 slot) {
+    const VoiceParams& p = s_params[slot];
+    u32 gl, gr;
+    VoiceGains(p, &gl, &gr);
+
+    MixerVoice& v = s_voices[slot];
+    const u64 desired = MakeControl(p.handle, gl, gr);
+    u64 expected = v.control.load(std::memory_order_relaxed);
+    while ((u32)(expected >> 32) == p.handle) {
+        if (v.control.compare_exchange_weak(expected, desired,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+/** @return Slot of a live handle, or CV64_MIXER_MAX_VOICES */
+static u32 FindVoice(u32 handle) {
+    const u32 slot = HandleSlot(handle);
+    if (slot == CV64_MIXER_MAX_VOICES || s_params[slot].handle != handle) {
+        return CV64_MIXER_MAX_VOICES;
+    }
+    return slot;
+}
+
+static u32 StartVoice(u32 sfx_id, f32 volume, f32 pan, bool loop, const Vec3f* position) {
+    if (sfx_id == 0 || sfx_id >= CV64_MIXER_MAX_SOUNDS) return 0;
+    const MixerSound& sound = s_sounds[sfx_id];
+    const s16* frames = sound.frames.load(std::memory_order_acquire);
+    if (!frames) return 0;
+
+    const u32 first = s_next_voice.load(std::memory_order_relaxed);
+    for (u32 n = 0; n < CV64_MIXER_MAX_VOICES; n++) {
+        const u32 slot = (first + n) % CV64_MIXER_MAX_VOICES;
+        MixerVoice& v = s_voices[slot];
+        u32 expected = VOICE_FREE;
+        if (!v.state.compare_exchange_strong(expected, VOICE_CLAIMED,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+            continue;
+        }
+        s_next_voice.store(slot + 1, std::memory_order_relaxed);
+
+        VoiceParams& p = s_params[slot];
+        if ((++p.generation & 0xFFFFFFu) == 0) p.generation = 1;
+        p.handle = MakeHandle(slot, p.generation);
+        p.volume = volume;
+        p.pan = pan;
+        p.is3d = position != nullptr;
+        if (position) p.position = *position;
+
+        u32 gl, gr;
+        VoiceGains(p, &gl, &gr);
+
+        v.frames = frames;
+        v.frameCount = sound.frameCount;
+        v.loop = loop;
+        v.control.store(MakeControl(p.handle, gl, gr), std::memory_order_relaxed);
+        v.state.store(VOICE_PENDING, std::memory_order_release);
+
+        s_voices_started.fetch_add(1, std::memory_order_relaxed);
+        return p.handle;
+    }
+
+    if (s_voices_dropped.fetch_add(1, std::memory_order_relaxed) == 0) {
+        MixerLog("All %u voices busy, dropping sound %u", CV64_MIXER_MAX_VOICES, sfx_id);
+    }
+    return 0;
+}
+
+/*===========================================================================
+ * Mixer API
+ *===========================================================================*/
+
+bool CV64_Mixer_RegisterSound(u32 sfx_id, const s16* frames, u32 frameCount) {
+    if (sfx_id == 0 || sfx_id >= CV64_MIXER_MAX_SOUNDS || !frames || frameCount == 0) {
+        return false;
+    }
+    MixerSound& sound = s_sounds[sfx_id];
+    if (sound.frames.load(std::memory_order_relaxed)) {
+        MixerLog("Sound %u is already registered", sfx_id);
+        return false;
+    }
+
+    const size_t bytes = (size_t)frameCount * 2 * sizeof(s16);
+    s16* copy = (s16*)malloc(bytes);
+    if (!copy) return false;
+    memcpy(copy, frames, bytes);
+
+    sound.frameCount = frameCount;
+    sound.frames.store(copy, std::memory_order_release);
+    const u32 count = s_sound_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count == 1) {
+        MixerLog("Voice pool ready (%u voices, %s kernels)", CV64_MIXER_MAX_VOICES, MIXER_KERNEL_NAME);
+    }
+    return true;
+}
+
+bool CV64_Mixer_IsSoundRegistered(u32 sfx_id) {
+    return sfx_id != 0 && sfx_id < CV64_MIXER_MAX_SOUNDS &&
+           s_sounds[sfx_id].frames.load(std::memory_order_acquire) != nullptr;
+}
+
+void CV64_Mixer_Mix(s16* stream, u32 frameCount) {
+    if (!stream || frameCount == 0) return;
+    const auto start = std::chrono::steady_clock::now();
+    const u32 master = s_sfx_master_q15.load(std::memory_order_relaxed);
+
+    u32 active = 0;
+    for (u32 slot = 0; slot < CV64_MIXER_MAX_VOICES; slot++) {
+        MixerVoice& v = s_voices[slot];
+        const u32 state = v.state.load(std::memory_order_acquire);
+        if (state == VOICE_PENDING) {
+            v.position = 0;
+            v.state.store(VOICE_PLAYING, std::memory_order_relaxed);
+        } else if (state != VOICE_PLAYING) {
+            continue;
+        }
+
+        const u64 control = v.control.load(std::memory_order_acquire);
+        if (v.stopHandle.load(std::memory_order_acquire) == (u32)(control >> 32)) {
+            v.state.store(VOICE_FREE, std::memory_order_release);
+            continue;
+        }
+        active++;
+
+        const u32 gl = ((u32)((control >> 16) & 0xFFFFu) * master + 0x4000) >> 15;
+        const u32 gr = ((u32)(control & 0xFFFFu) * master + 0x4000) >> 15;
+
+        /* Silent voices still advance so they stay in time */
+        bool finished = false;
+        u32 done = 0;
+        while (done < frameCount) {
+            const u32 n = (std::min)(frameCount - done, v.frameCount - v.position);
+            if (gl | gr) {
+                MixSamples(stream + done * 2, v.frames + v.position * 2, n * 2, gl, gr);
+            }
+            done += n;
+            v.position += n;
+            if (v.position == v.frameCount) {
+                if (!v.loop) {
+                    finished = true;
+                    break;
+                }
+                v.position = 0;
+            }
+        }
+        if (finished) v.state.store(VOICE_FREE, std::memory_order_release);
+    }
+
+    const f64 micros = std::chrono::duration<f64, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+    s_active_voices.store(active, std::memory_order_relaxed);
+    if (active > s_peak_voices.load(std::memory_order_relaxed)) {
+        s_peak_voices.store(active, std::memory_order_relaxed);
+    }
+    s_last_mix_micros.store(micros, std::memory_order_relaxed);
+    if (micros > s_peak_mix_micros.load(std::memory_order_relaxed)) {
+        s_peak_mix_micros.store(micros, std::memory_order_relaxed);
+    }
+    s_mix_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CV64_Mixer_Scale(s16* samples, u32 count, f32 gain) {
+    if (!samples || count == 0) return;
+    const u32 g = ToQ15(gain);
+    if (g == MIXER_UNITY_Q15) return;
+    const s16 gs = (s16)(g > 32767 ? 32767 : g);
+    MulKernel<false>(samples, samples, count, gs, gs);
+}
+
+void CV64_Mixer_Reset(void) {
+    for (u32 slot = 0; slot < CV64_MIXER_MAX_VOICES; slot++) {
+        s_voices[slot].state.store(VOICE_FREE, std::memory_order_release);
+        s_voices[slot].stopHandle.store(0, std::memory_order_relaxed);
+    }
+    s_active_voices.store(0, std::memory_order_relaxed);
+}
+
+void CV64_Mixer_Shutdown(void) {
+    CV64_Mixer_Reset();
+    for (u32 id = 0; id < CV64_MIXER_MAX_SOUNDS; id++) {
+        const s16* frames = s_sounds[id].frames.exchange(nullptr, std::memory_order_acq_rel);
+        free((void*)frames);
+        s_sounds[id].frameCount = 0;
+    }
+    s_sound_count.store(0, std::memory_order_relaxed);
+}
+
+void CV64_Mixer_GetStats(CV64_MixerStats* stats) {
+    if (!stats) return;
+    stats->soundCount = s_sound_count.load(std::memory_order_relaxed);
+    stats->activeVoices = s_active_voices.load(std::memory_order_relaxed);
+    stats->peakVoices = s_peak_voices.load(std::memory_order_relaxed);
+    stats->voicesStarted = s_voices_started.load(std::memory_order_relaxed);
+    stats->voicesDropped = s_voices_dropped.load(std::memory_order_relaxed);
+    stats->mixCount = s_mix_count.load(std::memory_order_relaxed);
+    stats->lastMixMicros = s_last_mix_micros.load(std::memory_order_relaxed);
+    stats->peakMixMicros = s_peak_mix_micros.load(std::memory_order_relaxed);
+}
+
+/*===========================================================================
+ * Sound Effect API (cv64_audio.h)
+ *
+ * Meant for one game thread; the audio callback is the only other party.
+ *===========================================================================*/
+
+u32 CV64_Audio_PlaySFX(u32 sfx_id) {
+    return StartVoice(sfx_id, 1.0f, 0.0f, false, nullptr);
+}
+
+u32 CV64_Audio_PlaySFX3D(u32 sfx_id, Vec3f* position) {
+    return StartVoice(sfx_id, 1.0f, 0.0f, false, position);
+}
+
+u32 CV64_Audio_PlaySFXEx(u32 sfx_id, f32 volume, f32 pan, bool loop) {
+    return StartVoice(sfx_id, volume, pan, loop, nullptr);
+}
+
+void CV64_Audio_StopSFX(u32 handle) {
+    const u32 slot = FindVoice(handle);
+    if (slot == CV64_MIXER_MAX_VOICES) return;
+    s_voices[slot].stopHandle.store(handle, std::memory_order_release);
+}
+
+void CV64_Audio_SetSFXVolume(u32 handle, f32 volume) {
+    const u32 slot = FindVoice(handle);
+    if (slot == CV64_MIXER_MAX_VOICES) return;
+    s_params[slot].volume = volume;
+    UpdateVoiceGains(slot);
+}
+
+void CV64_Audio_SetSFXPosition(u32 handle, Vec3f* position) {
+    const u32 slot = FindVoice(handle);
+    if (slot == CV64_MIXER_MAX_VOICES || !position) return;
+    s_params[slot].is3d = true;
+    s_params[slot].position = *position;
+    UpdateVoiceGains(slot);
+}
+
+void CV64_Audio_SetSFXPan(u32 handle, f32 pan) {
+    const u32 slot = FindVoice(handle);
+    if (slot == CV64_MIXER_MAX_VOICES || s_params[slot].is3d) return;
+    s_params[slot].pan = pan;
+    UpdateVoiceGains(slot);
+}
+
+void CV64_Audio_SetSFXMasterVolume(f32 volume) {
+    s_sfx_master_q15.store(ToQ15(volume), std::memory_order_relaxed);
+}
+
+static void UpdateSpatialVoices(void) {
+    for (u32 slot = 0; slot < CV64_MIXER_MAX_VOICES; slot++) {
+        if (!s_params[slot].is3d) continue;
+        if (s_voices[slot].state.load(std::memory_order_relaxed) == VOICE_FREE) continue;
+        UpdateVoiceGains(slot);
+    }
+}
+
+void CV64_Audio_SetListenerPosition(Vec3f* position) {
+    if (!position) return;
+    s_listener_pos = *position;
+    UpdateSpatialVoices();
+}
+
+void CV64_Audio_SetListenerOrientation(Vec3f* forward, Vec3f* up) {
+    if (!forward || !up) return;
+    s_listener_fwd = *forward;
+    s_listener_up = *up;
+    UpdateSpatialVoices();
+}
@@ -0,0 +1,261 @@
+/**
+ * @file cv64_audio_resampler.cpp
+ * @brief Castlevania 64 PC Recomp - Polyphase resampler implementation
+ *
+ * Input is kept as two planar float histories. The read position is a
+ * 32.32 fixed-point index of the first tap; its top fraction bits pick a
+ * coefficient row and the rest interpolate towards the next row. Rows are
+ * normalised to unity DC gain so a constant input stays constant through
+ * any ratio.
+ *
+ * The cutoff sits at 92% of the lower of the two Nyquist frequencies,
+ * which keeps aliasing from the 33-48 kHz AI rates below the filter's
+ * stopband when the device rate is lower, and simply band-limits the
+ * interpolation when it is higher.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#include "../include/cv64_audio_resampler.h"
+#include "../include/cv64_cpu_features.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#define RESAMPLER_HALF          (CV64_RESAMPLER_TAPS / 2)
+#define RESAMPLER_PHASE_BITS    8
+#define RESAMPLER_PHASE_SHIFT   (32 - RESAMPLER_PHASE_BITS)
+#define RESAMPLER_CUTOFF        0.92
+#define RESAMPLER_KAISER_BETA   7.0
+#define RESAMPLER_CAPACITY      (CV64_RESAMPLER_MAX_FRAMES + CV64_RESAMPLER_TAPS)
+
+/* Controller: error is (fill - target) / target, clamped to +/-1 */
+#define RESAMPLER_SMOOTHING     0.1     /* EMA weight of each measurement */
+#define RESAMPLER_KP            0.005   /* Full correction at 100% error */
+#define RESAMPLER_KI            0.00005 /* Per update, cancels steady clock drift */
+
+static_assert((1 << RESAMPLER_PHASE_BITS) == CV64_RESAMPLER_PHASES,
+              "CV64_RESAMPLER_PHASES must match RESAMPLER_PHASE_BITS");
+static_assert(CV64_RESAMPLER_TAPS % 4 == 0, "CV64_RESAMPLER_TAPS must be a multiple of 4");
+
+/*===========================================================================
+ * Filter Kernels
+ *
+ * One output frame: interpolate the coefficient row at t, then dot it with
+ * TAPS frames of each channel and store the rounded, saturated pair.
+ *===========================================================================*/
+
+static inline s16 ToS16(f32 v) {
+    const long s = lrintf(v * 32768.0f);
+    return (s16)(s < -32768 ? -32768 : (s > 32767 ? 32767 : s));
+}
+
+#if defined(CV64_CPU_X64)
+
+static CV64_INLINE void FilterFrame(const f32* row, f32 t, const f32* left, const f32* right, s16* out) {
+    const __m128 vt = _mm_set1_ps(t);
+    __m128 accL = _mm_setzero_ps();
+    __m128 accR = _mm_setzero_ps();
+    for (u32 k = 0; k < CV64_RESAMPLER_TAPS; k += 4) {
+        const __m128 c0 = _mm_load_ps(row + k);
+        const __m128 c1 = _mm_load_ps(row + CV64_RESAMPLER_TAPS + k);
+        const __m128 c = _mm_add_ps(c0, _mm_mul_ps(vt, _mm_sub_ps(c1, c0)));
+        accL = _mm_add_ps(accL, _mm_mul_ps(c, _mm_loadu_ps(left + k)));
+        accR = _mm_add_ps(accR, _mm_mul_ps(c, _mm_loadu_ps(right + k)));
+    }
+    /* Reduce both accumulators at once: lanes 0/1 end up as L/R */
+    __m128 sum = _mm_add_ps(_mm_unpacklo_ps(accL, accR), _mm_unpackhi_ps(accL, accR));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    const __m128i s32 = _mm_cvtps_epi32(_mm_mul_ps(sum, _mm_set1_ps(32768.0f)));
+    const int pair = _mm_cvtsi128_si32(_mm_packs_epi32(s32, s32));
+    memcpy(out, &pair, sizeof(pair));
+}
+
+#define RESAMPLER_KERNEL_NAME "sse"
+
+#elif defined(CV64_CPU_ARM64)
+
+static CV64_INLINE void FilterFrame(const f32* row, f32 t, const f32* left, const f32* right, s16* out) {
+    const float32x4_t vt = vdupq_n_f32(t);
+    float32x4_t accL = vdupq_n_f32(0.0f);
+    float32x4_t accR = vdupq_n_f32(0.0f);
+    for (u32 k = 0; k < CV64_RESAMPLER_TAPS; k += 4) {
+        const float32x4_t c0 = vld1q_f32(row + k);
+        const float32x4_t c1 = vld1q_f32(row + CV64_RESAMPLER_TAPS + k);
+        const float32x4_t c = vfmaq_f32(c0, vt, vsubq_f32(c1, c0));
+        accL = vfmaq_f32(accL, c, vld1q_f32(left + k));
+        accR = vfmaq_f32(accR, c, vld1q_f32(right + k));
+    }
+    const f32 lr[2] = { vaddvq_f32(accL), vaddvq_f32(accR) };
+    const int32x2_t s32 = vcvtn_s32_f32(vmul_n_f32(vld1_f32(lr), 32768.0f));
+    const int16x4_t s16x = vqmovn_s32(vcombine_s32(s32, s32));
+    vst1_lane_s32((int32_t*)out, vreinterpret_s32_s16(s16x), 0);
+}
+
+#define RESAMPLER_KERNEL_NAME "neon"
+
+#else
+
+static CV64_INLINE void FilterFrame(const f32* row, f32 t, const f32* left, const f32* right, s16* out) {
+    f32 l = 0.0f, r = 0.0f;
+    for (u32 k = 0; k < CV64_RESAMPLER_TAPS; k++) {
+        const f32 c = row[k] + t * (row[CV64_RESAMPLER_TAPS + k] - row[k]);
+        l += c * left[k];
+        r += c * right[k];
+    }
+    out[0] = ToS16(l);
+    out[1] = ToS16(r);
+}
+
+#define RESAMPLER_KERNEL_NAME "scalar"
+
+#endif
+
+/*===========================================================================
+ * Filter Design
+ *===========================================================================*/
+
+/* Zeroth-order modified Bessel function of the first kind (series) */
+static f64 BesselI0(f64 x) {
+    f64 sum = 1.0;
+    f64 term = 1.0;
+    const f64 q = x * x * 0.25;
+    for (int k = 1; k < 64; k++) {
+        term *= q / ((f64)k * k);
+        sum += term;
+        if (term < sum * 1e-12) break;
+    }
+    return sum;
+}
+
+void CV64_AudioResampler::BuildFilter() {
+    const f64 pi = 3.14159265358979323846;
+    const f64 fc = RESAMPLER_CUTOFF * (std::min)(1.0, (f64)m_dstRate / (f64)m_srcRate);
+    const f64 i0Beta = BesselI0(RESAMPLER_KAISER_BETA);
+
+    /* PHASES + 1 rows so the last phase can interpolate towards a row
+     * that is the first one shifted by a whole frame */
+    for (u32 p = 0; p <= CV64_RESAMPLER_PHASES; p++) {
+        const f64 frac = (f64)p / CV64_RESAMPLER_PHASES;
+        f64 row[CV64_RESAMPLER_TAPS];
+        f64 sum = 0.0;
+        for (u32 k = 0; k < CV64_RESAMPLER_TAPS; k++) {
+            const f64 x = (f64)k - (RESAMPLER_HALF - 1) - frac;
+            const f64 arg = pi * fc * x;
+            const f64 sinc = (x == 0.0) ? 1.0 : sin(arg) / arg;
+            const f64 r = x / RESAMPLER_HALF;
+            const f64 w = (r * r < 1.0) ? BesselI0(RESAMPLER_KAISER_BETA * sqrt(1.0 - r * r)) / i0Beta : 0.0;
+            row[k] = fc * sinc * w;
+            sum += row[k];
+        }
+        f32* dst = m_coeffs + p * CV64_RESAMPLER_TAPS;
+        for (u32 k = 0; k < CV64_RESAMPLER_TAPS; k++) {
+            dst[k] = (f32)(row[k] / sum);
+        }
+    }
+}
+
+/*===========================================================================
+ * Resampler
+ *===========================================================================*/
+
+CV64_AudioResampler::CV64_AudioResampler() {
+    memset(m_coeffs, 0, sizeof(m_coeffs));
+}
+
+bool CV64_AudioResampler::Configure(u32 srcRate, u32 dstRate) {
+    if (srcRate == 0 || dstRate == 0) return false;
+    if (srcRate == m_srcRate && dstRate == m_dstRate) return true;
+
+    const bool first = (m_srcRate == 0);
+    m_srcRate = srcRate;
+    m_dstRate = dstRate;
+    BuildFilter();
+    m_baseStep = ((u64)srcRate << 32) / dstRate;
+    m_step = (u64)((f64)m_baseStep * (1.0 + m_adjust));
+    if (first) Reset();
+    return true;
+}
+
+void CV64_AudioResampler::Reset() {
+    /* Pre-roll silence so the first input frame lands on the filter center */
+    memset(m_left, 0, (RESAMPLER_HALF - 1) * sizeof(f32));
+    memset(m_right, 0, (RESAMPLER_HALF - 1) * sizeof(f32));
+    m_count = RESAMPLER_HALF - 1;
+    m_pos = 0;
+    m_adjust = 0.0;
+    m_smoothed = 0.0;
+    m_integral = 0.0;
+    m_step = m_baseStep;
+}
+
+u32 CV64_AudioResampler::Buffered() const {
+    const u32 center = (u32)(m_pos >> 32) + (RESAMPLER_HALF - 1);
+    return m_count > center ? m_count - center : 0;
+}
+
+u32 CV64_AudioResampler::FramesWanted(u32 outFrames) const {
+    if (outFrames == 0 || m_step == 0) return 0;
+    const u64 last = ((m_pos + (u64)(outFrames - 1) * m_step) >> 32) + CV64_RESAMPLER_TAPS;
+    if (last <= m_count) return 0;
+    return (u32)(std::min)(last - m_count, (u64)(RESAMPLER_CAPACITY - m_count));
+}
+
+u32 CV64_AudioResampler::Push(const s16* frames, u32 count) {
+    if (!frames) return 0;
+    const u32 n = (std::min)(count, (u32)RESAMPLER_CAPACITY - m_count);
+    const f32 scale = 1.0f / 32768.0f;
+    f32* left = m_left + m_count;
+    f32* right = m_right + m_count;
+    for (u32 i = 0; i < n; i++) {
+        left[i] = frames[i * 2] * scale;
+        right[i] = frames[i * 2 + 1] * scale;
+    }
+    m_count += n;
+    return n;
+}
+
+u32 CV64_AudioResampler::Render(s16* out, u32 outFrames) {
+    if (!out || m_step == 0) return 0;
+
+    const f32 tScale = 1.0f / (f32)(1u << RESAMPLER_PHASE_SHIFT);
+    u32 produced = 0;
+    while (produced < outFrames) {
+        const u32 i0 = (u32)(m_pos >> 32);
+        if (i0 + CV64_RESAMPLER_TAPS > m_count) break;
+        const u32 frac = (u32)m_pos;
+        const f32* row = m_coeffs + (frac >> RESAMPLER_PHASE_SHIFT) * CV64_RESAMPLER_TAPS;
+        const f32 t = (f32)(frac & ((1u << RESAMPLER_PHASE_SHIFT) - 1)) * tScale;
+        FilterFrame(row, t, m_left + i0, m_right + i0, out + produced * 2);
+        m_pos += m_step;
+        produced++;
+    }
+
+    Discard();
+    return produced;
+}
+
+void CV64_AudioResampler::Discard() {
+    const u32 drop = (std::min)((u32)(m_pos >> 32), m_count);
+    if (drop == 0) return;
+    const u32 keep = m_count - drop;
+    memmove(m_left, m_left + drop, keep * sizeof(f32));
+    memmove(m_right, m_right + drop, keep * sizeof(f32));
+    m_count = keep;
+    m_pos -= (u64)drop << 32;
+}
+
+void CV64_AudioResampler::UpdateRate(f64 fillFrames, f64 targetFrames) {
+    if (targetFrames <= 0.0) return;
+    const f64 error = (std::max)(-1.0, (std::min)(1.0, (fillFrames - targetFrames) / targetFrames));
+    m_smoothed += RESAMPLER_SMOOTHING * (error - m_smoothed);
+    m_integral = (std::max)(-CV64_RESAMPLER_MAX_ADJUST,
+                            (std::min)(CV64_RESAMPLER_MAX_ADJUST, m_integral + RESAMPLER_KI * m_smoothed));
+    m_adjust = (std::max)(-CV64_RESAMPLER_MAX_ADJUST,
+                          (std::min)(CV64_RESAMPLER_MAX_ADJUST, RESAMPLER_KP * m_smoothed + m_integral));
+    m_step = (u64)((f64)m_baseStep * (1.0 + m_adjust));
+}
+
+const char* CV64_AudioResampler::KernelName() {
+    return RESAMPLER_KERNEL_NAME;
+}
@@ -8,11 +8,17 @@
 #ifdef CV64_STATIC_MUPEN64PLUS
 
 #include "../include/cv64_threading.h"
+#include "../include/cv64_spsc_ring.h"
+#include "../include/cv64_audio.h"
+#include "../include/cv64_audio_mixer.h"
+#include "../include/cv64_audio_resampler.h"
 #include <Windows.h>
 #include <SDL.h>
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 
 extern "C" {
 #include "../RMG/Source/3rdParty/mupen64plus-core/src/api/m64p_plugin.h"
@@ -23,11 +29,25 @@ extern "C" {
  * Configuration
  *===========================================================================*/
 
-#define AUDIO_BUFFER_SIZE 16384
 #define SDL_AUDIO_SAMPLES 2048
 #define DEFAULT_FREQUENCY 33600
 #define PRIMARY_BUFFER_TARGET 2048
 
+#define DEVICE_FREQUENCY 44100
+#define DEFAULT_LATENCY_MS 25
+#define MIN_LATENCY_MS 10
+#define MAX_LATENCY_MS 250
+#define MIN_DEVICE_SAMPLES 256
+#define PULL_CHUNK_FRAMES 1024
+/* Queued audio beyond this many times the target is a stall backlog */
+#define RESYNC_FACTOR 4
+/* Highest AI rate CV64 plays at (NTSC dacrate tops out just under this) */
+#define MAX_SOURCE_FREQUENCY 48000
+/* Sync ring in bytes (s16 stereo): enough for the resync threshold of the
+ * largest latency target at the highest AI rate, so priming always ends */
+#define AUDIO_BUFFER_SIZE (MAX_LATENCY_MS * MAX_SOURCE_FREQUENCY / 1000 * RESYNC_FACTOR * 4)
+#define HEADLESS_BLOCK_FRAMES 1024
+
  /*===========================================================================
   * State
   *===========================================================================*/
@@ -45,22 +65,74 @@ static struct {
     int speedFactor;
     int volume;
     bool muted;
-
-    uint8_t* buffer;
-    int bufferSize;
-    volatile int readPos;
-    volatile int writePos;
-    volatile int bufferLevel;
-
-    SDL_mutex* mutex;
 } g_audio = {
     false, false, 0,
     {},
-    DEFAULT_FREQUENCY, 100, 100, false,
-    nullptr, 0, 0, 0, 0,
-    nullptr
+    DEFAULT_FREQUENCY, 100, 100, false
+};
+
+/* Sample ring used when the threading system's async audio ring is off.
+ * Emulation thread writes, SDL callback reads - no lock on either side. */
+static CV64_SpscRing<uint8_t> g_audioRing;
+
+static CV64_AudioConfig g_config = {
+    .backend = CV64_AUDIO_BACKEND_AUTO,
+    .sample_rate = CV64_SAMPLERATE_44100,
+    .buffer_size = 0,       /* Derived from latency_ms */
+    .latency_ms = DEFAULT_LATENCY_MS,
+    .master_volume = 1.0f,
+    .music_volume = 1.0f,
+    .sfx_volume = 1.0f,
+    .voice_volume = 1.0f,
+    .ambient_volume = 1.0f,
+    .headless_unthrottled = true,
 };
 
+/* Shared with the callback */
+static std::atomic<int> g_sourceRate{DEFAULT_FREQUENCY};
+static std::atomic<u32> g_latencyMs{DEFAULT_LATENCY_MS};
+static std::atomic<u64> g_resampleUnderruns{0};
+static std::atomic<u64> g_resyncs{0};
+static std::atomic<bool> g_speedLimiterOff{false};
+
+/* Callback only. Resampling happens on the consumer side so the ring holds
+ * AI-rate frames and its fill level is what the rate controller steers. */
+static CV64_AudioResampler g_resampler;
+static s16 g_pullBuffer[PULL_CHUNK_FRAMES * 2];
+static bool g_priming = true;
+
+/* Headless backend (emulation thread only) */
+static bool g_headless = false;
+static s16 g_headlessBuffer[HEADLESS_BLOCK_FRAMES * 2];
+static FILE* g_wavFile = nullptr;
+static u64 g_wavBytes = 0;
+static char g_wavCreatedPath[260] = "";     /* File written earlier this session */
+static u32 g_wavCreatedRate = 0;
+
+/* Pipeline statistics, written from both the emulation thread and the
+ * callback */
+enum {
+    STAGE_QUEUE = 0,
+    STAGE_RESAMPLE,
+    STAGE_MIX,
+    STAGE_SINK,
+    STAGE_COUNT
+};
+
+static std::atomic<u64> g_stageNs[STAGE_COUNT];
+static std::atomic<u64> g_framesQueued{0};
+static std::atomic<u64> g_framesRendered{0};
+static std::atomic<u64> g_statsStartNs{0};
+
+static inline u64 NowNs() {
+    return (u64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline void AddStageTime(int stage, u64 startNs) {
+    g_stageNs[stage].fetch_add(NowNs() - startNs, std::memory_order_relaxed);
+}
+
 /*===========================================================================
  * Logging
  *===========================================================================*/
@@ -100,20 +172,12 @@ static void BuildAssetPath(char* outPath, size_t outSize, const char* filename)
 
 /*===========================================================================
  * Sound Effects System
+ *
+ * WAVs are converted to the device format once and handed to the voice
+ * pool (cv64_audio_mixer), which plays them through CV64_Audio_PlaySFX.
  *===========================================================================*/
 
-struct LoadedSFX {
-    Uint8* data = nullptr;
-    Uint32 length = 0;
-    Uint32 position = 0;
-    bool playing = false;
-};
-
-static LoadedSFX g_sfx_itemPickup;
-static LoadedSFX g_sfx_powerupPickup;
-static LoadedSFX g_sfx_goldPickup;   // NEW
-
-static bool LoadSFX(LoadedSFX& sfx, const char* filename)
+static bool LoadSFX(u32 sfxId, const char* filename)
 {
     char fullPath[MAX_PATH];
     BuildAssetPath(fullPath, sizeof(fullPath), filename);
@@ -158,12 +222,17 @@ static bool LoadSFX(LoadedSFX& sfx, const char* filename)
         return false;
     }
 
-    sfx.data = cvt.buf;
-    sfx.length = cvt.len_cvt;
-    sfx.position = 0;
-    sfx.playing = false;
+    /* Device is opened as S16 stereo, so one frame is 4 bytes */
+    const Uint32 frameCount = (Uint32)cvt.len_cvt / 4;
+    const bool registered = CV64_Mixer_RegisterSound(sfxId, (const s16*)cvt.buf, frameCount);
+    SDL_free(cvt.buf);
 
-    sprintf(msg, "Loaded OK (%u bytes)", sfx.length);
+    if (!registered) {
+        AudioLog("Failed to register SFX with the mixer");
+        return false;
+    }
+
+    sprintf(msg, "Loaded OK (%u bytes)", (unsigned)cvt.len_cvt);
     AudioLog(msg);
 
     return true;
@@ -173,75 +242,247 @@ static bool LoadSFX(LoadedSFX& sfx, const char* filename)
  * SDL Audio Callback
  *===========================================================================*/
 
-static void SDLCALL AudioCallback(void* userdata, Uint8* stream, int len) {
-    (void)userdata;
+/* Pull from whichever ring the emulation thread is feeding. Neither read
+ * takes a lock, so a preempted producer can't stall us. */
+static u32 QueuedFrames(bool async) {
+    return async ? (u32)(CV64_Audio_GetQueueDepth() / 2) : (u32)(g_audioRing.Size() / 4);
+}
 
-    if (!g_audio.mutex) {
-        memset(stream, 0, len);
-        return;
+static u32 PullFrames(bool async, s16* dst, u32 frames) {
+    if (async) {
+        return (u32)(CV64_Audio_DequeueSamples(dst, (size_t)frames * 2) / 2);
     }
+    return (u32)(g_audioRing.Read((uint8_t*)dst, (size_t)frames * 4) / 4);
+}
 
-    SDL_LockMutex(g_audio.mutex);
+/* buffer_size if set, otherwise the largest power of two that fits in a
+ * quarter of the latency target so most of the budget is ring headroom */
+static Uint16 DeviceBufferSamples(int freq) {
+    u32 samples = g_config.buffer_size;
+    if (samples == 0) {
+        const u32 budget = (u32)freq * g_latencyMs.load() / 4000;
+        samples = MIN_DEVICE_SAMPLES;
+        while (samples * 2 <= budget) samples *= 2;
+    }
+    return (Uint16)(std::max)((u32)MIN_DEVICE_SAMPLES, (std::min)(samples, (u32)SDL_AUDIO_SAMPLES));
+}
 
-    int available = g_audio.bufferLevel;
-    int toCopy = (len < available) ? len : available;
+/* Resample up to outFrames from the ring. Realtime output also steers the
+ * ratio, drops stall backlogs and re-primes after running dry; the headless
+ * sink just takes whatever has been queued. */
+static u32 ResampleFrames(s16* out, u32 outFrames, bool realtime) {
+    const u64 startNs = NowNs();
+    const bool async = CV64_Threading_IsAsyncAudioEnabled();
+    const u32 srcRate = (u32)g_sourceRate.load(std::memory_order_relaxed);
+    g_resampler.Configure(srcRate, (u32)g_obtainedSpec.freq);
+
+    u32 queued = QueuedFrames(async);
+    if (realtime) {
+        f64 target = (f64)srcRate * g_latencyMs.load(std::memory_order_relaxed) / 1000.0;
+        if (!async) {
+            /* An AI rate above MAX_SOURCE_FREQUENCY must still leave room for
+             * the resync threshold, or priming would never end */
+            const u32 ringFrames = (u32)(g_audioRing.Capacity() / 4);
+            target = (std::min)(target, (f64)(ringFrames - (std::min)(ringFrames, outFrames)) / RESYNC_FACTOR);
+        }
 
-    if (toCopy > 0 && !g_audio.muted) {
-        int firstPart = g_audio.bufferSize - g_audio.readPos;
-        if (firstPart >= toCopy) {
-            memcpy(stream, g_audio.buffer + g_audio.readPos, toCopy);
-            g_audio.readPos = (g_audio.readPos + toCopy) % g_audio.bufferSize;
+        /* A stall (loading, debugger, window drag) leaves a backlog the
+         * +/-0.5% controller would take minutes to drain; drop it instead */
+        if (queued > target * RESYNC_FACTOR + outFrames) {
+            u32 skip = queued - (u32)target;
+            while (skip > 0) {
+                const u32 got = PullFrames(async, g_pullBuffer, (std::min)(skip, (u32)PULL_CHUNK_FRAMES));
+                if (got == 0) break;
+                skip -= got;
+                queued -= got;
+            }
+            g_resyncs.fetch_add(1, std::memory_order_relaxed);
         }
-        else {
-            memcpy(stream, g_audio.buffer + g_audio.readPos, firstPart);
-            memcpy(stream + firstPart, g_audio.buffer, toCopy - firstPart);
-            g_audio.readPos = toCopy - firstPart;
+
+        /* After running dry, wait for the target fill before playing again
+         * rather than stuttering on every callback */
+        const u32 buffered = queued + g_resampler.Buffered();
+        if (g_priming && buffered >= target) g_priming = false;
+        if (g_priming) {
+            AddStageTime(STAGE_RESAMPLE, startNs);
+            return 0;
         }
-        g_audio.bufferLevel -= toCopy;
+        g_resampler.UpdateRate(buffered, target);
+    }
+
+    /* Never ask the ring for more than it holds, so its underrun counter
+     * only sees genuine races with the producer */
+    u32 wanted = (std::min)(g_resampler.FramesWanted(outFrames), queued);
+    while (wanted > 0) {
+        const u32 chunk = (std::min)(wanted, (u32)PULL_CHUNK_FRAMES);
+        const u32 got = PullFrames(async, g_pullBuffer, chunk);
+        g_resampler.Push(g_pullBuffer, got);
+        wanted -= got;
+        if (got < chunk) break;
+    }
+    const u32 produced = g_resampler.Render(out, outFrames);
 
+    if (realtime && produced < outFrames) {
+        g_priming = true;
+        if (g_audio.romOpen) g_resampleUnderruns.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    g_framesRendered.fetch_add(produced, std::memory_order_relaxed);
+    AddStageTime(STAGE_RESAMPLE, startNs);
+    return produced;
+}
+
+/* Apply volume, silence whatever wasn't produced and mix SFX on top */
+static void FinishFrames(s16* out, u32 produced, u32 outFrames) {
+    const u64 startNs = NowNs();
+
+    if (produced > 0 && !g_audio.muted) {
         if (g_audio.volume < 100) {
-            int16_t* samples = (int16_t*)stream;
-            int numSamples = toCopy / 2;
-            for (int i = 0; i < numSamples; i++) {
-                samples[i] = (int16_t)((samples[i] * g_audio.volume) / 100);
-            }
+            CV64_Mixer_Scale(out, produced * 2, g_audio.volume / 100.0f);
         }
 
-        if (toCopy < len) {
-            memset(stream + toCopy, 0, len - toCopy);
+        if (produced < outFrames) {
+            memset(out + produced * 2, 0, (outFrames - produced) * 4);
         }
     }
     else {
-        memset(stream, 0, len);
+        /* Muted samples are still consumed so the ring doesn't back up */
+        memset(out, 0, outFrames * 4);
     }
 
-    /* Mix SFX */
-    auto mixSFX = [&](LoadedSFX& sfx) {
-        if (!sfx.playing || !sfx.data) return;
+    CV64_Mixer_Mix(out, outFrames);
+    AddStageTime(STAGE_MIX, startNs);
+}
+
+static void SDLCALL AudioCallback(void* userdata, Uint8* stream, int len) {
+    (void)userdata;
+
+    s16* out = (s16*)stream;
+    const u32 outFrames = (u32)len / 4;
+    FinishFrames(out, ResampleFrames(out, outFrames, true), outFrames);
+}
+
+/*===========================================================================
+ * Headless Sink
+ *
+ * With CV64_AUDIO_BACKEND_HEADLESS no audio device (or SDL audio subsystem)
+ * is opened. Each AI DMA is drained on the emulation thread straight
+ * through resample and mix, so the pipeline runs exactly as fast as the
+ * emulator produces samples.
+ *===========================================================================*/
+
+static void WriteLE32(uint8_t* p, u32 v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
 
-        Uint32 remaining = sfx.length - sfx.position;
-        Uint32 toMix = (remaining < (Uint32)len) ? remaining : (Uint32)len;
+static void WriteLE16(uint8_t* p, u16 v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8);
+}
 
-        SDL_MixAudioFormat(
-            stream,
-            sfx.data + sfx.position,
-            AUDIO_S16SYS,
-            toMix,
-            SDL_MIX_MAXVOLUME
-        );
+/* 16-bit stereo PCM header; sizes are patched in when the file closes */
+static void WriteWavHeader(FILE* f, u32 rate, u32 dataBytes) {
+    uint8_t h[44];
+    memcpy(h, "RIFF", 4);
+    WriteLE32(h + 4, 36 + dataBytes);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    WriteLE32(h + 16, 16);
+    WriteLE16(h + 20, 1);
+    WriteLE16(h + 22, 2);
+    WriteLE32(h + 24, rate);
+    WriteLE32(h + 28, rate * 4);
+    WriteLE16(h + 32, 4);
+    WriteLE16(h + 34, 16);
+    memcpy(h + 36, "data", 4);
+    WriteLE32(h + 40, dataBytes);
+    fwrite(h, 1, sizeof(h), f);
+}
 
-        sfx.position += toMix;
-        if (sfx.position >= sfx.length) {
-            sfx.playing = false;
-            sfx.position = 0;
+/**
+ * @brief Open the WAV sink for a ROM session
+ *
+ * The first session of the process truncates the file. Later sessions with
+ * the same path and rate append to it, so a capture spanning several
+ * RomOpen/RomClosed cycles ends up in one file; a file from an earlier
+ * process is always overwritten.
+ */
+static void OpenWavSink(void) {
+    if (!g_headless || g_wavFile || g_config.headless_wav_path[0] == '\0') return;
+
+    char msg[320];
+    const u32 rate = (u32)g_obtainedSpec.freq;
+    if (rate == g_wavCreatedRate && strcmp(g_wavCreatedPath, g_config.headless_wav_path) == 0) {
+        g_wavFile = fopen(g_config.headless_wav_path, "r+b");
+        if (g_wavFile && fseek(g_wavFile, 0, SEEK_END) == 0) {
+            const long end = ftell(g_wavFile);
+            if (end >= 44) {
+                g_wavBytes = (u64)(end - 44);
+                sprintf(msg, "Appending headless output to %.260s", g_config.headless_wav_path);
+                AudioLog(msg);
+                return;
+            }
         }
-        };
+        if (g_wavFile) fclose(g_wavFile);
+    }
 
-    mixSFX(g_sfx_itemPickup);
-    mixSFX(g_sfx_powerupPickup);
-    mixSFX(g_sfx_goldPickup);   // NEW
+    g_wavFile = fopen(g_config.headless_wav_path, "wb");
+    if (!g_wavFile) {
+        sprintf(msg, "Could not open WAV output: %.260s", g_config.headless_wav_path);
+        AudioLog(msg);
+        return;
+    }
+    WriteWavHeader(g_wavFile, rate, 0);
+    g_wavBytes = 0;
+    strncpy(g_wavCreatedPath, g_config.headless_wav_path, sizeof(g_wavCreatedPath) - 1);
+    g_wavCreatedRate = rate;
+    sprintf(msg, "Writing headless output to %.260s", g_config.headless_wav_path);
+    AudioLog(msg);
+}
 
-    SDL_UnlockMutex(g_audio.mutex);
+static void CloseWavSink(void) {
+    if (!g_wavFile) return;
+    /* RIFF sizes are 32-bit; very long captures keep the data but clamp
+     * the header */
+    const u32 dataBytes = (u32)(std::min)(g_wavBytes, (u64)0xFFFFFFFFu - 36);
+    fseek(g_wavFile, 0, SEEK_SET);
+    WriteWavHeader(g_wavFile, (u32)g_obtainedSpec.freq, dataBytes);
+    fclose(g_wavFile);
+    g_wavFile = nullptr;
+}
+
+static void DrainHeadless(void) {
+    for (;;) {
+        const u32 produced = ResampleFrames(g_headlessBuffer, HEADLESS_BLOCK_FRAMES, false);
+        if (produced == 0) break;
+        FinishFrames(g_headlessBuffer, produced, produced);
+
+        if (g_wavFile) {
+            const u64 startNs = NowNs();
+            g_wavBytes += fwrite(g_headlessBuffer, 1, (size_t)produced * 4, g_wavFile);
+            AddStageTime(STAGE_SINK, startNs);
+        }
+        if (produced < HEADLESS_BLOCK_FRAMES) break;
+    }
+}
+
+static void ResetPipelineStats(void) {
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        g_stageNs[i].store(0, std::memory_order_relaxed);
+    }
+    g_framesQueued.store(0, std::memory_order_relaxed);
+    g_framesRendered.store(0, std::memory_order_relaxed);
+    g_statsStartNs.store(NowNs(), std::memory_order_relaxed);
+}
+
+static void LogPipelineStats(void) {
+    CV64_AudioPipelineStats st;
+    CV64_Audio_GetPipelineStats(&st);
+    if (st.frames_rendered == 0) return;
+
+    char msg[256];
+    sprintf(msg, "Pipeline: %.0f frames/s (%.1fx realtime, limiter %s), queue %.0f us, resample %.0f us, mix %.0f us, sink %.0f us",
+        st.frames_per_second, st.realtime_factor, st.speed_limiter_off ? "off" : "on",
+        st.queue_us, st.resample_us, st.mix_us, st.sink_us);
+    AudioLog(msg);
 }
 
 /*===========================================================================
@@ -277,6 +518,7 @@ extern "C" {
         }
 
         g_audio.frequency = f;
+        g_sourceRate.store(f, std::memory_order_relaxed);
     }
 
     void cv64audio_AiLenChanged(void) {
@@ -288,58 +530,72 @@ extern "C" {
         if (length == 0) return;
 
         uint8_t* source = (uint8_t*)(g_audio.audioInfo.RDRAM + address);
+        const u64 startNs = NowNs();
 
-        if (CV64_Threading_IsAsyncGraphicsEnabled()) {
+        /* Whatever doesn't fit is dropped and counted as an overrun */
+        if (CV64_Threading_IsAsyncAudioEnabled()) {
             int16_t* samples = (int16_t*)source;
             size_t sampleCount = length / 2;
 
-            if (CV64_Audio_QueueSamples(samples, sampleCount, g_audio.frequency)) {
-                CV64_Audio_OnDMAComplete();
-                return;
-            }
+            CV64_Audio_QueueSamples(samples, sampleCount, g_audio.frequency);
+            CV64_Audio_OnDMAComplete();
+        }
+        else {
+            g_audioRing.Write(source, length);
         }
 
-        SDL_LockMutex(g_audio.mutex);
-
-        int available = g_audio.bufferSize - g_audio.bufferLevel;
-        int toCopy = ((int)length < available) ? (int)length : available;
+        g_framesQueued.fetch_add(length / 4, std::memory_order_relaxed);
+        AddStageTime(STAGE_QUEUE, startNs);
 
-        if (toCopy > 0) {
-            int firstPart = g_audio.bufferSize - g_audio.writePos;
-            if (firstPart >= toCopy) {
-                memcpy(g_audio.buffer + g_audio.writePos, source, toCopy);
-                g_audio.writePos = (g_audio.writePos + toCopy) % g_audio.bufferSize;
-            }
-            else {
-                memcpy(g_audio.buffer + g_audio.writePos, source, firstPart);
-                memcpy(g_audio.buffer, source + firstPart, toCopy - firstPart);
-                g_audio.writePos = toCopy - firstPart;
-            }
-            g_audio.bufferLevel += toCopy;
+        if (g_headless) {
+            DrainHeadless();
         }
-
-        SDL_UnlockMutex(g_audio.mutex);
     }
 
     int cv64audio_InitiateAudio(AUDIO_INFO Audio_Info) {
         g_audio.audioInfo = Audio_Info;
 
+        if (!g_audio.initialized && g_config.backend == CV64_AUDIO_BACKEND_HEADLESS) {
+            if (!g_audioRing.Init(AUDIO_BUFFER_SIZE)) {
+                return 0;
+            }
+
+            /* No device: describe the output the headless sink renders */
+            memset(&g_obtainedSpec, 0, sizeof(g_obtainedSpec));
+            g_obtainedSpec.freq = g_config.sample_rate ? (int)g_config.sample_rate : DEVICE_FREQUENCY;
+            g_obtainedSpec.format = AUDIO_S16SYS;
+            g_obtainedSpec.channels = 2;
+            g_obtainedSpec.samples = HEADLESS_BLOCK_FRAMES;
+
+            char msg[160];
+            sprintf(msg, "Headless output %d Hz, %s resampler",
+                g_obtainedSpec.freq, CV64_AudioResampler::KernelName());
+            AudioLog(msg);
+
+            g_headless = true;
+            g_audio.initialized = true;
+
+            LoadSFX(CV64_SFX_ITEM_PICKUP, "ItemPickup.wav");
+            LoadSFX(CV64_SFX_POWERUP_PICKUP, "PowerUpPickup.wav");
+            LoadSFX(CV64_SFX_GOLD_PICKUP, "GoldPickup.wav");
+        }
+
+        /* Every other backend value goes through SDL */
         if (!g_audio.initialized) {
             if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
                 return 0;
             }
 
-            g_audio.mutex = SDL_CreateMutex();
-            g_audio.bufferSize = AUDIO_BUFFER_SIZE;
-            g_audio.buffer = (uint8_t*)malloc(g_audio.bufferSize);
-            memset(g_audio.buffer, 0, g_audio.bufferSize);
+            if (!g_audioRing.Init(AUDIO_BUFFER_SIZE)) {
+                return 0;
+            }
 
             SDL_AudioSpec desired, obtained;
             memset(&desired, 0, sizeof(desired));
-            desired.freq = 44100;
+            desired.freq = g_config.sample_rate ? (int)g_config.sample_rate : DEVICE_FREQUENCY;
             desired.format = AUDIO_S16SYS;
             desired.channels = 2;
-            desired.samples = SDL_AUDIO_SAMPLES;
+            desired.samples = DeviceBufferSamples(desired.freq);
             desired.callback = AudioCallback;
 
             g_audio.deviceId = SDL_OpenAudioDevice(nullptr, 0, &desired, &obtained, 0);
@@ -349,11 +605,17 @@ extern "C" {
 
             g_obtainedSpec = obtained;
 
+            char msg[160];
+            sprintf(msg, "Device %d Hz, %u-frame buffer, %u ms target latency, %s resampler",
+                obtained.freq, (unsigned)obtained.samples, g_latencyMs.load(),
+                CV64_AudioResampler::KernelName());
+            AudioLog(msg);
+
             g_audio.initialized = true;
 
-            LoadSFX(g_sfx_itemPickup, "ItemPickup.wav");
-            LoadSFX(g_sfx_powerupPickup, "PowerUpPickup.wav");
-            LoadSFX(g_sfx_goldPickup, "GoldPickup.wav");   // NEW
+            LoadSFX(CV64_SFX_ITEM_PICKUP, "ItemPickup.wav");
+            LoadSFX(CV64_SFX_POWERUP_PICKUP, "PowerUpPickup.wav");
+            LoadSFX(CV64_SFX_GOLD_PICKUP, "GoldPickup.wav");
         }
 
         return 1;
@@ -362,20 +624,38 @@ extern "C" {
     void cv64audio_ProcessAList(void) {}
 
     void cv64audio_RomClosed(void) {
+        /* Pausing guarantees the callback isn't running, so the ring can be
+         * reset from this thread without breaking the SPSC contract. */
         if (g_audio.deviceId) {
             SDL_PauseAudioDevice(g_audio.deviceId, 1);
         }
 
-        if (g_audio.mutex) {
-            SDL_LockMutex(g_audio.mutex);
-            g_audio.readPos = 0;
-            g_audio.writePos = 0;
-            g_audio.bufferLevel = 0;
-            if (g_audio.buffer) {
-                memset(g_audio.buffer, 0, g_audio.bufferSize);
-            }
-            SDL_UnlockMutex(g_audio.mutex);
-        }
+        char msg[192];
+        sprintf(msg, "Ring stats: %llu underruns, %llu overruns",
+            (unsigned long long)g_audioRing.Underruns(),
+            (unsigned long long)g_audioRing.Overruns());
+        AudioLog(msg);
+        g_audioRing.Reset();
+
+        sprintf(msg, "Resampler stats: %llu underruns, %llu resyncs, rate adjust %+.3f%%",
+            (unsigned long long)g_resampleUnderruns.exchange(0),
+            (unsigned long long)g_resyncs.exchange(0),
+            g_resampler.RateAdjust() * 100.0);
+        AudioLog(msg);
+        g_resampler.Reset();
+        g_priming = true;
+
+        LogPipelineStats();
+        CloseWavSink();
+
+        CV64_MixerStats mixStats;
+        CV64_Mixer_GetStats(&mixStats);
+        sprintf(msg, "SFX stats: %llu played, %llu dropped, peak %u voices, peak mix %.1f us",
+            (unsigned long long)mixStats.voicesStarted,
+            (unsigned long long)mixStats.voicesDropped,
+            mixStats.peakVoices, mixStats.peakMixMicros);
+        AudioLog(msg);
+        CV64_Mixer_Reset();
 
         g_audio.romOpen = false;
     }
@@ -383,9 +663,11 @@ extern "C" {
     int cv64audio_RomOpen(void) {
         g_audio.romOpen = true;
         g_audio.frequency = DEFAULT_FREQUENCY;
-        g_audio.readPos = 0;
-        g_audio.writePos = 0;
-        g_audio.bufferLevel = 0;
+        g_sourceRate.store(DEFAULT_FREQUENCY, std::memory_order_relaxed);
+        g_audioRing.Reset();
+
+        ResetPipelineStats();
+        OpenWavSink();
 
         if (g_audio.deviceId) {
             SDL_PauseAudioDevice(g_audio.deviceId, 0);
@@ -434,18 +716,13 @@ extern "C" {
             g_audio.deviceId = 0;
         }
 
-        if (g_audio.mutex) {
-            SDL_DestroyMutex(g_audio.mutex);
-            g_audio.mutex = nullptr;
-        }
-
-        if (g_audio.buffer) {
-            free(g_audio.buffer);
-            g_audio.buffer = nullptr;
-        }
+        CloseWavSink();
+        g_audioRing.Release();
+        CV64_Mixer_Shutdown();
 
         if (g_audio.initialized) {
-            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            if (!g_headless) SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            g_headless = false;
             g_audio.initialized = false;
         }
     }
@@ -456,20 +733,81 @@ extern "C" {
 
     void CV64_PlayItemPickupSFX()
     {
-        g_sfx_itemPickup.position = 0;
-        g_sfx_itemPickup.playing = true;
+        CV64_Audio_PlaySFX(CV64_SFX_ITEM_PICKUP);
     }
 
     void CV64_PlayPowerupPickupSFX()
     {
-        g_sfx_powerupPickup.position = 0;
-        g_sfx_powerupPickup.playing = true;
+        CV64_Audio_PlaySFX(CV64_SFX_POWERUP_PICKUP);
+    }
+
+    void CV64_PlayGoldPickupSFX()
+    {
+        CV64_Audio_PlaySFX(CV64_SFX_GOLD_PICKUP);
+    }
+
+    /*===========================================================================
+     * Public Configuration API
+     *===========================================================================*/
+
+    CV64_AudioConfig* CV64_Audio_GetConfig(void)
+    {
+        return &g_config;
+    }
+
+    /* latency_ms and the volumes apply immediately; sample_rate and
+     * buffer_size are read when the device is opened */
+    bool CV64_Audio_ApplyConfig(void)
+    {
+        if (g_config.latency_ms == 0) g_config.latency_ms = DEFAULT_LATENCY_MS;
+        g_config.latency_ms = (std::max)((u32)MIN_LATENCY_MS, (std::min)(g_config.latency_ms, (u32)MAX_LATENCY_MS));
+        g_latencyMs.store(g_config.latency_ms, std::memory_order_relaxed);
+
+        g_audio.volume = (int)((std::max)(0.0f, (std::min)(g_config.master_volume, 1.0f)) * 100.0f + 0.5f);
+        CV64_Audio_SetSFXMasterVolume(g_config.sfx_volume);
+        return true;
+    }
+
+    /*===========================================================================
+     * Public Pipeline Statistics API
+     *===========================================================================*/
+
+    void CV64_Audio_GetPipelineStats(CV64_AudioPipelineStats* stats)
+    {
+        if (!stats) return;
+        memset(stats, 0, sizeof(*stats));
+
+        stats->backend = g_headless ? CV64_AUDIO_BACKEND_HEADLESS : CV64_AUDIO_BACKEND_SDL;
+        stats->source_rate = (u32)g_sourceRate.load(std::memory_order_relaxed);
+        stats->device_rate = (u32)g_obtainedSpec.freq;
+        stats->frames_queued = g_framesQueued.load(std::memory_order_relaxed);
+        stats->frames_rendered = g_framesRendered.load(std::memory_order_relaxed);
+
+        const u64 startNs = g_statsStartNs.load(std::memory_order_relaxed);
+        stats->wall_seconds = startNs ? (NowNs() - startNs) / 1e9 : 0.0;
+        if (stats->wall_seconds > 0.0) {
+            stats->frames_per_second = stats->frames_rendered / stats->wall_seconds;
+            if (stats->device_rate) {
+                stats->realtime_factor = stats->frames_per_second / stats->device_rate;
+            }
+        }
+
+        stats->queue_us = g_stageNs[STAGE_QUEUE].load(std::memory_order_relaxed) / 1000.0;
+        stats->resample_us = g_stageNs[STAGE_RESAMPLE].load(std::memory_order_relaxed) / 1000.0;
+        stats->mix_us = g_stageNs[STAGE_MIX].load(std::memory_order_relaxed) / 1000.0;
+        stats->sink_us = g_stageNs[STAGE_SINK].load(std::memory_order_relaxed) / 1000.0;
+        stats->wav_bytes = g_wavBytes;
+        stats->speed_limiter_off = g_speedLimiterOff.load(std::memory_order_relaxed);
+    }
+
+    void CV64_Audio_ResetPipelineStats(void)
+    {
+        ResetPipelineStats();
     }
 
-    void CV64_PlayGoldPickupSFX()   // NEW
+    void CV64_Audio_SetSpeedLimiterState(bool enabled)
     {
-        g_sfx_goldPickup.position = 0;
-        g_sfx_goldPickup.playing = true;
+        g_speedLimiterOff.store(!enabled, std::memory_order_relaxed);
     }
 
 } /* extern "C" */
@@ -1,11 +1,11 @@
 /**
  * @file cv64_bps_patch.cpp
  * @brief Castlevania 64 PC Recomp - BPS Patch Implementation
- * 
+ *
  * BPS (Beat Patch System) is a binary patch format commonly used for
  * ROM patches. This implementation supports automatic application of
  * any .bps files found in the patches folder.
- * 
+ *
  * BPS Format:
  * - Header: "BPS1" (4 bytes)
  * - Source size (variable-length encoded)
@@ -14,14 +14,32 @@
  * - Metadata (if any)
  * - Patch data (action bytes with lengths)
  * - Footer: source CRC32 (4), target CRC32 (4), patch CRC32 (4)
- * 
+ *
+ * Patch files are memory-mapped and decoded in place. Command runs are
+ * copied with memcpy, and the target CRC is folded in every
+ * BPS_CRC_CHUNK bytes while the freshly written output is still in cache,
+ * so there is no separate pass over the output. The CRCs of the inputs
+ * (every patch file and the initial ROM) do not depend on each other and
+ * are computed on worker threads before the chain starts; the source CRC
+ * of each later patch in a chain is the verified target CRC of the one
+ * before it.
+ *
+ * The result of patching from the patches folder is cached on disk (see
+ * BpsCacheHeader), so a repeat launch with the same ROM and patches costs
+ * one ROM CRC, a mapping and a hash check.
+ *
  * @copyright 2024 CV64 Recomp Team
  */
 
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "../include/cv64_bps_patch.h"
+#include "../include/cv64_hash.h"
+#include "../include/cv64_mapped_file.h"
+#include "../include/cv64_threading.h"
 #include <Windows.h>
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <filesystem>
@@ -36,6 +54,19 @@ static const char BPS_MAGIC[] = "BPS1";
 static const size_t BPS_MAGIC_SIZE = 4;
 static const size_t BPS_FOOTER_SIZE = 12; /* 3 x 4-byte CRCs */
 
+/** Output bytes written between target CRC updates (stays cache resident) */
+static const size_t BPS_CRC_CHUNK = 32 * 1024;
+
+/** Time the worker pool gets to start a queued CRC job before it is run inline */
+static const u32 BPS_CRC_WAIT_MS = 5;
+
+enum {
+    BPS_SOURCE_READ = 0,
+    BPS_TARGET_READ = 1,
+    BPS_SOURCE_COPY = 2,
+    BPS_TARGET_COPY = 3
+};
+
 /*===========================================================================
  * Helper Functions
  *===========================================================================*/
@@ -46,29 +77,8 @@ static void BpsLog(const char* msg) {
     OutputDebugStringA("\n");
 }
 
-/**
- * @brief Calculate CRC32 (standard polynomial)
- */
-static u32 BpsCalcCRC32(const u8* data, size_t size) {
-    static u32 crcTable[256] = {0};
-    static bool tableInit = false;
-    
-    if (!tableInit) {
-        for (u32 i = 0; i < 256; i++) {
-            u32 crc = i;
-            for (int j = 0; j < 8; j++) {
-                crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
-            }
-            crcTable[i] = crc;
-        }
-        tableInit = true;
-    }
-    
-    u32 crc = 0xFFFFFFFF;
-    for (size_t i = 0; i < size; i++) {
-        crc = (crc >> 8) ^ crcTable[(crc ^ data[i]) & 0xFF];
-    }
-    return crc ^ 0xFFFFFFFF;
+static u32 BpsLoadLE32(const u8* p) {
+    return (u32)p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
 }
 
 /**
@@ -77,7 +87,7 @@ static u32 BpsCalcCRC32(const u8* data, size_t size) {
 static u64 BpsReadVarInt(const u8*& ptr, const u8* end) {
     u64 result = 0;
     u64 shift = 1;
-    
+
     while (ptr < end) {
         u8 byte = *ptr++;
         result += (byte & 0x7F) * shift;
@@ -87,7 +97,7 @@ static u64 BpsReadVarInt(const u8*& ptr, const u8* end) {
         shift <<= 7;
         result += shift;
     }
-    
+
     return result;
 }
 
@@ -103,6 +113,224 @@ static s64 BpsReadSignedOffset(const u8*& ptr, const u8* end) {
     return offset;
 }
 
+/*===========================================================================
+ * Mapped Patch
+ *===========================================================================*/
+
+/**
+ * @brief A mapped patch file with its header parsed
+ */
+struct BpsPatch {
+    std::string path;
+    CV64_MappedFile file = {};
+    const u8* commands = nullptr;   /* First command after the metadata */
+    const u8* end = nullptr;        /* Start of the footer */
+    u64 sourceSize = 0;
+    u64 targetSize = 0;
+    u64 metadataSize = 0;
+    u32 sourceCRC = 0;
+    u32 targetCRC = 0;
+    u32 patchCRC = 0;               /* From the footer */
+    u32 calcPatchCRC = 0;           /* Of the file minus its last 4 bytes */
+
+    BpsPatch() = default;
+    BpsPatch(const BpsPatch&) = delete;
+    BpsPatch& operator=(const BpsPatch&) = delete;
+    ~BpsPatch() { CV64_MappedFile_Close(&file); }
+};
+
+/**
+ * @brief Map a patch file and parse its header and footer (no CRC work)
+ */
+static CV64_BPS_Result BpsOpenPatch(const char* patchPath, BpsPatch* patch) {
+    patch->path = patchPath;
+    if (!CV64_MappedFile_Open(patchPath, &patch->file)) {
+        return CV64_BPS_ERROR_FILE_NOT_FOUND;
+    }
+
+    const u8* data = patch->file.data;
+    size_t size = patch->file.size;
+    if (size < BPS_MAGIC_SIZE + BPS_FOOTER_SIZE) {
+        return CV64_BPS_ERROR_INVALID_HEADER;
+    }
+    if (memcmp(data, BPS_MAGIC, BPS_MAGIC_SIZE) != 0) {
+        return CV64_BPS_ERROR_INVALID_HEADER;
+    }
+
+    const u8* ptr = data + BPS_MAGIC_SIZE;
+    const u8* end = data + size - BPS_FOOTER_SIZE;
+    patch->sourceSize = BpsReadVarInt(ptr, end);
+    patch->targetSize = BpsReadVarInt(ptr, end);
+    patch->metadataSize = BpsReadVarInt(ptr, end);
+    if (patch->metadataSize > (u64)(end - ptr)) {
+        return CV64_BPS_ERROR_INVALID_HEADER;
+    }
+    patch->commands = ptr + patch->metadataSize;
+    patch->end = end;
+
+    patch->sourceCRC = BpsLoadLE32(end);
+    patch->targetCRC = BpsLoadLE32(end + 4);
+    patch->patchCRC = BpsLoadLE32(end + 8);
+    return CV64_BPS_SUCCESS;
+}
+
+static void BpsFillInfo(const BpsPatch& patch, CV64_BPS_PatchInfo* info) {
+    strncpy(info->filename, patch.path.c_str(), sizeof(info->filename) - 1);
+    info->sourceSize = (u32)patch.sourceSize;
+    info->targetSize = (u32)patch.targetSize;
+    info->sourceCRC = patch.sourceCRC;
+    info->targetCRC = patch.targetCRC;
+    info->patchCRC = patch.patchCRC;
+}
+
+/*===========================================================================
+ * Parallel CRC Verification
+ *===========================================================================*/
+
+struct BpsCrcJob {
+    const u8* data;
+    size_t size;
+    u32* result;
+};
+
+static void* BpsCrcTask(void* param) {
+    BpsCrcJob* job = (BpsCrcJob*)param;
+    *job->result = CV64_Hash_CRC32(job->data, job->size);
+    return nullptr;
+}
+
+/**
+ * @brief CRC independent buffers concurrently
+ *
+ * A queued job no worker has started within BPS_CRC_WAIT_MS is run on the
+ * calling thread.
+ */
+static void BpsRunCrcJobs(std::vector<BpsCrcJob>& jobs) {
+    std::vector<void*> params;
+    params.reserve(jobs.size());
+    for (BpsCrcJob& job : jobs) {
+        params.push_back(&job);
+    }
+    CV64_Worker_RunAll(BpsCrcTask, params.data(), (u32)params.size(), BPS_CRC_WAIT_MS);
+}
+
+/*===========================================================================
+ * Decoder
+ *===========================================================================*/
+
+/**
+ * @brief Copy a source run, zero-filling the part outside the source
+ */
+static void BpsCopySource(u8* dst, const u8* src, size_t srcSize, s64 pos, size_t length) {
+    size_t done = 0;
+    if (pos < 0) {
+        done = (size_t)std::min<u64>((u64)-pos, length);
+        memset(dst, 0, done);
+    }
+    u64 start = (u64)(pos + (s64)done);
+    if (done < length && start < srcSize) {
+        size_t n = (size_t)std::min<u64>(length - done, srcSize - start);
+        memcpy(dst + done, src + start, n);
+        done += n;
+    }
+    if (done < length) {
+        memset(dst + done, 0, length - done);
+    }
+}
+
+/**
+ * @brief Decode a patch into an output buffer, computing the output CRC
+ *
+ * Out-of-range reads produce zero bytes rather than failing, so a patch
+ * made for a slightly different source still applies and is judged by
+ * its target CRC alone. Output beyond the last command is zero-filled.
+ *
+ * @param out Buffer of at least patch.targetSize bytes (not aliasing src)
+ * @param outCRC Receives the CRC-32 of the output
+ */
+static void BpsDecode(const BpsPatch& patch, const u8* src, size_t srcSize,
+                      u8* out, u32* outCRC) {
+    const u8* ptr = patch.commands;
+    const u8* end = patch.end;
+    const size_t targetSize = (size_t)patch.targetSize;
+
+    size_t outPos = 0;
+    size_t crcPos = 0;
+    u32 crc = 0;
+    s64 sourceRel = 0;
+    s64 targetRel = 0;
+
+    while (ptr < end && outPos < targetSize) {
+        u64 data = BpsReadVarInt(ptr, end);
+        const u32 action = (u32)(data & 3);
+        size_t length = (size_t)std::min<u64>((data >> 2) + 1, targetSize - outPos);
+
+        bool zeroRun = false;
+        switch (action) {
+            case BPS_TARGET_READ:
+                length = std::min(length, (size_t)(end - ptr));
+                break;
+            case BPS_SOURCE_COPY:
+                sourceRel += BpsReadSignedOffset(ptr, end);
+                break;
+            case BPS_TARGET_COPY:
+                targetRel += BpsReadSignedOffset(ptr, end);
+                zeroRun = targetRel < 0 || (u64)targetRel >= outPos;
+                break;
+        }
+
+        /* Copy in pieces that end on a CRC chunk boundary, so each chunk
+         * is folded into the CRC while it is still in cache */
+        while (length > 0) {
+            const size_t piece = std::min(length, BPS_CRC_CHUNK - (outPos - crcPos));
+            u8* to = out + outPos;
+
+            switch (action) {
+                case BPS_SOURCE_READ:
+                    BpsCopySource(to, src, srcSize, (s64)outPos, piece);
+                    break;
+
+                case BPS_TARGET_READ:
+                    memcpy(to, ptr, piece);
+                    ptr += piece;
+                    break;
+
+                case BPS_SOURCE_COPY:
+                    BpsCopySource(to, src, srcSize, sourceRel, piece);
+                    sourceRel += (s64)piece;
+                    break;
+
+                case BPS_TARGET_COPY:
+                    if (zeroRun) {
+                        memset(to, 0, piece);
+                    } else if (outPos - (size_t)targetRel >= piece) {
+                        memcpy(to, out + targetRel, piece);
+                    } else {
+                        /* Overlapping run: repeats the last (outPos - targetRel) bytes */
+                        const u8* from = out + targetRel;
+                        for (size_t i = 0; i < piece; i++) {
+                            to[i] = from[i];
+                        }
+                    }
+                    targetRel += (s64)piece;
+                    break;
+            }
+
+            outPos += piece;
+            length -= piece;
+            if (outPos - crcPos == BPS_CRC_CHUNK) {
+                crc = CV64_Hash_CRC32Update(crc, out + crcPos, BPS_CRC_CHUNK);
+                crcPos = outPos;
+            }
+        }
+    }
+
+    if (outPos < targetSize) {
+        memset(out + outPos, 0, targetSize - outPos);
+    }
+    *outCRC = CV64_Hash_CRC32Update(crc, out + crcPos, targetSize - crcPos);
+}
+
 /*===========================================================================
  * BPS Patch Application
  *===========================================================================*/
@@ -111,56 +339,26 @@ CV64_BPS_Result CV64_BPS_GetPatchInfo(const char* patchPath, CV64_BPS_PatchInfo*
     if (!patchPath || !info) {
         return CV64_BPS_ERROR_INVALID_DATA;
     }
-    
+
     memset(info, 0, sizeof(CV64_BPS_PatchInfo));
     strncpy(info->filename, patchPath, sizeof(info->filename) - 1);
-    
-    /* Read patch file */
-    FILE* patchFile = fopen(patchPath, "rb");
-    if (!patchFile) {
-        return CV64_BPS_ERROR_FILE_NOT_FOUND;
-    }
-    
-    fseek(patchFile, 0, SEEK_END);
-    size_t patchSize = ftell(patchFile);
-    fseek(patchFile, 0, SEEK_SET);
-    
-    if (patchSize < BPS_MAGIC_SIZE + BPS_FOOTER_SIZE) {
-        fclose(patchFile);
-        return CV64_BPS_ERROR_INVALID_HEADER;
-    }
-    
-    std::vector<u8> patchData(patchSize);
-    fread(patchData.data(), 1, patchSize, patchFile);
-    fclose(patchFile);
-    
-    /* Verify magic */
-    if (memcmp(patchData.data(), BPS_MAGIC, BPS_MAGIC_SIZE) != 0) {
-        return CV64_BPS_ERROR_INVALID_HEADER;
+
+    BpsPatch patch;
+    CV64_BPS_Result result = BpsOpenPatch(patchPath, &patch);
+    if (result != CV64_BPS_SUCCESS) {
+        return result;
     }
-    
-    /* Read header */
-    const u8* ptr = patchData.data() + BPS_MAGIC_SIZE;
-    const u8* end = patchData.data() + patchSize - BPS_FOOTER_SIZE;
-    
-    info->sourceSize = (u32)BpsReadVarInt(ptr, end);
-    info->targetSize = (u32)BpsReadVarInt(ptr, end);
-    
-    /* Read CRCs from footer */
-    const u8* footer = patchData.data() + patchSize - BPS_FOOTER_SIZE;
-    info->sourceCRC = footer[0] | (footer[1] << 8) | (footer[2] << 16) | (footer[3] << 24);
-    info->targetCRC = footer[4] | (footer[5] << 8) | (footer[6] << 16) | (footer[7] << 24);
-    info->patchCRC = footer[8] | (footer[9] << 8) | (footer[10] << 16) | (footer[11] << 24);
-    
+    BpsFillInfo(patch, info);
+
     /* Verify patch CRC */
-    u32 calcPatchCRC = BpsCalcCRC32(patchData.data(), patchSize - 4);
-    if (calcPatchCRC != info->patchCRC) {
+    u32 calcPatchCRC = CV64_Hash_CRC32(patch.file.data, patch.file.size - 4);
+    if (calcPatchCRC != patch.patchCRC) {
         char msg[256];
-        snprintf(msg, sizeof(msg), "Patch CRC mismatch: expected %08X, got %08X", info->patchCRC, calcPatchCRC);
+        snprintf(msg, sizeof(msg), "Patch CRC mismatch: expected %08X, got %08X", patch.patchCRC, calcPatchCRC);
         BpsLog(msg);
         return CV64_BPS_ERROR_INVALID_DATA;
     }
-    
+
     return CV64_BPS_SUCCESS;
 }
 
@@ -175,259 +373,450 @@ CV64_BPS_Result CV64_BPS_ApplyPatch(
     if (!patchPath || !sourceData || !outputData || !outputSize) {
         return CV64_BPS_ERROR_INVALID_DATA;
     }
-    
+
     char msg[512];
     snprintf(msg, sizeof(msg), "Applying BPS patch: %s", patchPath);
     BpsLog(msg);
-    
-    /* Read patch file */
-    FILE* patchFile = fopen(patchPath, "rb");
-    if (!patchFile) {
-        BpsLog("Patch file not found");
-        return CV64_BPS_ERROR_FILE_NOT_FOUND;
-    }
-    
-    fseek(patchFile, 0, SEEK_END);
-    size_t patchSize = ftell(patchFile);
-    fseek(patchFile, 0, SEEK_SET);
-    
-    if (patchSize < BPS_MAGIC_SIZE + BPS_FOOTER_SIZE) {
-        fclose(patchFile);
-        BpsLog("Patch file too small");
-        return CV64_BPS_ERROR_INVALID_HEADER;
-    }
-    
-    std::vector<u8> patchData(patchSize);
-    fread(patchData.data(), 1, patchSize, patchFile);
-    fclose(patchFile);
-    
-    /* Verify magic */
-    if (memcmp(patchData.data(), BPS_MAGIC, BPS_MAGIC_SIZE) != 0) {
-        BpsLog("Invalid BPS magic");
-        return CV64_BPS_ERROR_INVALID_HEADER;
+
+    BpsPatch patch;
+    CV64_BPS_Result result = BpsOpenPatch(patchPath, &patch);
+    if (result != CV64_BPS_SUCCESS) {
+        BpsLog(CV64_BPS_GetErrorMessage(result));
+        return result;
     }
-    
-    /* Verify patch CRC */
-    const u8* footer = patchData.data() + patchSize - BPS_FOOTER_SIZE;
-    u32 expectedPatchCRC = footer[8] | (footer[9] << 8) | (footer[10] << 16) | (footer[11] << 24);
-    u32 calcPatchCRC = BpsCalcCRC32(patchData.data(), patchSize - 4);
-    if (calcPatchCRC != expectedPatchCRC) {
-        snprintf(msg, sizeof(msg), "Patch CRC mismatch: expected %08X, got %08X", expectedPatchCRC, calcPatchCRC);
+
+    snprintf(msg, sizeof(msg), "BPS: source=%llu, target=%llu, metadata=%llu",
+             (unsigned long long)patch.sourceSize, (unsigned long long)patch.targetSize,
+             (unsigned long long)patch.metadataSize);
+    BpsLog(msg);
+
+    /* Patch and source CRCs are independent: verify them concurrently */
+    u32 calcSourceCRC = 0;
+    std::vector<BpsCrcJob> jobs = {
+        { patch.file.data, patch.file.size - 4, &patch.calcPatchCRC },
+        { sourceData, sourceSize, &calcSourceCRC }
+    };
+    BpsRunCrcJobs(jobs);
+
+    if (patch.calcPatchCRC != patch.patchCRC) {
+        snprintf(msg, sizeof(msg), "Patch CRC mismatch: expected %08X, got %08X", patch.patchCRC, patch.calcPatchCRC);
         BpsLog(msg);
         return CV64_BPS_ERROR_INVALID_DATA;
     }
-    
-    /* Read header */
-    const u8* ptr = patchData.data() + BPS_MAGIC_SIZE;
-    const u8* end = patchData.data() + patchSize - BPS_FOOTER_SIZE;
-    
-    u64 expectedSourceSize = BpsReadVarInt(ptr, end);
-    u64 expectedTargetSize = BpsReadVarInt(ptr, end);
-    u64 metadataSize = BpsReadVarInt(ptr, end);
-    
-    snprintf(msg, sizeof(msg), "BPS: source=%llu, target=%llu, metadata=%llu", 
-             expectedSourceSize, expectedTargetSize, metadataSize);
-    BpsLog(msg);
-    
-    /* Skip metadata */
-    ptr += metadataSize;
-    
+
     /* Verify source size */
-    if (sourceSize != expectedSourceSize) {
-        snprintf(msg, sizeof(msg), "Source size mismatch: expected %llu, got %zu", expectedSourceSize, sourceSize);
+    if (sourceSize != patch.sourceSize) {
+        snprintf(msg, sizeof(msg), "Source size mismatch: expected %llu, got %zu",
+                 (unsigned long long)patch.sourceSize, sourceSize);
         BpsLog(msg);
         /* Allow size mismatch - some patches work with slightly different ROMs */
         /* return CV64_BPS_ERROR_SIZE_MISMATCH; */
     }
-    
+
     /* Verify source CRC */
-    u32 expectedSourceCRC = footer[0] | (footer[1] << 8) | (footer[2] << 16) | (footer[3] << 24);
-    u32 calcSourceCRC = BpsCalcCRC32(sourceData, sourceSize);
-    if (calcSourceCRC != expectedSourceCRC) {
-        snprintf(msg, sizeof(msg), "Source CRC mismatch: expected %08X, got %08X", expectedSourceCRC, calcSourceCRC);
+    if (calcSourceCRC != patch.sourceCRC) {
+        snprintf(msg, sizeof(msg), "Source CRC mismatch: expected %08X, got %08X", patch.sourceCRC, calcSourceCRC);
         BpsLog(msg);
         /* Continue anyway - some patches work with different ROM versions */
     }
-    
+
     /* Check output buffer size */
-    if (*outputSize < expectedTargetSize) {
-        snprintf(msg, sizeof(msg), "Output buffer too small: need %llu, have %zu", expectedTargetSize, *outputSize);
+    if (*outputSize < patch.targetSize) {
+        snprintf(msg, sizeof(msg), "Output buffer too small: need %llu, have %zu",
+                 (unsigned long long)patch.targetSize, *outputSize);
         BpsLog(msg);
         return CV64_BPS_ERROR_MEMORY;
     }
-    
-    /* Apply patch */
-    size_t outputOffset = 0;
-    size_t sourceRelOffset = 0;
-    size_t targetRelOffset = 0;
-    
-    while (ptr < end && outputOffset < expectedTargetSize) {
-        u64 data = BpsReadVarInt(ptr, end);
-        u64 command = data & 3;
-        u64 length = (data >> 2) + 1;
-        
-        switch (command) {
-            case 0: /* SourceRead */
-                for (u64 i = 0; i < length && outputOffset < expectedTargetSize; i++) {
-                    if (outputOffset < sourceSize) {
-                        outputData[outputOffset] = sourceData[outputOffset];
-                    }
-                    outputOffset++;
-                }
-                break;
-                
-            case 1: /* TargetRead */
-                for (u64 i = 0; i < length && outputOffset < expectedTargetSize && ptr < end; i++) {
-                    outputData[outputOffset++] = *ptr++;
-                }
-                break;
-                
-            case 2: /* SourceCopy */
-                {
-                    s64 offset = BpsReadSignedOffset(ptr, end);
-                    sourceRelOffset += offset;
-                    for (u64 i = 0; i < length && outputOffset < expectedTargetSize; i++) {
-                        if (sourceRelOffset < sourceSize) {
-                            outputData[outputOffset] = sourceData[sourceRelOffset];
-                        }
-                        outputOffset++;
-                        sourceRelOffset++;
-                    }
-                }
-                break;
-                
-            case 3: /* TargetCopy */
-                {
-                    s64 offset = BpsReadSignedOffset(ptr, end);
-                    targetRelOffset += offset;
-                    for (u64 i = 0; i < length && outputOffset < expectedTargetSize; i++) {
-                        if (targetRelOffset < outputOffset) {
-                            outputData[outputOffset] = outputData[targetRelOffset];
-                        }
-                        outputOffset++;
-                        targetRelOffset++;
-                    }
-                }
-                break;
-        }
-    }
-    
-    *outputSize = (size_t)expectedTargetSize;
-    
-    /* Verify output CRC */
-    u32 expectedTargetCRC = footer[4] | (footer[5] << 8) | (footer[6] << 16) | (footer[7] << 24);
-    u32 calcTargetCRC = BpsCalcCRC32(outputData, *outputSize);
-    if (calcTargetCRC != expectedTargetCRC) {
-        snprintf(msg, sizeof(msg), "Target CRC mismatch: expected %08X, got %08X", expectedTargetCRC, calcTargetCRC);
+
+    /* Apply patch; the target CRC comes out of the decoder */
+    u32 calcTargetCRC = 0;
+    BpsDecode(patch, sourceData, sourceSize, outputData, &calcTargetCRC);
+    *outputSize = (size_t)patch.targetSize;
+
+    if (calcTargetCRC != patch.targetCRC) {
+        snprintf(msg, sizeof(msg), "Target CRC mismatch: expected %08X, got %08X", patch.targetCRC, calcTargetCRC);
         BpsLog(msg);
         return CV64_BPS_ERROR_OUTPUT_MISMATCH;
     }
-    
+
     /* Fill info if provided */
     if (info) {
-        strncpy(info->filename, patchPath, sizeof(info->filename) - 1);
-        info->sourceSize = (u32)expectedSourceSize;
-        info->targetSize = (u32)expectedTargetSize;
-        info->sourceCRC = expectedSourceCRC;
-        info->targetCRC = expectedTargetCRC;
-        info->patchCRC = expectedPatchCRC;
-    }
-    
+        BpsFillInfo(patch, info);
+    }
+
     snprintf(msg, sizeof(msg), "BPS patch applied successfully! Output size: %zu", *outputSize);
     BpsLog(msg);
-    
+
     return CV64_BPS_SUCCESS;
 }
 
-CV64_BPS_Result CV64_BPS_ApplyPatches(u8* romData, size_t* romSize, size_t maxSize) {
-    if (!romData || !romSize || maxSize == 0) {
+/**
+ * @brief Apply opened patches as a chain (see CV64_BPS_ApplyPatchList)
+ *
+ * @param status Per-patch open result; patches that are then skipped get
+ *               the reason (source mismatch, memory, output mismatch)
+ * @param knownRomCRC CRC of the initial ROM if the caller already has it
+ * @param resultCRC Receives the CRC of the ROM after the chain
+ * @return Number of patches applied
+ */
+static u32 BpsApplyChain(std::vector<BpsPatch>& patches, std::vector<CV64_BPS_Result>& status,
+                         u8* romData, size_t* romSize, size_t maxSize,
+                         const u32* knownRomCRC, u32* resultCRC) {
+    auto startTime = std::chrono::steady_clock::now();
+    char msg[512];
+    u32 patchCount = (u32)patches.size();
+
+    /* CRC the initial ROM and every readable patch concurrently */
+    u32 romCRC = knownRomCRC ? *knownRomCRC : 0;
+    std::vector<BpsCrcJob> jobs;
+    if (!knownRomCRC) {
+        jobs.push_back({ romData, *romSize, &romCRC });
+    }
+    for (u32 i = 0; i < patchCount; i++) {
+        if (status[i] == CV64_BPS_SUCCESS) {
+            jobs.push_back({ patches[i].file.data, patches[i].file.size - 4, &patches[i].calcPatchCRC });
+        }
+    }
+    BpsRunCrcJobs(jobs);
+
+    /*
+     * Chain: each patch reads the current buffer and writes the other one.
+     * romData is one side of the ping-pong, so the result is copied at most
+     * once at the end instead of after every patch.
+     */
+    std::vector<u8> tempBuffer;
+    u8* current = romData;
+    size_t currentSize = *romSize;
+    u32 applied = 0;
+
+    for (u32 i = 0; i < patchCount; i++) {
+        BpsPatch& patch = patches[i];
+        std::string name = std::filesystem::path(patch.path).filename().string();
+
+        snprintf(msg, sizeof(msg), "Processing: %s", name.c_str());
+        BpsLog(msg);
+
+        if (status[i] == CV64_BPS_SUCCESS && patch.calcPatchCRC != patch.patchCRC) {
+            snprintf(msg, sizeof(msg), "Patch CRC mismatch: expected %08X, got %08X", patch.patchCRC, patch.calcPatchCRC);
+            BpsLog(msg);
+            status[i] = CV64_BPS_ERROR_INVALID_DATA;
+        }
+        if (status[i] != CV64_BPS_SUCCESS) {
+            snprintf(msg, sizeof(msg), "Failed to read patch info: %s", CV64_BPS_GetErrorMessage(status[i]));
+            BpsLog(msg);
+            continue; /* Skip invalid patches */
+        }
+
+        snprintf(msg, sizeof(msg), "Patch expects source size=%llu, CRC=%08X",
+                 (unsigned long long)patch.sourceSize, patch.sourceCRC);
+        BpsLog(msg);
+
+        /* Check if this patch is for our ROM (by CRC) */
+        if (romCRC != patch.sourceCRC) {
+            snprintf(msg, sizeof(msg), "ROM CRC %08X doesn't match patch source CRC %08X, skipping", romCRC, patch.sourceCRC);
+            BpsLog(msg);
+            status[i] = CV64_BPS_ERROR_SOURCE_MISMATCH;
+            continue;
+        }
+
+        if (patch.targetSize > maxSize) {
+            snprintf(msg, sizeof(msg), "Failed to apply %s: %s (need %llu, have %zu)", name.c_str(),
+                     CV64_BPS_GetErrorMessage(CV64_BPS_ERROR_MEMORY),
+                     (unsigned long long)patch.targetSize, maxSize);
+            BpsLog(msg);
+            status[i] = CV64_BPS_ERROR_MEMORY;
+            continue;
+        }
+
+        if (tempBuffer.empty()) {
+            tempBuffer.resize(maxSize);
+        }
+        u8* other = (current == romData) ? tempBuffer.data() : romData;
+
+        u32 targetCRC = 0;
+        BpsDecode(patch, current, currentSize, other, &targetCRC);
+        if (targetCRC != patch.targetCRC) {
+            /* The current buffer is untouched; carry on with the next patch */
+            snprintf(msg, sizeof(msg), "Failed to apply %s: %s (expected %08X, got %08X)", name.c_str(),
+                     CV64_BPS_GetErrorMessage(CV64_BPS_ERROR_OUTPUT_MISMATCH), patch.targetCRC, targetCRC);
+            BpsLog(msg);
+            status[i] = CV64_BPS_ERROR_OUTPUT_MISMATCH;
+            continue;
+        }
+
+        current = other;
+        currentSize = (size_t)patch.targetSize;
+        romCRC = targetCRC;
+        applied++;
+
+        snprintf(msg, sizeof(msg), "Successfully applied: %s", name.c_str());
+        BpsLog(msg);
+    }
+
+    if (current != romData) {
+        memcpy(romData, current, currentSize);
+    }
+    *romSize = currentSize;
+    *resultCRC = romCRC;
+
+    f64 ms = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    snprintf(msg, sizeof(msg), "Applied %u of %u patch(es) in %.2f ms, ROM CRC %08X",
+             applied, patchCount, ms, romCRC);
+    BpsLog(msg);
+
+    return applied;
+}
+
+CV64_BPS_Result CV64_BPS_ApplyPatchList(const char* const* patchPaths, u32 patchCount,
+                                         u8* romData, size_t* romSize, size_t maxSize) {
+    if (!patchPaths || !romData || !romSize || maxSize == 0) {
         return CV64_BPS_ERROR_INVALID_DATA;
     }
-    
-    BpsLog("Scanning for BPS patches...");
-    
+    if (patchCount == 0) {
+        return CV64_BPS_NO_PATCHES_FOUND;
+    }
+
+    /* Map every patch up front */
+    std::vector<BpsPatch> patches(patchCount);
+    std::vector<CV64_BPS_Result> status(patchCount);
+    for (u32 i = 0; i < patchCount; i++) {
+        status[i] = BpsOpenPatch(patchPaths[i], &patches[i]);
+    }
+
+    u32 resultCRC = 0;
+    u32 applied = BpsApplyChain(patches, status, romData, romSize, maxSize, nullptr, &resultCRC);
+    if (applied == 0) {
+        /* Nothing applied: report why the first patch was skipped */
+        return status[0];
+    }
+    return CV64_BPS_SUCCESS;
+}
+
+/*===========================================================================
+ * Patched ROM Cache
+ *===========================================================================*/
+
+static const char BPS_CACHE_MAGIC[8] = { 'C', 'V', '6', '4', 'B', 'P', 'C', '1' };
+static const u32 BPS_CACHE_VERSION = 1;
+
+/**
+ * @brief Header of a cache entry, followed by resultSize bytes of ROM
+ */
+struct BpsCacheHeader {
+    char magic[8];
+    u32 version;
+    u32 patchCount;
+    u64 key;                /* XXH3 of the key record (see BpsCacheKey) */
+    u32 sourceCRC;
+    u32 resultCRC;          /* CRC-32 of the patched ROM */
+    u64 sourceSize;
+    u64 resultSize;         /* ROM bytes stored after the header */
+    u64 resultHash;         /* XXH3 of the stored ROM, checked on every hit */
+    u32 applied;            /* Patches applied; 0 means the ROM is unchanged and not stored */
+    u32 reserved;
+};
+static_assert(sizeof(BpsCacheHeader) == 64, "BpsCacheHeader layout changed");
+
+/**
+ * @brief Cache key: source ROM plus the ordered patch list
+ *
+ * Patches are identified by the CRC stored in their footer and their file
+ * size, which needs only the last page of each file. maxSize is included
+ * because it decides whether a growing patch can apply at all.
+ */
+static u64 BpsCacheKey(const std::vector<BpsPatch>& patches, const std::vector<CV64_BPS_Result>& status,
+                       u32 romCRC, size_t romSize, size_t maxSize) {
+    std::vector<u64> record;
+    record.push_back(((u64)BPS_CACHE_VERSION << 32) | (u64)patches.size());
+    record.push_back((u64)romCRC);
+    record.push_back((u64)romSize);
+    record.push_back((u64)maxSize);
+    for (size_t i = 0; i < patches.size(); i++) {
+        record.push_back(((u64)status[i] << 32) | patches[i].patchCRC);
+        record.push_back((u64)patches[i].file.size);
+    }
+    return CV64_Hash_XXH3(record.data(), record.size() * sizeof(u64));
+}
+
+/**
+ * @brief Load a cache entry into the ROM buffer if it matches and verifies
+ * @return true on a hit (romData/romSize updated when patches had applied)
+ */
+static bool BpsCacheLoad(const std::filesystem::path& entryPath, u64 key, u32 romCRC,
+                         u8* romData, size_t* romSize, size_t maxSize, BpsCacheHeader* header) {
+    CV64_MappedFile file;
+    if (!CV64_MappedFile_Open(entryPath.string().c_str(), &file)) {
+        return false;
+    }
+
+    bool valid = file.size >= sizeof(BpsCacheHeader);
+    if (valid) {
+        memcpy(header, file.data, sizeof(BpsCacheHeader));
+        u64 stored = header->applied ? header->resultSize : 0;
+        valid = memcmp(header->magic, BPS_CACHE_MAGIC, sizeof(BPS_CACHE_MAGIC)) == 0 &&
+                header->version == BPS_CACHE_VERSION &&
+                header->key == key &&
+                header->sourceCRC == romCRC &&
+                header->sourceSize == *romSize &&
+                header->resultSize <= maxSize &&
+                file.size - sizeof(BpsCacheHeader) == stored;
+    }
+
+    if (valid && header->applied) {
+        const u8* rom = file.data + sizeof(BpsCacheHeader);
+        size_t size = (size_t)header->resultSize;
+        valid = CV64_Hash_XXH3(rom, size) == header->resultHash;
+        if (valid) {
+            memcpy(romData, rom, size);
+            *romSize = size;
+        } else {
+            BpsLog("Patched ROM cache entry failed hash check, discarding");
+        }
+    }
+
+    CV64_MappedFile_Close(&file);
+    return valid;
+}
+
+/**
+ * @brief Write a cache entry, replacing any entry for another key
+ */
+static void BpsCacheStore(const std::filesystem::path& cacheDir, const std::filesystem::path& entryPath,
+                          const BpsCacheHeader& header, const u8* rom) {
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir, ec);
+
+    /* Only the current patch set is worth keeping */
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDir, ec)) {
+        std::string name = entry.path().filename().string();
+        if (entry.path() != entryPath && name.rfind("patched_", 0) == 0) {
+            std::filesystem::remove(entry.path(), ec);
+        }
+    }
+
+    std::filesystem::path tempPath = entryPath;
+    tempPath += ".tmp";
+
+    FILE* f = fopen(tempPath.string().c_str(), "wb");
+    if (!f) {
+        BpsLog("Could not write patched ROM cache");
+        return;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && header.applied) {
+        ok = fwrite(rom, 1, (size_t)header.resultSize, f) == (size_t)header.resultSize;
+    }
+    ok = (fclose(f) == 0) && ok;
+
+    if (ok) {
+        std::filesystem::rename(tempPath, entryPath, ec);
+        ok = !ec;
+    }
+    if (!ok) {
+        std::filesystem::remove(tempPath, ec);
+        BpsLog("Could not write patched ROM cache");
+    }
+}
+
+/**
+ * @brief List the .bps files in the patches folder, sorted by name
+ * @return false if the folder does not exist
+ */
+static bool BpsFindPatches(std::filesystem::path* patchesDir, std::vector<std::string>* bpsFiles) {
     /* Get patches directory */
     char exePath[MAX_PATH];
     GetModuleFileNameA(NULL, exePath, MAX_PATH);
     std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
-    std::filesystem::path patchesDir = exeDir / "patches";
-    
-    if (!std::filesystem::exists(patchesDir)) {
-        BpsLog("Patches directory not found");
-        return CV64_BPS_NO_PATCHES_FOUND;
+    *patchesDir = exeDir / "patches";
+
+    std::error_code ec;
+    if (!std::filesystem::exists(*patchesDir, ec)) {
+        return false;
     }
-    
+
     /* Find all .bps files */
-    std::vector<std::filesystem::path> bpsFiles;
-    for (const auto& entry : std::filesystem::directory_iterator(patchesDir)) {
-        if (entry.is_regular_file() && entry.path().extension() == ".bps") {
-            bpsFiles.push_back(entry.path());
+    for (const auto& entry : std::filesystem::directory_iterator(*patchesDir, ec)) {
+        if (entry.is_regular_file(ec) && entry.path().extension() == ".bps") {
+            bpsFiles->push_back(entry.path().string());
         }
     }
-    
+
+    /* Apply in name order so a chain of dependent patches is reproducible */
+    std::sort(bpsFiles->begin(), bpsFiles->end());
+    return true;
+}
+
+bool CV64_BPS_HasPatches(void) {
+    std::filesystem::path patchesDir;
+    std::vector<std::string> bpsFiles;
+    return BpsFindPatches(&patchesDir, &bpsFiles) && !bpsFiles.empty();
+}
+
+CV64_BPS_Result CV64_BPS_ApplyPatches(u8* romData, size_t* romSize, size_t maxSize) {
+    if (!romData || !romSize || maxSize == 0) {
+        return CV64_BPS_ERROR_INVALID_DATA;
+    }
+
+    BpsLog("Scanning for BPS patches...");
+
+    std::filesystem::path patchesDir;
+    std::vector<std::string> bpsFiles;
+    if (!BpsFindPatches(&patchesDir, &bpsFiles)) {
+        BpsLog("Patches directory not found");
+        return CV64_BPS_NO_PATCHES_FOUND;
+    }
+
     if (bpsFiles.empty()) {
         BpsLog("No BPS patches found");
         return CV64_BPS_NO_PATCHES_FOUND;
     }
-    
+
     char msg[512];
     snprintf(msg, sizeof(msg), "Found %zu BPS patch(es)", bpsFiles.size());
     BpsLog(msg);
-    
-    /* Allocate temporary buffer for patching */
-    std::vector<u8> tempBuffer(maxSize);
-    
-    /* Apply patches in order */
-    for (const auto& patchFile : bpsFiles) {
-        snprintf(msg, sizeof(msg), "Processing: %s", patchFile.filename().string().c_str());
-        BpsLog(msg);
-        
-        /* Get patch info first */
-        CV64_BPS_PatchInfo patchInfo;
-        CV64_BPS_Result infoResult = CV64_BPS_GetPatchInfo(patchFile.string().c_str(), &patchInfo);
-        if (infoResult != CV64_BPS_SUCCESS) {
-            snprintf(msg, sizeof(msg), "Failed to read patch info: %s", CV64_BPS_GetErrorMessage(infoResult));
-            BpsLog(msg);
-            continue; /* Skip invalid patches */
-        }
-        
-        snprintf(msg, sizeof(msg), "Patch expects source size=%u, CRC=%08X", patchInfo.sourceSize, patchInfo.sourceCRC);
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<BpsPatch> patches(bpsFiles.size());
+    std::vector<CV64_BPS_Result> status(bpsFiles.size());
+    for (size_t i = 0; i < bpsFiles.size(); i++) {
+        status[i] = BpsOpenPatch(bpsFiles[i].c_str(), &patches[i]);
+    }
+
+    u32 romCRC = CV64_Hash_CRC32(romData, *romSize);
+    u64 key = BpsCacheKey(patches, status, romCRC, *romSize, maxSize);
+
+    char entryName[64];
+    snprintf(entryName, sizeof(entryName), "patched_%016llx.bin", (unsigned long long)key);
+    std::filesystem::path cacheDir = patchesDir / CV64_BPS_CACHE_DIR;
+    std::filesystem::path entryPath = cacheDir / entryName;
+
+    BpsCacheHeader header;
+    if (BpsCacheLoad(entryPath, key, romCRC, romData, romSize, maxSize, &header)) {
+        f64 ms = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        snprintf(msg, sizeof(msg), "Patched ROM cache hit: %u patch(es) applied, ROM CRC %08X, %.2f ms",
+                 header.applied, header.resultCRC, ms);
         BpsLog(msg);
-        
-        /* Check if this patch is for our ROM (by CRC) */
-        u32 romCRC = BpsCalcCRC32(romData, *romSize);
-        if (romCRC != patchInfo.sourceCRC) {
-            snprintf(msg, sizeof(msg), "ROM CRC %08X doesn't match patch source CRC %08X, skipping", romCRC, patchInfo.sourceCRC);
-            BpsLog(msg);
-            continue;
-        }
-        
-        /* Apply patch */
-        size_t outputSize = maxSize;
-        CV64_BPS_Result patchResult = CV64_BPS_ApplyPatch(
-            patchFile.string().c_str(),
-            romData,
-            *romSize,
-            tempBuffer.data(),
-            &outputSize,
-            nullptr
-        );
-        
-        if (patchResult == CV64_BPS_SUCCESS) {
-            /* Copy patched data back */
-            memcpy(romData, tempBuffer.data(), outputSize);
-            *romSize = outputSize;
-            
-            snprintf(msg, sizeof(msg), "Successfully applied: %s", patchFile.filename().string().c_str());
-            BpsLog(msg);
-        } else {
-            snprintf(msg, sizeof(msg), "Failed to apply %s: %s", 
-                     patchFile.filename().string().c_str(), 
-                     CV64_BPS_GetErrorMessage(patchResult));
-            BpsLog(msg);
-        }
+        return CV64_BPS_SUCCESS;
     }
-    
+
+    size_t sourceSize = *romSize;
+    u32 resultCRC = 0;
+    u32 applied = BpsApplyChain(patches, status, romData, romSize, maxSize, &romCRC, &resultCRC);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BPS_CACHE_MAGIC, sizeof(BPS_CACHE_MAGIC));
+    header.version = BPS_CACHE_VERSION;
+    header.patchCount = (u32)patches.size();
+    header.key = key;
+    header.sourceCRC = romCRC;
+    header.resultCRC = resultCRC;
+    header.sourceSize = sourceSize;
+    header.resultSize = *romSize;
+    header.resultHash = applied ? CV64_Hash_XXH3(romData, *romSize) : 0;
+    header.applied = applied;
+    BpsCacheStore(cacheDir, entryPath, header, romData);
+
     return CV64_BPS_SUCCESS;
 }
 
@@ -14,10 +14,12 @@
 #ifdef CV64_STATIC_MUPEN64PLUS
 
 #include "../include/cv64_ini_parser.h"
+#include "../include/cv64_audio.h"
 #include <Windows.h>
 #include <string>
 #include <filesystem>
 #include <cstring>
+#include <cstdlib>
 
 /*===========================================================================
  * External Core Config API (linked from mupen64plus-core-static.lib)
@@ -256,6 +258,12 @@ static bool CreateDefaultAudioIni(const std::string& path) {
     defaultIni.SetInt("Audio", "buffer_size", 1024);
     defaultIni.SetInt("Audio", "sample_rate", 44100);
     
+    /* Output backend: auto, sdl or headless (no device, for benchmarks/CI) */
+    defaultIni.SetString("Audio", "backend", "auto");
+    defaultIni.SetInt("Audio", "latency_ms", 25);
+    defaultIni.SetString("Audio", "headless_wav_path", "");
+    defaultIni.SetBool("Audio", "headless_unthrottled", true);
+    
     return defaultIni.Save(path.c_str());
 }
 
@@ -811,6 +819,76 @@ bool CV64_Config_ApplyToGLideN64() {
     return true;
 }
 
+/*===========================================================================
+ * Apply Configuration to the Audio Plugin
+ *===========================================================================*/
+
+/**
+ * @brief Read an audio setting, letting an environment variable override the ini
+ */
+static std::string GetAudioSetting(const char* key, const char* envName, const char* defaultValue) {
+    const char* env = getenv(envName);
+    if (env && env[0] != '\0') {
+        return env;
+    }
+    return s_audioIni.GetString("Audio", key, defaultValue);
+}
+
+bool CV64_Config_ApplyToAudio() {
+    ConfigLog("Applying CV64 config to audio...");
+    
+    CV64_AudioConfig* audio = CV64_Audio_GetConfig();
+    char msg[384];
+    
+    /* Backend is read when the plugin initializes, so this must run first */
+    std::string backend = GetAudioSetting("backend", "CV64_AUDIO_BACKEND", "auto");
+    if (_stricmp(backend.c_str(), "headless") == 0) {
+        audio->backend = CV64_AUDIO_BACKEND_HEADLESS;
+    } else if (_stricmp(backend.c_str(), "sdl") == 0) {
+        audio->backend = CV64_AUDIO_BACKEND_SDL;
+    } else {
+        if (_stricmp(backend.c_str(), "auto") != 0) {
+            snprintf(msg, sizeof(msg), "Warning: Unknown audio backend '%.64s', using auto", backend.c_str());
+            ConfigLog(msg);
+        }
+        audio->backend = CV64_AUDIO_BACKEND_AUTO;
+    }
+    
+    std::string wavPath = GetAudioSetting("headless_wav_path", "CV64_AUDIO_WAV_PATH", "");
+    if (!wavPath.empty()) {
+        wavPath = GetAbsolutePath(wavPath);
+    }
+    strncpy(audio->headless_wav_path, wavPath.c_str(), sizeof(audio->headless_wav_path) - 1);
+    audio->headless_wav_path[sizeof(audio->headless_wav_path) - 1] = '\0';
+    
+    /* Headless runs are benchmarks: let the core run as fast as it can */
+    const char* unthrottledEnv = getenv("CV64_AUDIO_HEADLESS_UNTHROTTLED");
+    if (unthrottledEnv && unthrottledEnv[0] != '\0') {
+        audio->headless_unthrottled = strcmp(unthrottledEnv, "0") != 0 &&
+                                      _stricmp(unthrottledEnv, "false") != 0 &&
+                                      _stricmp(unthrottledEnv, "no") != 0 &&
+                                      _stricmp(unthrottledEnv, "off") != 0;
+    } else {
+        audio->headless_unthrottled = s_audioIni.GetBool("Audio", "headless_unthrottled", true);
+    }
+    
+    std::string latency = GetAudioSetting("latency_ms", "CV64_AUDIO_LATENCY_MS", "");
+    if (!latency.empty()) {
+        audio->latency_ms = (u32)strtoul(latency.c_str(), nullptr, 10);
+    }
+    
+    /* Clamps latency_ms and applies it */
+    CV64_Audio_ApplyConfig();
+    
+    snprintf(msg, sizeof(msg), "Audio backend=%s, latency_ms=%u, headless_wav_path=%.260s, headless_unthrottled=%d",
+             audio->backend == CV64_AUDIO_BACKEND_HEADLESS ? "headless" :
+             audio->backend == CV64_AUDIO_BACKEND_SDL ? "sdl" : "auto",
+             audio->latency_ms, audio->headless_wav_path[0] ? audio->headless_wav_path : "(none)",
+             audio->headless_unthrottled ? 1 : 0);
+    ConfigLog(msg);
+    return true;
+}
+
 /*===========================================================================
  * Master Configuration Function
  *===========================================================================*/
@@ -831,6 +909,11 @@ extern "C" bool CV64_Config_ApplyAll() {
         ConfigLog("Warning: Failed to apply GLideN64 configuration");
     }
     
+    /* Apply to the audio plugin */
+    if (!CV64_Config_ApplyToAudio()) {
+        ConfigLog("Warning: Failed to apply audio configuration");
+    }
+    
     /* NOTE: We do NOT call ConfigSaveFile() - our CV64 INI files are the single source of truth.
      * All settings are applied to mupen64plus in-memory config via ConfigSetParameter().
      * The plugins read from this in-memory config during initialization.
@@ -1,13 +1,29 @@
 /**
  * @file cv64_embedded_rom.cpp
  * @brief Embedded ROM loader implementation
- * 
+ *
  * Loads the ROM from Windows PE resource section.
+ *
+ * The packed image (see cv64_embedded_rom.h) is decoded frame by frame:
+ * every frame is an independent LZ4 block, so frames are handed out to
+ * the worker pool through a shared counter and each worker writes straight
+ * into its slice of the output. The CRC of a frame is taken right after it
+ * is decoded, while it is still in cache. Only the pages of the resource
+ * actually read are faulted in, and they are faulted in from several
+ * threads at once.
  */
 
 #include "../include/cv64_embedded_rom.h"
+#include "../include/cv64_hash.h"
+#include "../include/cv64_threading.h"
 #include <Windows.h>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /* mupen64plus API */
 extern "C" {
@@ -21,60 +37,335 @@ extern m64p_error CoreDoCommand(m64p_command Command, int ParamInt, void* ParamP
 /* Resource ID - must match cv64_embedded_rom.rc */
 #define IDR_BASEROM 101
 
-static const uint8_t* s_embeddedRomData = nullptr;
-static size_t s_embeddedRomSize = 0;
+/* Largest ROM accepted from a packed header (N64 carts top out at 64 MB) */
+#define EMBEDDED_ROM_MAX_SIZE (64ull * 1024 * 1024)
+
+static const uint8_t* s_resourceData = nullptr;
+static size_t s_resourceSize = 0;
 static bool s_romLoaded = false;
 
+/* Set when the resource is a packed image */
+static CV64_EmbeddedRomHeader s_packedHeader;
+static const uint8_t* s_packedFrames = nullptr;
+static bool s_romPacked = false;
+
+/* Uncompressed ROM size, and the buffer CV64_GetEmbeddedRom() hands out */
+static size_t s_embeddedRomSize = 0;
+static std::vector<uint8_t> s_unpackedRom;
+static std::mutex s_unpackMutex;
+
+static void RomLog(const char* msg) {
+    OutputDebugStringA("[CV64_ROM] ");
+    OutputDebugStringA(msg);
+    OutputDebugStringA("\n");
+}
+
+/*===========================================================================
+ * Packed Image
+ *===========================================================================*/
+
+static CV64_EmbeddedRomFrame ReadFrameEntry(uint32_t index) {
+    CV64_EmbeddedRomFrame frame;
+    memcpy(&frame, s_packedFrames + (size_t)index * sizeof(frame), sizeof(frame));
+    return frame;
+}
+
+static uint32_t FrameRawSize(uint32_t index) {
+    uint64_t start = (uint64_t)index * s_packedHeader.frameSize;
+    uint64_t left = s_packedHeader.romSize - start;
+    return (uint32_t)(left < s_packedHeader.frameSize ? left : s_packedHeader.frameSize);
+}
+
+/**
+ * @brief Check a packed header and frame table against the resource
+ *
+ * Frame data is only bounds-checked here; its CRC is checked on decode.
+ */
+static bool OpenPackedImage() {
+    if (s_resourceSize < sizeof(CV64_EmbeddedRomHeader)) {
+        return false;
+    }
+
+    CV64_EmbeddedRomHeader header;
+    memcpy(&header, s_resourceData, sizeof(header));
+    if (memcmp(header.magic, CV64_EMBEDDED_ROM_MAGIC, sizeof(header.magic)) != 0) {
+        return false;
+    }
+
+    char msg[160];
+    if (header.version != CV64_EMBEDDED_ROM_VERSION || header.frameSize == 0 ||
+        header.romSize == 0 || header.romSize > EMBEDDED_ROM_MAX_SIZE ||
+        header.frameCount != (header.romSize + header.frameSize - 1) / header.frameSize) {
+        sprintf_s(msg, "Packed ROM header invalid (version %u, %u frames of %u bytes, %llu bytes)",
+                  header.version, header.frameCount, header.frameSize,
+                  (unsigned long long)header.romSize);
+        RomLog(msg);
+        return false;
+    }
+
+    size_t tableEnd = sizeof(header) + (size_t)header.frameCount * sizeof(CV64_EmbeddedRomFrame);
+    if (tableEnd > s_resourceSize) {
+        RomLog("Packed ROM frame table truncated");
+        return false;
+    }
+
+    s_packedHeader = header;
+    s_packedFrames = s_resourceData + sizeof(header);
+
+    for (uint32_t i = 0; i < header.frameCount; i++) {
+        CV64_EmbeddedRomFrame frame = ReadFrameEntry(i);
+        if (frame.offset < tableEnd || frame.packedSize == 0 ||
+            frame.packedSize > FrameRawSize(i) ||
+            (uint64_t)frame.offset + frame.packedSize > s_resourceSize) {
+            sprintf_s(msg, "Packed ROM frame %u out of range", i);
+            RomLog(msg);
+            s_packedFrames = nullptr;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decode one LZ4 block that must fill dst exactly
+ *
+ * Every length and offset is checked, so a damaged block fails instead of
+ * reading or writing out of bounds.
+ */
+static bool Lz4DecodeBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* const ipEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const opEnd = dst + dstSize;
+
+    while (ip < ipEnd) {
+        unsigned token = *ip++;
+
+        size_t literals = token >> 4;
+        if (literals == 15) {
+            unsigned b;
+            do {
+                if (ip >= ipEnd) return false;
+                b = *ip++;
+                literals += b;
+            } while (b == 255);
+        }
+        if (literals > (size_t)(ipEnd - ip) || literals > (size_t)(opEnd - op)) {
+            return false;
+        }
+        memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+
+        /* The last sequence has literals only */
+        if (ip == ipEnd) {
+            break;
+        }
+
+        if (ipEnd - ip < 2) return false;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) {
+            return false;
+        }
+
+        size_t length = (token & 15) + 4;
+        if ((token & 15) == 15) {
+            unsigned b;
+            do {
+                if (ip >= ipEnd) return false;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+        }
+        if (length > (size_t)(opEnd - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= 16) {
+            /* Chunks never overlap their source at this distance */
+            while (length >= 16) {
+                memcpy(op, match, 16);
+                op += 16;
+                match += 16;
+                length -= 16;
+            }
+            memcpy(op, match, length);
+            op += length;
+        } else {
+            /* Short offsets repeat a pattern; copy bytewise */
+            while (length--) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == opEnd;
+}
+
+struct FrameDecodeJob {
+    uint8_t* dst;
+    std::atomic<uint32_t>* next;
+    std::atomic<bool>* failed;
+    uint32_t badFrame;
+};
+
+/**
+ * @brief Decode frames until none are left or one fails
+ */
+static void* FrameDecodeTask(void* param) {
+    FrameDecodeJob* job = (FrameDecodeJob*)param;
+
+    for (;;) {
+        if (job->failed->load(std::memory_order_relaxed)) {
+            break;
+        }
+        uint32_t index = job->next->fetch_add(1, std::memory_order_relaxed);
+        if (index >= s_packedHeader.frameCount) {
+            break;
+        }
+
+        CV64_EmbeddedRomFrame frame = ReadFrameEntry(index);
+        const uint8_t* src = s_resourceData + frame.offset;
+        uint8_t* out = job->dst + (size_t)index * s_packedHeader.frameSize;
+        uint32_t rawSize = FrameRawSize(index);
+
+        bool ok;
+        if (frame.packedSize == rawSize) {
+            /* Stored frame: did not compress */
+            memcpy(out, src, rawSize);
+            ok = true;
+        } else {
+            ok = Lz4DecodeBlock(src, frame.packedSize, out, rawSize);
+        }
+
+        if (!ok || CV64_Hash_CRC32(out, rawSize) != frame.crc) {
+            job->badFrame = index;
+            job->failed->store(true, std::memory_order_relaxed);
+            break;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Decode every frame of the packed image into dst
+ *
+ * Workers pull frames from a shared counter and are fanned out with
+ * CV64_Worker_RunAll.
+ */
+static bool DecodePackedImage(uint8_t* dst) {
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned hw = std::thread::hardware_concurrency();
+    uint32_t workers = hw ? (uint32_t)hw : 4;
+    if (workers > s_packedHeader.frameCount) {
+        workers = s_packedHeader.frameCount;
+    }
+
+    std::atomic<uint32_t> next{ 0 };
+    std::atomic<bool> failed{ false };
+    std::vector<FrameDecodeJob> jobs(workers, FrameDecodeJob{ dst, &next, &failed, UINT32_MAX });
+
+    std::vector<void*> params(workers);
+    for (uint32_t i = 0; i < workers; i++) {
+        params[i] = &jobs[i];
+    }
+
+    /* Every frame has been claimed once the calling thread's worker returns,
+     * so a job no worker has started has nothing left to do: take it back
+     * instead of waiting for the pool */
+    CV64_Worker_RunAll(FrameDecodeTask, params.data(), workers, 0);
+
+    char msg[192];
+    if (failed.load()) {
+        for (const FrameDecodeJob& job : jobs) {
+            if (job.badFrame != UINT32_MAX) {
+                sprintf_s(msg, "Packed ROM frame %u is corrupt (decode or CRC failed)", job.badFrame);
+                RomLog(msg);
+            }
+        }
+        return false;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    double mb = s_embeddedRomSize / (1024.0 * 1024.0);
+    sprintf_s(msg, "Decompressed %.2f MB from %.2f MB in %.2f ms (%.0f MB/s, %u frames, %u workers)",
+              mb, s_resourceSize / (1024.0 * 1024.0), ms, ms > 0.0 ? mb * 1000.0 / ms : 0.0,
+              s_packedHeader.frameCount, workers);
+    RomLog(msg);
+    return true;
+}
+
+/*===========================================================================
+ * Resource
+ *===========================================================================*/
+
 /**
  * Initialize embedded ROM access by finding the resource
  */
 static bool InitEmbeddedRom()
 {
     if (s_romLoaded) {
-        return s_embeddedRomData != nullptr;
+        return s_embeddedRomSize != 0;
     }
-    
+
     s_romLoaded = true;
-    
+
     HMODULE hModule = GetModuleHandle(NULL);
     if (!hModule) {
         OutputDebugStringA("[CV64_ROM] Failed to get module handle\n");
         return false;
     }
-    
+
     /* Find the ROM resource */
     HRSRC hResource = FindResource(hModule, MAKEINTRESOURCE(IDR_BASEROM), RT_RCDATA);
     if (!hResource) {
         OutputDebugStringA("[CV64_ROM] ROM resource not found\n");
         return false;
     }
-    
+
     /* Get resource size */
-    s_embeddedRomSize = SizeofResource(hModule, hResource);
-    if (s_embeddedRomSize == 0) {
+    s_resourceSize = SizeofResource(hModule, hResource);
+    if (s_resourceSize == 0) {
         OutputDebugStringA("[CV64_ROM] ROM resource has zero size\n");
         return false;
     }
-    
+
     /* Load the resource */
     HGLOBAL hGlobal = LoadResource(hModule, hResource);
     if (!hGlobal) {
         OutputDebugStringA("[CV64_ROM] Failed to load ROM resource\n");
         return false;
     }
-    
+
     /* Lock and get pointer to data */
-    s_embeddedRomData = static_cast<const uint8_t*>(LockResource(hGlobal));
-    if (!s_embeddedRomData) {
+    s_resourceData = static_cast<const uint8_t*>(LockResource(hGlobal));
+    if (!s_resourceData) {
         OutputDebugStringA("[CV64_ROM] Failed to lock ROM resource\n");
         return false;
     }
-    
-    char msg[128];
-    sprintf_s(msg, "[CV64_ROM] Embedded ROM loaded: %zu bytes (%.2f MB)\n", 
-              s_embeddedRomSize, s_embeddedRomSize / (1024.0 * 1024.0));
+
+    char msg[160];
+    if (OpenPackedImage()) {
+        s_romPacked = true;
+        s_embeddedRomSize = (size_t)s_packedHeader.romSize;
+        sprintf_s(msg, "[CV64_ROM] Embedded ROM found: %zu bytes packed as %zu bytes (%.1f%%)\n",
+                  s_embeddedRomSize, s_resourceSize, s_resourceSize * 100.0 / s_embeddedRomSize);
+    } else if (s_resourceSize >= 8 && memcmp(s_resourceData, CV64_EMBEDDED_ROM_MAGIC, 8) == 0) {
+        /* Packed but unusable: do not hand the container out as a ROM */
+        OutputDebugStringA("[CV64_ROM] Packed ROM resource rejected\n");
+        return false;
+    } else {
+        s_embeddedRomSize = s_resourceSize;
+        sprintf_s(msg, "[CV64_ROM] Embedded ROM loaded: %zu bytes (%.2f MB, uncompressed)\n",
+                  s_embeddedRomSize, s_embeddedRomSize / (1024.0 * 1024.0));
+    }
     OutputDebugStringA(msg);
-    
+
     return true;
 }
 
@@ -82,13 +373,53 @@ extern "C" {
 
 const uint8_t* CV64_GetEmbeddedRom(size_t* size)
 {
+    if (size) *size = 0;
     if (!InitEmbeddedRom()) {
-        if (size) *size = 0;
         return nullptr;
     }
-    
+
+    if (s_romPacked) {
+        std::lock_guard<std::mutex> lock(s_unpackMutex);
+        if (s_unpackedRom.empty()) {
+            s_unpackedRom.resize(s_embeddedRomSize);
+            if (!DecodePackedImage(s_unpackedRom.data())) {
+                std::vector<uint8_t>().swap(s_unpackedRom);
+                return nullptr;
+            }
+        }
+        if (size) *size = s_embeddedRomSize;
+        return s_unpackedRom.data();
+    }
+
     if (size) *size = s_embeddedRomSize;
-    return s_embeddedRomData;
+    return s_resourceData;
+}
+
+size_t CV64_GetEmbeddedRomSize(void)
+{
+    return InitEmbeddedRom() ? s_embeddedRomSize : 0;
+}
+
+int CV64_ReadEmbeddedRom(uint8_t* dst, size_t capacity)
+{
+    if (!dst || !InitEmbeddedRom() || capacity < s_embeddedRomSize) {
+        return 0;
+    }
+
+    if (!s_romPacked) {
+        memcpy(dst, s_resourceData, s_embeddedRomSize);
+        return 1;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_unpackMutex);
+        if (!s_unpackedRom.empty()) {
+            memcpy(dst, s_unpackedRom.data(), s_embeddedRomSize);
+            return 1;
+        }
+    }
+
+    return DecodePackedImage(dst) ? 1 : 0;
 }
 
 int CV64_HasEmbeddedRom(void)
@@ -98,24 +429,26 @@ int CV64_HasEmbeddedRom(void)
 
 int CV64_LoadEmbeddedRom(void)
 {
-    if (!InitEmbeddedRom()) {
+    size_t romSize = 0;
+    const uint8_t* romData = CV64_GetEmbeddedRom(&romSize);
+    if (!romData) {
         OutputDebugStringA("[CV64_ROM] No embedded ROM available\n");
         return (int)M64ERR_FILES;
     }
-    
+
     OutputDebugStringA("[CV64_ROM] Loading embedded ROM into core...\n");
-    
+
     /* Use CoreDoCommand with M64CMD_ROM_OPEN to load ROM from memory */
     /* ParamInt = ROM size, ParamPtr = ROM data */
-    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)s_embeddedRomSize, (void*)s_embeddedRomData);
-    
+    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)romSize, (void*)romData);
+
     if (result != M64ERR_SUCCESS) {
         char msg[128];
         sprintf_s(msg, "[CV64_ROM] CoreDoCommand(ROM_OPEN) failed: %d\n", result);
         OutputDebugStringA(msg);
         return result;
     }
-    
+
     OutputDebugStringA("[CV64_ROM] Embedded ROM loaded successfully!\n");
     return M64ERR_SUCCESS;
 }
@@ -26,6 +26,7 @@
 #include "../include/cv64_performance_optimizations.h"
 #include "../include/cv64_rdp_optimizations.h"
 #include "../include/cv64_memory_hook.h"
+#include "../include/cv64_actor_table.h"
 
 #include <Windows.h>
 #include <unordered_map>
@@ -54,6 +55,9 @@
 #define CV64_ADDR_FOG_FAR       0x80387AE2  // Fog far plane (sym: fog_distance_end)
 #define CV64_ADDR_FOG_COLOR     0x80387AC8  // Fog color (sym: map_fog_color) — u32
 
+// Entity LOD: objects farther than this from the player may be skipped
+#define CV64_ENTITY_LOD_DISTANCE 4000.0f
+
 // Input system addresses
 #define CV64_ADDR_CONTROLLER_DATA 0x80363AB8 // Controller input buffer (system_work)
 
@@ -157,19 +161,30 @@ if (s_gameState.saveLoadCooldown > 0) {
 CV64_GameStateType oldState = s_gameState.currentState;
 CV64_GameMapID oldMap = s_gameState.currentMap;
     
+/* All fields come from the memory hook's per-frame snapshot so this module
+ * sees the same frame as the rest of the hooks. Fields that were not
+ * gathered read as zero, as the old bounds-checked reads did. */
+CV64_RDRAMSnapshot snapCopy;
+if (!CV64_Memory_CopySnapshot(&snapCopy)) {
+    s_gameState.currentState = CV64_GAME_STATE_UNKNOWN;
+    s_gameState.currentMap = CV64_GAME_MAP_UNKNOWN;
+    return;
+}
+const CV64_RDRAMSnapshot* snap = &snapCopy;
+
 /* Check inPlayerGameplayLoop — 0 means we're in menus/loading,
  * but we should still read map_ID and other state for detection */
-uint32_t gameplayActive = ReadU32(CV64_ADDR_GAME_STATE);
+uint32_t gameplayActive = snap->inGameplayLoop;
     
-// Read current state from memory — use correct sizes per decomp types
-s_gameState.currentMap = (CV64_GameMapID)(int16_t)ReadU16(CV64_ADDR_MAP_ID);
-s_gameState.inCutscene = ReadU16(CV64_ADDR_CUTSCENE_FLAG) != 0;  // cutscene_ID is u16
-s_gameState.isLoading = ReadU16(CV64_ADDR_LOADING_FLAG) != 0;    // map_fade_out_time is u16
-s_gameState.isPaused = ReadU16(CV64_ADDR_PAUSE_STATE) != 0;      // current_opened_menu is u16
+// Read current state from the snapshot — sizes per decomp types
+s_gameState.currentMap = (CV64_GameMapID)snap->mapId;
+s_gameState.inCutscene = snap->cutsceneId != 0;       // cutscene_ID is u16
+s_gameState.isLoading = snap->mapFadeOutTime != 0;    // map_fade_out_time is u16
+s_gameState.isPaused = snap->currentMenu != 0;        // current_opened_menu is u16
     
 /* CRITICAL: Detect save/load menu states
  * Reading memory during save/load operations causes freezes */
-uint16_t pauseMenuState = ReadU16(CV64_ADDR_PAUSE_STATE);  // current_opened_menu is u16
+uint16_t pauseMenuState = snap->currentMenu;  // current_opened_menu is u16
 bool wasSaveLoadActive = s_gameState.isSaveLoadMenuActive;
 s_gameState.isSaveLoadMenuActive = (pauseMenuState >= 0x10 && pauseMenuState <= 0x30);
     
@@ -224,14 +239,30 @@ if (s_gameState.isLoading) {
         OutputDebugStringA(debugMsg);
     }
     
-    /* Entity/enemy/particle counts: No verified decomp addresses exist for these.
-     * Keep them at 0 — they are not used for critical logic. */
-    s_gameState.entityCount = 0;
-    s_gameState.enemyCount = 0;
+    /* Entity counts come from the live actor table (one object tree walk per
+     * VI). No enemy type IDs are verified yet, so enemyCount is the number of
+     * objects with a model other than the player - an upper bound. Particles
+     * have no known list and stay at 0. */
+    u32 actorGen = 0;
+    const CV64_ActorTable* actors = CV64_Actors_BorrowTable(&actorGen);
+    if (actors) {
+        const u32 count = actors->count;
+        u32 enemies = actors->modelCount;
+        const u32 player = actors->playerIndex;
+        if (player < count && actors->modelAddr[player] != 0) enemies--;
+        /* Overwritten while we read it: keep last VI's counts */
+        if (CV64_Actors_IsBorrowValid(actorGen)) {
+            s_gameState.entityCount = count;
+            s_gameState.enemyCount = enemies;
+        }
+    } else {
+        s_gameState.entityCount = 0;
+        s_gameState.enemyCount = 0;
+    }
     s_gameState.particleCount = 0;
 
     // Read fog color (u32) — non-zero means fog is active
-    s_gameState.fogEnabled = ReadU32(CV64_ADDR_FOG_COLOR) != 0;
+    s_gameState.fogEnabled = snap->fogColor != 0;
     s_gameState.currentBGM = 0;  // No verified BGM address in decomp
     
     // DEBUG: Log every 60 frames (once per second at 60 FPS)
@@ -288,8 +319,19 @@ bool CV64_GameOpt_ShouldSkipParticle(uint32_t particleIndex) {
 
 bool CV64_GameOpt_ShouldSkipEntity(uint32_t entityIndex, float distanceFromPlayer) {
     // DISABLED: This optimization requires GlideN64 modification
-    // Returning false = don't skip any entities (safe default)
-    return false;
+    // skipDistantEnemies stays false, so no entities are skipped (safe default)
+    if (!s_graphicsOpt.skipDistantEnemies) return false;
+
+    // entityIndex indexes the live actor table; a negative distance means
+    // "use the table's distance column"
+    if (distanceFromPlayer < 0.0f) {
+        u32 actorGen = 0;
+        const CV64_ActorTable* actors = CV64_Actors_BorrowTable(&actorGen);
+        if (!actors || entityIndex >= actors->count) return false;
+        distanceFromPlayer = actors->distToPlayer[entityIndex];
+        if (!CV64_Actors_IsBorrowValid(actorGen) || distanceFromPlayer < 0.0f) return false;
+    }
+    return distanceFromPlayer > CV64_ENTITY_LOD_DISTANCE;
 }
 
 int CV64_GameOpt_GetShadowQuality() {
@@ -0,0 +1,450 @@
+/**
+ * @file cv64_gameshark.cpp
+ * @brief Castlevania 64 PC Recomp - Compiled GameShark code engine
+ *
+ * Compilation turns each text code into one or more 8-byte instructions:
+ *
+ *   opOffset  bits 31-24 opcode, bits 23-0 RDRAM byte offset with the
+ *             host lane swizzle already applied (offset ^ 3 for bytes,
+ *             offset ^ 2 for half-words), so execution indexes RDRAM
+ *             directly
+ *   value     immediate to write or compare
+ *   skip      for conditionals: instructions to skip when the test fails
+ *             (the compiled length of the following code, so a D-code in
+ *             front of a 50 repeat skips the whole expansion)
+ *
+ * Repeat codes are expanded at compile time. Address range and alignment
+ * are checked while compiling, and each list records the highest byte it
+ * touches, so the only check left per VI is whether that fits the mapped
+ * RDRAM, done once when the flat program is rebuilt.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "../include/cv64_gameshark.h"
+#include <Windows.h>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static void GSLog(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    OutputDebugStringA("[CV64_GS] ");
+    OutputDebugStringA(buffer);
+    OutputDebugStringA("\n");
+}
+
+/** Largest RDRAM a code may address (Expansion Pak) */
+#define GS_RDRAM_MAX 0x800000u
+
+/*===========================================================================
+ * Bytecode
+ *===========================================================================*/
+
+enum GSOp : u8 {
+    GS_OP_WRITE8 = 0,
+    GS_OP_WRITE16,
+    GS_OP_IF_EQ8,
+    GS_OP_IF_EQ16,
+    GS_OP_IF_NE8,
+    GS_OP_IF_NE16,
+};
+
+struct GSInstr {
+    u32 opOffset;
+    u16 value;
+    u16 skip;
+};
+static_assert(sizeof(GSInstr) == 8, "GSInstr must stay 8 bytes");
+
+static inline GSInstr MakeInstr(GSOp op, u32 offset, u16 value) {
+    /* Byte and half-word lanes are swapped within each host-order word */
+    u32 lane = (op == GS_OP_WRITE8 || op == GS_OP_IF_EQ8 || op == GS_OP_IF_NE8) ? 3u : 2u;
+    GSInstr in;
+    in.opOffset = ((u32)op << 24) | ((offset ^ lane) & 0x00FFFFFFu);
+    in.value = value;
+    in.skip = 0;
+    return in;
+}
+
+/*===========================================================================
+ * Parser / Compiler
+ *===========================================================================*/
+
+struct GSCode {
+    u32 addr;
+    u16 value;
+    u32 line;
+};
+
+struct GSList {
+    s32 id;
+    std::string name;
+    std::vector<GSInstr> code;
+    u32 maxEnd;             /* One past the highest RDRAM byte touched */
+    bool enabled;
+    u32 rejectedForSize;    /* RDRAM size this list was last rejected for */
+};
+
+static bool CompileFail(CV64_GameSharkError* err, u32 line, const char* format, ...) {
+    if (err) {
+        err->line = line;
+        va_list args;
+        va_start(args, format);
+        vsnprintf(err->message, sizeof(err->message), format, args);
+        va_end(args);
+    }
+    return false;
+}
+
+static inline int HexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * @brief Split code text into (address, value) pairs
+ */
+static bool ParseCodes(const char* text, std::vector<GSCode>& out, CV64_GameSharkError* err) {
+    u32 line = 1;
+    bool haveAddr = false;
+    GSCode pending = {};
+    const char* p = text;
+
+    while (*p) {
+        char c = *p;
+        if (c == '\n') { line++; p++; continue; }
+        if (c == ' ' || c == '\t' || c == '\r' || c == ',') { p++; continue; }
+        if (c == '#' || c == ';' || (c == '/' && p[1] == '/')) {
+            while (*p && *p != '\n') p++;
+            continue;
+        }
+
+        u32 value = 0;
+        int digits = 0;
+        while (HexDigit(*p) >= 0) {
+            if (digits < 8) value = (value << 4) | (u32)HexDigit(*p);
+            digits++;
+            p++;
+        }
+        if (digits == 0 || (*p && !strchr(" \t\r\n,#;/", *p))) {
+            return CompileFail(err, line, "unexpected character '%c'", *p ? *p : c);
+        }
+
+        if (!haveAddr) {
+            if (digits != 8) {
+                return CompileFail(err, line, "code address must be 8 hex digits");
+            }
+            pending.addr = value;
+            pending.line = line;
+            haveAddr = true;
+        } else {
+            if (digits != 4) {
+                return CompileFail(err, line, "code value must be 4 hex digits");
+            }
+            pending.value = (u16)value;
+            out.push_back(pending);
+            haveAddr = false;
+        }
+    }
+
+    if (haveAddr) {
+        return CompileFail(err, pending.line, "code %08X has no value", pending.addr);
+    }
+    return true;
+}
+
+static bool IsWriteType(u8 type) {
+    return type == 0x80 || type == 0x81 || type == 0xA0 || type == 0xA1;
+}
+
+/**
+ * @brief Compile one write (or one step of a repeat) into the list
+ */
+static bool EmitWrite(GSList& list, const GSCode& code, u32 offset, u16 value, CV64_GameSharkError* err) {
+    bool wide = (code.addr >> 24) == 0x81 || (code.addr >> 24) == 0xA1;
+    u32 size = wide ? 2u : 1u;
+    if (offset + size > GS_RDRAM_MAX) {
+        return CompileFail(err, code.line, "address %06X is outside RDRAM", offset);
+    }
+    if (wide && (offset & 1)) {
+        return CompileFail(err, code.line, "16-bit code at odd address %06X", offset);
+    }
+    list.code.push_back(MakeInstr(wide ? GS_OP_WRITE16 : GS_OP_WRITE8, offset,
+                                  wide ? value : (u16)(value & 0xFF)));
+    if (offset + size > list.maxEnd) list.maxEnd = offset + size;
+    return true;
+}
+
+static bool CompileList(const std::vector<GSCode>& codes, GSList& list, CV64_GameSharkError* err) {
+    list.code.clear();
+    list.maxEnd = 0;
+
+    /* Conditional waiting for the length of the code that follows it */
+    size_t pendingIf = SIZE_MAX;
+
+    for (size_t i = 0; i < codes.size(); i++) {
+        const GSCode& code = codes[i];
+        u8 type = (u8)(code.addr >> 24);
+        u32 offset = code.addr & 0x00FFFFFFu;
+        size_t unitStart = list.code.size();
+        bool isIf = false;
+
+        if (IsWriteType(type)) {
+            if (!EmitWrite(list, code, offset, code.value, err)) return false;
+        } else if (type >= 0xD0 && type <= 0xD3) {
+            bool wide = (type & 1) != 0;
+            bool equal = type < 0xD2;
+            u32 size = wide ? 2u : 1u;
+            if (offset + size > GS_RDRAM_MAX) {
+                return CompileFail(err, code.line, "address %06X is outside RDRAM", offset);
+            }
+            if (wide && (offset & 1)) {
+                return CompileFail(err, code.line, "16-bit code at odd address %06X", offset);
+            }
+            GSOp op = equal ? (wide ? GS_OP_IF_EQ16 : GS_OP_IF_EQ8)
+                            : (wide ? GS_OP_IF_NE16 : GS_OP_IF_NE8);
+            list.code.push_back(MakeInstr(op, offset, wide ? code.value : (u16)(code.value & 0xFF)));
+            if (offset + size > list.maxEnd) list.maxEnd = offset + size;
+            isIf = true;
+        } else if (type == 0x50) {
+            u32 count = (code.addr >> 8) & 0xFF;
+            u32 step = code.addr & 0xFF;
+            if ((code.addr & 0x00FF0000u) != 0 || count == 0) {
+                return CompileFail(err, code.line, "malformed repeat code %08X", code.addr);
+            }
+            if (i + 1 >= codes.size() || !IsWriteType((u8)(codes[i + 1].addr >> 24))) {
+                return CompileFail(err, code.line, "repeat code must be followed by an 80/81 code");
+            }
+            const GSCode& next = codes[++i];
+            u32 nextOffset = next.addr & 0x00FFFFFFu;
+            for (u32 k = 0; k < count; k++) {
+                if (!EmitWrite(list, next, nextOffset + k * step, (u16)(next.value + k * code.value), err)) {
+                    return false;
+                }
+            }
+        } else {
+            return CompileFail(err, code.line, "unsupported code type %02X", type);
+        }
+
+        if (pendingIf != SIZE_MAX) {
+            list.code[pendingIf].skip = (u16)(list.code.size() - unitStart);
+            pendingIf = SIZE_MAX;
+        }
+        if (isIf) pendingIf = unitStart;
+    }
+
+    if (pendingIf != SIZE_MAX) {
+        return CompileFail(err, codes.back().line, "conditional code has no code to guard");
+    }
+    return true;
+}
+
+/*===========================================================================
+ * Engine State
+ *===========================================================================*/
+
+static std::mutex s_mutex;
+static std::vector<GSList> s_lists;
+static s32 s_next_id = 1;
+
+/* Flat program of all enabled lists, rebuilt on change */
+static std::vector<GSInstr> s_program;
+static bool s_program_dirty = true;
+static u32 s_program_rdram_size = 0;
+
+static CV64_GameSharkStats s_stats = {};
+
+static GSList* FindList(s32 id) {
+    for (GSList& list : s_lists) {
+        if (list.id == id) return &list;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Concatenate enabled lists that fit in rdramSize (s_mutex held)
+ */
+static void RebuildProgram(u32 rdramSize) {
+    s_program.clear();
+    u32 enabled = 0, rejected = 0;
+    for (GSList& list : s_lists) {
+        if (!list.enabled) continue;
+        if (list.maxEnd > rdramSize) {
+            if (list.rejectedForSize != rdramSize) {
+                GSLog("Code list '%s' needs 0x%X bytes of RDRAM (have 0x%X) - skipped",
+                      list.name.c_str(), list.maxEnd, rdramSize);
+                list.rejectedForSize = rdramSize;
+            }
+            rejected++;
+            continue;
+        }
+        s_program.insert(s_program.end(), list.code.begin(), list.code.end());
+        enabled++;
+    }
+
+    s_program_dirty = false;
+    s_program_rdram_size = rdramSize;
+    s_stats.listCount = (u32)s_lists.size();
+    s_stats.enabledListCount = enabled;
+    s_stats.rejectedListCount = rejected;
+    s_stats.instructionCount = (u32)s_program.size();
+    GSLog("Program rebuilt: %u list(s), %u instruction(s)", enabled, (u32)s_program.size());
+}
+
+/**
+ * @brief Run the compiled program (all offsets pre-validated)
+ */
+static u32 Execute(u8* rdram, const GSInstr* code, size_t count) {
+    u32 writes = 0;
+    size_t pc = 0;
+    while (pc < count) {
+        const GSInstr& in = code[pc++];
+        u8* p = rdram + (in.opOffset & 0x00FFFFFFu);
+        switch (in.opOffset >> 24) {
+        case GS_OP_WRITE8:
+            *p = (u8)in.value;
+            writes++;
+            break;
+        case GS_OP_WRITE16:
+            memcpy(p, &in.value, sizeof(u16));
+            writes++;
+            break;
+        case GS_OP_IF_EQ8:
+            if (*p != (u8)in.value) pc += in.skip;
+            break;
+        case GS_OP_IF_NE8:
+            if (*p == (u8)in.value) pc += in.skip;
+            break;
+        case GS_OP_IF_EQ16: {
+            u16 v;
+            memcpy(&v, p, sizeof(v));
+            if (v != in.value) pc += in.skip;
+            break;
+        }
+        case GS_OP_IF_NE16: {
+            u16 v;
+            memcpy(&v, p, sizeof(v));
+            if (v == in.value) pc += in.skip;
+            break;
+        }
+        }
+    }
+    return writes;
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+s32 CV64_GameShark_AddList(const char* name, const char* codes, bool enabled,
+                           CV64_GameSharkError* outError) {
+    if (outError) {
+        outError->line = 0;
+        outError->message[0] = '\0';
+    }
+
+    CV64_GameSharkError localError = {};
+    CV64_GameSharkError* err = outError ? outError : &localError;
+    const char* listName = name ? name : "(unnamed)";
+    if (!codes) {
+        CompileFail(err, 0, "no code text");
+        GSLog("Code list '%s' rejected: %s", listName, err->message);
+        return CV64_GAMESHARK_INVALID_LIST;
+    }
+
+    /* Parse and compile outside the lock; the emulation thread keeps running */
+    std::vector<GSCode> parsed;
+    GSList list;
+    list.name = listName;
+    list.enabled = enabled;
+    list.rejectedForSize = 0;
+    if (!ParseCodes(codes, parsed, err) || !CompileList(parsed, list, err)) {
+        GSLog("Code list '%s' rejected at line %u: %s", listName, err->line, err->message);
+        return CV64_GAMESHARK_INVALID_LIST;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    list.id = s_next_id++;
+    GSLog("Code list '%s' compiled: %u code(s) -> %u instruction(s)%s",
+          listName, (u32)parsed.size(), (u32)list.code.size(), enabled ? "" : " (disabled)");
+    s_lists.push_back(std::move(list));
+    s_program_dirty = true;
+    return s_lists.back().id;
+}
+
+bool CV64_GameShark_RemoveList(s32 id) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (size_t i = 0; i < s_lists.size(); i++) {
+        if (s_lists[i].id == id) {
+            s_lists.erase(s_lists.begin() + i);
+            s_program_dirty = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CV64_GameShark_SetListEnabled(s32 id, bool enabled) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    GSList* list = FindList(id);
+    if (!list) return false;
+    if (list->enabled != enabled) {
+        list->enabled = enabled;
+        s_program_dirty = true;
+    }
+    return true;
+}
+
+bool CV64_GameShark_IsListEnabled(s32 id) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    GSList* list = FindList(id);
+    return list && list->enabled;
+}
+
+u32 CV64_GameShark_Run(u8* rdram, u32 rdramSize) {
+    if (!rdram || rdramSize == 0) return 0;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_program_dirty || rdramSize != s_program_rdram_size) {
+        RebuildProgram(rdramSize);
+    }
+    if (s_program.empty()) {
+        s_stats.writesLastRun = 0;
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    u32 writes = Execute(rdram, s_program.data(), s_program.size());
+    auto end = std::chrono::steady_clock::now();
+
+    s_stats.writesLastRun = writes;
+    s_stats.runCount++;
+    s_stats.lastRunMicros = std::chrono::duration<f64, std::micro>(end - start).count();
+    return writes;
+}
+
+void CV64_GameShark_GetStats(CV64_GameSharkStats* stats) {
+    if (!stats) return;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    *stats = s_stats;
+    stats->listCount = (u32)s_lists.size();
+}
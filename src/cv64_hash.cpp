@@ -0,0 +1,692 @@
+/**
+ * @file cv64_hash.cpp
+ * @brief Castlevania 64 PC Recomp - Shared data hashing implementation
+ *
+ * CRC-32 backends:
+ *   - slice16:   16 x 256 lookup tables, 16 bytes per step (portable)
+ *   - pclmul:    carry-less multiply folding, 64 bytes per step (x86-64 with
+ *                PCLMULQDQ + SSE4.1), same constants as zlib/Chromium
+ *   - armv8-crc: CRC32X instruction, 8 bytes per step (ARMv8 with CRC ext.)
+ *
+ * XXH3 follows the reference XXH3_64bits() algorithm with the default
+ * secret; the long-input accumulate/scramble loop uses AVX2 or SSE2 on
+ * x86-64 and plain 64-bit code elsewhere.
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "../include/cv64_hash.h"
+#include "../include/cv64_cpu_features.h"
+#include <Windows.h>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static void HashLog(const char* msg) {
+    OutputDebugStringA("[CV64_HASH] ");
+    OutputDebugStringA(msg);
+    OutputDebugStringA("\n");
+}
+
+/* All supported targets are little-endian */
+static inline u32 ReadLE32(const u8* p) {
+    u32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline u64 ReadLE64(const u8* p) {
+    u64 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/*===========================================================================
+ * CRC-32: slice-by-16
+ *===========================================================================*/
+
+using CrcTables = std::array<std::array<u32, 256>, 16>;
+
+static constexpr CrcTables MakeCrcTables() {
+    CrcTables t{};
+    for (u32 i = 0; i < 256; i++) {
+        u32 crc = i;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+        }
+        t[0][i] = crc;
+    }
+    /* t[k][i] = CRC of byte i followed by k zero bytes */
+    for (u32 i = 0; i < 256; i++) {
+        for (int k = 1; k < 16; k++) {
+            t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+        }
+    }
+    return t;
+}
+
+static constexpr CrcTables s_crcTables = MakeCrcTables();
+
+/* crc is the raw (inverted) register in all backend functions */
+static u32 Crc32Bytewise(u32 crc, const u8* p, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc = (crc >> 8) ^ s_crcTables[0][(crc ^ p[i]) & 0xFF];
+    }
+    return crc;
+}
+
+static u32 Crc32Slice16(u32 crc, const u8* p, size_t size) {
+    const auto& t = s_crcTables;
+    while (size >= 16) {
+        u32 a = ReadLE32(p) ^ crc;
+        u32 b = ReadLE32(p + 4);
+        u32 c = ReadLE32(p + 8);
+        u32 d = ReadLE32(p + 12);
+        crc = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^ t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^
+              t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^ t[9][(b >> 16) & 0xFF]  ^ t[8][b >> 24] ^
+              t[7][c & 0xFF]  ^ t[6][(c >> 8) & 0xFF]  ^ t[5][(c >> 16) & 0xFF]  ^ t[4][c >> 24] ^
+              t[3][d & 0xFF]  ^ t[2][(d >> 8) & 0xFF]  ^ t[1][(d >> 16) & 0xFF]  ^ t[0][d >> 24];
+        p += 16;
+        size -= 16;
+    }
+    return Crc32Bytewise(crc, p, size);
+}
+
+/*===========================================================================
+ * CRC-32: PCLMULQDQ folding (x86-64)
+ *===========================================================================*/
+
+#ifdef CV64_CPU_X64
+
+/* Requires size >= 64 and size % 16 == 0 */
+CV64_CPU_TARGET("pclmul,sse4.1")
+static u32 Crc32PclmulBlocks(u32 crc, const u8* p, size_t size) {
+    alignas(16) static const u64 k1k2[2] = { 0x0154442bd4ULL, 0x01c6e41596ULL };
+    alignas(16) static const u64 k3k4[2] = { 0x01751997d0ULL, 0x00ccaa009eULL };
+    alignas(16) static const u64 k5k0[2] = { 0x0163cd6124ULL, 0x0000000000ULL };
+    alignas(16) static const u64 poly[2] = { 0x01db710641ULL, 0x01f7011641ULL };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i*)(p + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(p + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(p + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_load_si128((const __m128i*)k1k2);
+    p += 64;
+    size -= 64;
+
+    /* Fold 4 x 128 bits in parallel */
+    while (size >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(p + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(p + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(p + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(p + 0x30)));
+        p += 64;
+        size -= 64;
+    }
+
+    /* Fold into a single 128-bit lane */
+    x0 = _mm_load_si128((const __m128i*)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    while (size >= 16) {
+        x2 = _mm_loadu_si128((const __m128i*)p);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        p += 16;
+        size -= 16;
+    }
+
+    /* 128 -> 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction to 32 bits */
+    x0 = _mm_load_si128((const __m128i*)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (u32)_mm_extract_epi32(x1, 1);
+}
+
+static u32 Crc32Pclmul(u32 crc, const u8* p, size_t size) {
+    if (size >= 64) {
+        size_t blocks = size & ~(size_t)15;
+        crc = Crc32PclmulBlocks(crc, p, blocks);
+        p += blocks;
+        size -= blocks;
+    }
+    return Crc32Slice16(crc, p, size);
+}
+
+#endif /* CV64_CPU_X64 */
+
+/*===========================================================================
+ * CRC-32: ARMv8 CRC32 instructions
+ *===========================================================================*/
+
+#ifdef CV64_CPU_ARM64
+
+CV64_CPU_TARGET("+crc")
+static u32 Crc32Armv8(u32 crc, const u8* p, size_t size) {
+    while (size >= 32) {
+        crc = __crc32d(crc, ReadLE64(p));
+        crc = __crc32d(crc, ReadLE64(p + 8));
+        crc = __crc32d(crc, ReadLE64(p + 16));
+        crc = __crc32d(crc, ReadLE64(p + 24));
+        p += 32;
+        size -= 32;
+    }
+    while (size >= 8) {
+        crc = __crc32d(crc, ReadLE64(p));
+        p += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = __crc32b(crc, *p++);
+    }
+    return crc;
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+/*===========================================================================
+ * CRC-32: dispatch
+ *===========================================================================*/
+
+typedef u32 (*Crc32Func)(u32 crc, const u8* p, size_t size);
+
+struct CrcBackend {
+    Crc32Func func;
+    const char* name;
+};
+
+static CrcBackend SelectCrcBackend() {
+#ifdef CV64_CPU_X64
+    if (CV64_Cpu_HasPCLMUL() && CV64_Cpu_HasSSE41()) return { Crc32Pclmul, "pclmul" };
+#endif
+#ifdef CV64_CPU_ARM64
+    if (CV64_Cpu_HasArmCRC32()) return { Crc32Armv8, "armv8-crc" };
+#endif
+    return { Crc32Slice16, "slice16" };
+}
+
+static const CrcBackend& GetCrcBackend() {
+    static const CrcBackend backend = SelectCrcBackend();
+    return backend;
+}
+
+extern "C" u32 CV64_Hash_CRC32Update(u32 crc, const void* data, size_t size) {
+    if (!data || size == 0) return crc;
+    return ~GetCrcBackend().func(~crc, (const u8*)data, size);
+}
+
+extern "C" u32 CV64_Hash_CRC32(const void* data, size_t size) {
+    return CV64_Hash_CRC32Update(0, data, size);
+}
+
+extern "C" const char* CV64_Hash_GetCRC32Backend(void) {
+    return GetCrcBackend().name;
+}
+
+/*===========================================================================
+ * XXH3 (64-bit, default secret, seed 0)
+ *===========================================================================*/
+
+static const u32 XXH_PRIME32_1 = 0x9E3779B1U;
+static const u32 XXH_PRIME32_2 = 0x85EBCA77U;
+static const u32 XXH_PRIME32_3 = 0xC2B2AE3DU;
+static const u64 XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const u64 XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const u64 XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const u64 XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const u64 XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+static const u64 XXH_PRIME_MX1 = 0x165667919E3779F9ULL;
+static const u64 XXH_PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+static const size_t XXH_SECRET_SIZE = 192;
+static const size_t XXH_STRIPE_LEN = 64;
+static const size_t XXH_SECRET_CONSUME_RATE = 8;
+static const size_t XXH_SECRET_LASTACC_START = 7;
+static const size_t XXH_SECRET_MERGEACCS_START = 11;
+static const size_t XXH_MIDSIZE_MAX = 240;
+
+alignas(64) static const u8 s_xxhSecret[XXH_SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static inline u64 XxhRotl64(u64 x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline u32 XxhSwap32(u32 x) {
+    return ((x << 24) & 0xff000000) | ((x << 8) & 0x00ff0000) |
+           ((x >> 8) & 0x0000ff00) | ((x >> 24) & 0x000000ff);
+}
+
+static inline u64 XxhSwap64(u64 x) {
+    return ((u64)XxhSwap32((u32)x) << 32) | XxhSwap32((u32)(x >> 32));
+}
+
+static inline u64 XxhMul128Fold64(u64 lhs, u64 rhs) {
+#if defined(_MSC_VER) && defined(CV64_CPU_X64)
+    u64 hi;
+    u64 lo = _umul128(lhs, rhs, &hi);
+    return lo ^ hi;
+#elif defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)lhs * rhs;
+    return (u64)product ^ (u64)(product >> 64);
+#else
+    u64 loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+    u64 hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+    u64 loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+    u64 hiHi = (lhs >> 32) * (rhs >> 32);
+    u64 cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+    u64 upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    u64 lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+    return lower ^ upper;
+#endif
+}
+
+static inline u64 Xxh64Avalanche(u64 h) {
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline u64 Xxh3Avalanche(u64 h) {
+    h ^= h >> 37;
+    h *= XXH_PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline u64 Xxh3Rrmxmx(u64 h, u64 len) {
+    h ^= XxhRotl64(h, 49) ^ XxhRotl64(h, 24);
+    h *= XXH_PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= XXH_PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+static inline u64 Xxh3Mix16B(const u8* in, const u8* secret) {
+    return XxhMul128Fold64(ReadLE64(in) ^ ReadLE64(secret),
+                           ReadLE64(in + 8) ^ ReadLE64(secret + 8));
+}
+
+static u64 Xxh3Len0To16(const u8* in, size_t len) {
+    const u8* secret = s_xxhSecret;
+    if (len > 8) {
+        u64 bitflip1 = ReadLE64(secret + 24) ^ ReadLE64(secret + 32);
+        u64 bitflip2 = ReadLE64(secret + 40) ^ ReadLE64(secret + 48);
+        u64 lo = ReadLE64(in) ^ bitflip1;
+        u64 hi = ReadLE64(in + len - 8) ^ bitflip2;
+        u64 acc = len + XxhSwap64(lo) + hi + XxhMul128Fold64(lo, hi);
+        return Xxh3Avalanche(acc);
+    }
+    if (len >= 4) {
+        u32 in1 = ReadLE32(in);
+        u32 in2 = ReadLE32(in + len - 4);
+        u64 bitflip = ReadLE64(secret + 8) ^ ReadLE64(secret + 16);
+        u64 in64 = in2 + ((u64)in1 << 32);
+        return Xxh3Rrmxmx(in64 ^ bitflip, len);
+    }
+    if (len > 0) {
+        u32 c1 = in[0];
+        u32 c2 = in[len >> 1];
+        u32 c3 = in[len - 1];
+        u32 combined = (c1 << 16) | (c2 << 24) | c3 | ((u32)len << 8);
+        u64 bitflip = (u64)(ReadLE32(secret) ^ ReadLE32(secret + 4));
+        return Xxh64Avalanche((u64)combined ^ bitflip);
+    }
+    return Xxh64Avalanche(ReadLE64(secret + 56) ^ ReadLE64(secret + 64));
+}
+
+static u64 Xxh3Len17To128(const u8* in, size_t len) {
+    const u8* secret = s_xxhSecret;
+    u64 acc = len * XXH_PRIME64_1;
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96) {
+                acc += Xxh3Mix16B(in + 48, secret + 96);
+                acc += Xxh3Mix16B(in + len - 64, secret + 112);
+            }
+            acc += Xxh3Mix16B(in + 32, secret + 64);
+            acc += Xxh3Mix16B(in + len - 48, secret + 80);
+        }
+        acc += Xxh3Mix16B(in + 16, secret + 32);
+        acc += Xxh3Mix16B(in + len - 32, secret + 48);
+    }
+    acc += Xxh3Mix16B(in, secret);
+    acc += Xxh3Mix16B(in + len - 16, secret + 16);
+    return Xxh3Avalanche(acc);
+}
+
+static u64 Xxh3Len129To240(const u8* in, size_t len) {
+    const u8* secret = s_xxhSecret;
+    const size_t startOffset = 3;
+    const size_t lastOffset = 17;
+    const size_t secretSizeMin = 136;
+
+    u64 acc = len * XXH_PRIME64_1;
+    size_t rounds = len / 16;
+    for (size_t i = 0; i < 8; i++) {
+        acc += Xxh3Mix16B(in + 16 * i, secret + 16 * i);
+    }
+    acc = Xxh3Avalanche(acc);
+
+    u64 accEnd = Xxh3Mix16B(in + len - 16, secret + secretSizeMin - lastOffset);
+    for (size_t i = 8; i < rounds; i++) {
+        accEnd += Xxh3Mix16B(in + 16 * i, secret + 16 * (i - 8) + startOffset);
+    }
+    return Xxh3Avalanche(acc + accEnd);
+}
+
+/*
+ * Long-input kernels. accumulate() consumes `stripes` 64-byte stripes,
+ * advancing the secret by 8 bytes per stripe; scramble() runs once per
+ * 1 KB block. The driver calls them through a pointer, so the indirect
+ * call is paid once per block, not per stripe.
+ */
+
+static void Xxh3AccumulateScalar(u64* acc, const u8* in, const u8* secret, size_t stripes) {
+    for (size_t s = 0; s < stripes; s++) {
+        const u8* stripe = in + s * XXH_STRIPE_LEN;
+        const u8* key = secret + s * XXH_SECRET_CONSUME_RATE;
+        for (int i = 0; i < 8; i++) {
+            u64 data = ReadLE64(stripe + 8 * i);
+            u64 dataKey = data ^ ReadLE64(key + 8 * i);
+            acc[i ^ 1] += data;
+            acc[i] += (u64)(u32)dataKey * (dataKey >> 32);
+        }
+    }
+}
+
+static void Xxh3ScrambleScalar(u64* acc, const u8* secret) {
+    for (int i = 0; i < 8; i++) {
+        u64 a = acc[i];
+        a ^= a >> 47;
+        a ^= ReadLE64(secret + 8 * i);
+        a *= XXH_PRIME32_1;
+        acc[i] = a;
+    }
+}
+
+#ifdef CV64_CPU_X64
+
+static void Xxh3AccumulateSse2(u64* acc, const u8* in, const u8* secret, size_t stripes) {
+    __m128i* xacc = (__m128i*)acc;
+    __m128i a0 = _mm_load_si128(xacc + 0);
+    __m128i a1 = _mm_load_si128(xacc + 1);
+    __m128i a2 = _mm_load_si128(xacc + 2);
+    __m128i a3 = _mm_load_si128(xacc + 3);
+
+#define XXH3_SSE2_LANE(a, i)                                                        \
+    do {                                                                            \
+        __m128i data = _mm_loadu_si128((const __m128i*)stripe + (i));              \
+        __m128i dataKey = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*)key + (i))); \
+        __m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1))); \
+        a = _mm_add_epi64(a, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));  \
+        a = _mm_add_epi64(a, product);                                              \
+    } while (0)
+
+    for (size_t s = 0; s < stripes; s++) {
+        const u8* stripe = in + s * XXH_STRIPE_LEN;
+        const u8* key = secret + s * XXH_SECRET_CONSUME_RATE;
+        XXH3_SSE2_LANE(a0, 0);
+        XXH3_SSE2_LANE(a1, 1);
+        XXH3_SSE2_LANE(a2, 2);
+        XXH3_SSE2_LANE(a3, 3);
+    }
+#undef XXH3_SSE2_LANE
+
+    _mm_store_si128(xacc + 0, a0);
+    _mm_store_si128(xacc + 1, a1);
+    _mm_store_si128(xacc + 2, a2);
+    _mm_store_si128(xacc + 3, a3);
+}
+
+static void Xxh3ScrambleSse2(u64* acc, const u8* secret) {
+    __m128i* xacc = (__m128i*)acc;
+    const __m128i prime32 = _mm_set1_epi32((int)XXH_PRIME32_1);
+    for (int i = 0; i < 4; i++) {
+        __m128i a = _mm_load_si128(xacc + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)secret + i));
+        __m128i prodLo = _mm_mul_epu32(a, prime32);
+        __m128i prodHi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime32);
+        _mm_store_si128(xacc + i, _mm_add_epi64(prodLo, _mm_slli_epi64(prodHi, 32)));
+    }
+}
+
+CV64_CPU_TARGET("avx2")
+static void Xxh3AccumulateAvx2(u64* acc, const u8* in, const u8* secret, size_t stripes) {
+    __m256i* xacc = (__m256i*)acc;
+    __m256i a0 = _mm256_loadu_si256(xacc + 0);
+    __m256i a1 = _mm256_loadu_si256(xacc + 1);
+
+    for (size_t s = 0; s < stripes; s++) {
+        const __m256i* stripe = (const __m256i*)(in + s * XXH_STRIPE_LEN);
+        const __m256i* key = (const __m256i*)(secret + s * XXH_SECRET_CONSUME_RATE);
+
+        __m256i d0 = _mm256_loadu_si256(stripe + 0);
+        __m256i d1 = _mm256_loadu_si256(stripe + 1);
+        __m256i k0 = _mm256_xor_si256(d0, _mm256_loadu_si256(key + 0));
+        __m256i k1 = _mm256_xor_si256(d1, _mm256_loadu_si256(key + 1));
+        __m256i p0 = _mm256_mul_epu32(k0, _mm256_srli_epi64(k0, 32));
+        __m256i p1 = _mm256_mul_epu32(k1, _mm256_srli_epi64(k1, 32));
+        a0 = _mm256_add_epi64(a0, _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2)));
+        a1 = _mm256_add_epi64(a1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2)));
+        a0 = _mm256_add_epi64(a0, p0);
+        a1 = _mm256_add_epi64(a1, p1);
+    }
+
+    _mm256_storeu_si256(xacc + 0, a0);
+    _mm256_storeu_si256(xacc + 1, a1);
+}
+
+CV64_CPU_TARGET("avx2")
+static void Xxh3ScrambleAvx2(u64* acc, const u8* secret) {
+    __m256i* xacc = (__m256i*)acc;
+    const __m256i prime32 = _mm256_set1_epi32((int)XXH_PRIME32_1);
+    for (int i = 0; i < 2; i++) {
+        __m256i a = _mm256_loadu_si256(xacc + i);
+        a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)secret + i));
+        __m256i prodLo = _mm256_mul_epu32(a, prime32);
+        __m256i prodHi = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime32);
+        _mm256_storeu_si256(xacc + i, _mm256_add_epi64(prodLo, _mm256_slli_epi64(prodHi, 32)));
+    }
+}
+
+#endif /* CV64_CPU_X64 */
+
+struct Xxh3Backend {
+    void (*accumulate)(u64* acc, const u8* in, const u8* secret, size_t stripes);
+    void (*scramble)(u64* acc, const u8* secret);
+    const char* name;
+};
+
+static Xxh3Backend SelectXxh3Backend() {
+#ifdef CV64_CPU_X64
+    if (CV64_Cpu_HasAVX2()) return { Xxh3AccumulateAvx2, Xxh3ScrambleAvx2, "avx2" };
+    return { Xxh3AccumulateSse2, Xxh3ScrambleSse2, "sse2" };
+#else
+    return { Xxh3AccumulateScalar, Xxh3ScrambleScalar, "scalar" };
+#endif
+}
+
+static const Xxh3Backend& GetXxh3Backend() {
+    static const Xxh3Backend backend = SelectXxh3Backend();
+    return backend;
+}
+
+static u64 Xxh3Long(const u8* in, size_t len, const Xxh3Backend& backend) {
+    const u8* secret = s_xxhSecret;
+    alignas(32) u64 acc[8] = {
+        XXH_PRIME32_3, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3,
+        XXH_PRIME64_4, XXH_PRIME32_2, XXH_PRIME64_5, XXH_PRIME32_1
+    };
+
+    const size_t stripesPerBlock = (XXH_SECRET_SIZE - XXH_STRIPE_LEN) / XXH_SECRET_CONSUME_RATE;
+    const size_t blockLen = XXH_STRIPE_LEN * stripesPerBlock;
+    const size_t blocks = (len - 1) / blockLen;
+
+    for (size_t n = 0; n < blocks; n++) {
+        backend.accumulate(acc, in + n * blockLen, secret, stripesPerBlock);
+        backend.scramble(acc, secret + XXH_SECRET_SIZE - XXH_STRIPE_LEN);
+    }
+
+    /* Last partial block */
+    const size_t stripes = ((len - 1) - blockLen * blocks) / XXH_STRIPE_LEN;
+    backend.accumulate(acc, in + blocks * blockLen, secret, stripes);
+
+    /* Last stripe */
+    backend.accumulate(acc, in + len - XXH_STRIPE_LEN,
+                       secret + XXH_SECRET_SIZE - XXH_STRIPE_LEN - XXH_SECRET_LASTACC_START, 1);
+
+    /* Merge accumulators */
+    u64 result = len * XXH_PRIME64_1;
+    const u8* mergeSecret = secret + XXH_SECRET_MERGEACCS_START;
+    for (int i = 0; i < 4; i++) {
+        result += XxhMul128Fold64(acc[2 * i] ^ ReadLE64(mergeSecret + 16 * i),
+                                  acc[2 * i + 1] ^ ReadLE64(mergeSecret + 16 * i + 8));
+    }
+    return Xxh3Avalanche(result);
+}
+
+extern "C" u64 CV64_Hash_XXH3(const void* data, size_t size) {
+    const u8* in = (const u8*)data;
+    if (!in) size = 0;
+    if (size <= 16) return Xxh3Len0To16(in, size);
+    if (size <= 128) return Xxh3Len17To128(in, size);
+    if (size <= XXH_MIDSIZE_MAX) return Xxh3Len129To240(in, size);
+    return Xxh3Long(in, size, GetXxh3Backend());
+}
+
+extern "C" u32 CV64_Hash_Texture(const void* data, size_t size) {
+    u64 h = CV64_Hash_XXH3(data, size);
+    return (u32)h ^ (u32)(h >> 32);
+}
+
+/*===========================================================================
+ * Benchmark
+ *===========================================================================*/
+
+template <typename Fn>
+static double MeasureMBps(size_t size, Fn&& fn) {
+    using Clock = std::chrono::steady_clock;
+    /* Aim for ~64 MB hashed per measurement, at least 3 iterations */
+    size_t iterations = (64u << 20) / size;
+    if (iterations < 3) iterations = 3;
+
+    volatile u64 sink = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        sink = sink + fn();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    (void)sink;
+    if (seconds <= 0.0) return 0.0;
+    return (double)size * (double)iterations / (1024.0 * 1024.0) / seconds;
+}
+
+extern "C" u32 CV64_Hash_RunBenchmark(CV64_HashBenchResult* outResults, u32 maxResults) {
+    const size_t maxSize = 32u << 20;
+    std::vector<u8> buffer(maxSize);
+    u32 state = 0x12345678;
+    for (size_t i = 0; i < maxSize; i++) {
+        state = state * 1664525u + 1013904223u;
+        buffer[i] = (u8)(state >> 24);
+    }
+    const u8* p = buffer.data();
+
+    char msg[256];
+    snprintf(msg, sizeof(msg), "Benchmark: CRC-32 backend = %s, XXH3 backend = %s",
+             CV64_Hash_GetCRC32Backend(), GetXxh3Backend().name);
+    HashLog(msg);
+    HashLog("      size   bytewise    slice16   dispatch       xxh3  (MB/s)");
+
+    u32 count = 0;
+    for (size_t size = 64; size <= maxSize; size <<= 1) {
+        /* Odd offset/length so the unaligned head and tail paths are covered */
+        u32 ref = ~Crc32Bytewise(~0u, p + 1, size - 1);
+        if (ref != ~Crc32Slice16(~0u, p + 1, size - 1) || ref != CV64_Hash_CRC32(p + 1, size - 1)) {
+            snprintf(msg, sizeof(msg), "Benchmark: CRC-32 backend mismatch at %zu bytes", size - 1);
+            HashLog(msg);
+            return 0;
+        }
+        const Xxh3Backend scalar = { Xxh3AccumulateScalar, Xxh3ScrambleScalar, "scalar" };
+        if (size - 1 > XXH_MIDSIZE_MAX && Xxh3Long(p + 1, size - 1, scalar) != CV64_Hash_XXH3(p + 1, size - 1)) {
+            snprintf(msg, sizeof(msg), "Benchmark: XXH3 backend mismatch at %zu bytes", size - 1);
+            HashLog(msg);
+            return 0;
+        }
+
+        CV64_HashBenchResult r;
+        r.size = size;
+        r.bytewiseMBps = MeasureMBps(size, [&] { return (u64)Crc32Bytewise(~0u, p, size); });
+        r.crc32TableMBps = MeasureMBps(size, [&] { return (u64)Crc32Slice16(~0u, p, size); });
+        r.crc32MBps = MeasureMBps(size, [&] { return (u64)CV64_Hash_CRC32(p, size); });
+        r.xxh3MBps = MeasureMBps(size, [&] { return CV64_Hash_XXH3(p, size); });
+
+        snprintf(msg, sizeof(msg), "%10zu %10.0f %10.0f %10.0f %10.0f",
+                 size, r.bytewiseMBps, r.crc32TableMBps, r.crc32MBps, r.xxh3MBps);
+        HashLog(msg);
+
+        if (outResults && count < maxResults) outResults[count] = r;
+        count++;
+    }
+    return count;
+}
@@ -1871,7 +1871,14 @@ int CV64_M64P_GetSpeedFactor(void) {
 void CV64_M64P_SetSpeedLimiter(bool enabled) {
     int param = M64CORE_SPEED_LIMITER;
     int value = enabled ? 1 : 0;
+    s_coreDoCommand(M64CMD_CORE_STATE_SET, param, &value);
+}
+
+bool CV64_M64P_GetSpeedLimiter(void) {
+    int value = 1;
+    int param = M64CORE_SPEED_LIMITER;
     s_coreDoCommand(M64CMD_CORE_STATE_QUERY, param, &value);
+    return value != 0;
 }
 
 /*===========================================================================
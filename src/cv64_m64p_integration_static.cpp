@@ -26,17 +26,22 @@
 #include "../include/cv64_embedded_rom.h"
 #include "../include/cv64_config_bridge.h"
 #include "../include/cv64_bps_patch.h"
+#include "../include/cv64_rom_loader.h"
 #include "../include/cv64_memory_hook.h"
 #include "../include/cv64_threading.h"
+#include "../include/cv64_audio.h"
 
 #include <Windows.h>
+#include <psapi.h>
 #include <string>
 #include <filesystem>
 #include <cstring>
 #include <cstdio>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 /*===========================================================================
@@ -162,8 +167,51 @@ static void StaticCoreDebugCallback(void* context, int level, const char* messag
     OutputDebugStringA(buffer);
 }
 
+/* Speed limiter turned off for a headless audio run (restored on stop) */
+static std::atomic<bool> s_staticLimiterOverridden(false);
+
+/**
+ * @brief Turn the speed limiter off while the headless audio backend runs
+ *
+ * Headless runs are benchmarks: the sink renders as fast as the emulator
+ * produces samples, so the core must not be paced to 60 VI/s. Called when
+ * the core reports RUNNING, the first point at which it accepts state
+ * changes. A later run with another backend gets the limiter back.
+ */
+static void StaticApplyHeadlessThrottle(void) {
+    const CV64_AudioConfig* audio = CV64_Audio_GetConfig();
+    const bool unthrottle = audio->backend == CV64_AUDIO_BACKEND_HEADLESS && audio->headless_unthrottled;
+    if (unthrottle == s_staticLimiterOverridden.load()) return;
+
+    int value = unthrottle ? 0 : 1;
+    if (CoreDoCommand(M64CMD_CORE_STATE_SET, M64CORE_SPEED_LIMITER, &value) != M64ERR_SUCCESS) {
+        StaticLogDebug("Warning: Could not change the speed limiter for headless audio");
+        return;
+    }
+    s_staticLimiterOverridden = unthrottle;
+    CV64_Audio_SetSpeedLimiterState(!unthrottle);
+    StaticLogDebug(unthrottle ? "Speed limiter OFF (headless audio backend)" : "Speed limiter restored");
+}
+
+/**
+ * @brief Give the limiter back before the core stops accepting state changes
+ */
+static void StaticRestoreSpeedLimiter(void) {
+    if (!s_staticLimiterOverridden.load()) return;
+
+    int value = 1;
+    if (CoreDoCommand(M64CMD_CORE_STATE_SET, M64CORE_SPEED_LIMITER, &value) == M64ERR_SUCCESS) {
+        s_staticLimiterOverridden = false;
+        CV64_Audio_SetSpeedLimiterState(true);
+        StaticLogDebug("Speed limiter restored");
+    }
+}
+
 static void StaticCoreStateCallback(void* context, m64p_core_param param, int value) {
     StaticLogDebug("State change: param=" + std::to_string((int)param) + " value=" + std::to_string(value));
+    if (param == M64CORE_EMU_STATE && value == M64EMU_RUNNING) {
+        StaticApplyHeadlessThrottle();
+    }
 }
 
 /*===========================================================================
@@ -379,17 +427,22 @@ bool CV64_M64P_Static_LoadEmbeddedROM() {
     
     StaticLogDebug("Attempting to load embedded ROM...");
     
-    /* Get embedded ROM data */
-    size_t romSize = 0;
-    const uint8_t* romData = CV64_GetEmbeddedRom(&romSize);
+    /* Decompress the embedded ROM straight into a mutable buffer for patching
+     * (left uninitialized: every byte is written by the decoder) */
+    size_t romSize = CV64_GetEmbeddedRomSize();
+    std::unique_ptr<u8[]> romBuffer;
+    if (romSize != 0) {
+        romBuffer = std::unique_ptr<u8[]>(new u8[romSize]);
+    }
     
-    if (!romData || romSize == 0) {
+    if (romSize == 0 || !CV64_ReadEmbeddedRom(romBuffer.get(), romSize)) {
         char debugMsg[256];
-        sprintf_s(debugMsg, "No embedded ROM available (data=%p, size=%zu)", (void*)romData, romSize);
+        sprintf_s(debugMsg, "No embedded ROM available (size=%zu)", romSize);
         StaticSetError(debugMsg);
         return false;
     }
     
+    const u8* romData = romBuffer.get();
     char sizeMsg[256];
     sprintf_s(sizeMsg, "Found embedded ROM: %zu bytes (%.2f MB) at %p, first bytes: %02X %02X %02X %02X", 
               romSize, romSize / (1024.0 * 1024.0), (void*)romData,
@@ -399,18 +452,16 @@ bool CV64_M64P_Static_LoadEmbeddedROM() {
               romSize > 3 ? romData[3] : 0);
     StaticLogDebug(sizeMsg);
     
-    /* Make a mutable copy of ROM data for patching */
-    std::vector<u8> romBuffer(romData, romData + romSize);
     size_t patchedSize = romSize;
     
     /* Apply BPS patches from patches folder */
     StaticLogDebug("Checking for BPS patches...");
-    CV64_BPS_Result bpsResult = CV64_BPS_ApplyPatches(romBuffer.data(), &patchedSize, romBuffer.capacity());
+    CV64_BPS_Result bpsResult = CV64_BPS_ApplyPatches(romBuffer.get(), &patchedSize, romSize);
     if (bpsResult == CV64_BPS_SUCCESS) {
         if (patchedSize != romSize) {
-            romBuffer.resize(patchedSize);
             sprintf_s(sizeMsg, "ROM size changed after patching: %zu -> %zu", romSize, patchedSize);
             StaticLogDebug(sizeMsg);
+            romSize = patchedSize;
         }
         StaticLogDebug("BPS patches applied successfully");
     } else if (bpsResult != CV64_BPS_NO_PATCHES_FOUND) {
@@ -419,10 +470,10 @@ bool CV64_M64P_Static_LoadEmbeddedROM() {
     }
     
     /* Open ROM in core */
-    sprintf_s(sizeMsg, "Calling CoreDoCommand(M64CMD_ROM_OPEN, %d, %p)", (int)romBuffer.size(), (void*)romBuffer.data());
+    sprintf_s(sizeMsg, "Calling CoreDoCommand(M64CMD_ROM_OPEN, %d, %p)", (int)romSize, (void*)romBuffer.get());
     StaticLogDebug(sizeMsg);
     
-    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)romBuffer.size(), (void*)romBuffer.data());
+    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)romSize, (void*)romBuffer.get());
     if (result != M64ERR_SUCCESS) {
         StaticSetError("CoreDoCommand(ROM_OPEN) failed for embedded ROM: " + std::string(CoreErrorMessage(result)));
         return false;
@@ -486,72 +537,64 @@ bool CV64_M64P_Static_LoadROM(const char* romPath) {
     
     StaticLogDebug("Loading ROM: " + std::string(romPath));
     
-    /* Read ROM file */
-    FILE* romFile = fopen(romPath, "rb");
-    if (!romFile) {
+    /* Map the ROM file. A z64 dump with no patches to apply is handed to the
+     * core straight from the mapping; otherwise it is converted to z64 order
+     * into a writable copy in one pass. */
+    auto loadStart = std::chrono::steady_clock::now();
+    bool hasPatches = CV64_BPS_HasPatches();
+    
+    CV64_RomImage romImage;
+    if (!CV64_Rom_OpenImage(romPath, hasPatches, &romImage)) {
         StaticSetError("Failed to open ROM file: " + std::string(romPath));
         return false;
     }
-    
-    fseek(romFile, 0, SEEK_END);
-    size_t romSize = ftell(romFile);
-    fseek(romFile, 0, SEEK_SET);
+    size_t romSize = (size_t)romImage.size;
     
     char debugMsg[256];
-    sprintf_s(debugMsg, "ROM file size: %zu bytes", romSize);
-    StaticLogDebug(debugMsg);
-    
-    if (romSize < 4096) {
-        fclose(romFile);
-        StaticSetError("ROM file too small (< 4096 bytes)");
-        return false;
-    }
-    
-    std::vector<u8> romData(romSize);
-    size_t bytesRead = fread(romData.data(), 1, romSize, romFile);
-    fclose(romFile);
-    
-    if (bytesRead != romSize) {
-        sprintf_s(debugMsg, "Failed to read ROM file: read %zu of %zu bytes", bytesRead, romSize);
-        StaticSetError(debugMsg);
-        return false;
-    }
-    
     sprintf_s(debugMsg, "ROM data loaded at %p, size %zu, first bytes: %02X %02X %02X %02X",
-              (void*)romData.data(), romSize,
-              romData.size() > 0 ? romData[0] : 0,
-              romData.size() > 1 ? romData[1] : 0,
-              romData.size() > 2 ? romData[2] : 0,
-              romData.size() > 3 ? romData[3] : 0);
+              (void*)romImage.data, romSize,
+              romImage.data[0], romImage.data[1], romImage.data[2], romImage.data[3]);
     StaticLogDebug(debugMsg);
     
-    /* Apply BPS patches from patches folder */
-    StaticLogDebug("Checking for BPS patches...");
-    size_t patchedSize = romSize;
-    CV64_BPS_Result bpsResult = CV64_BPS_ApplyPatches(romData.data(), &patchedSize, romData.capacity());
-    if (bpsResult == CV64_BPS_SUCCESS) {
-        if (patchedSize != romSize) {
-            romData.resize(patchedSize);
-            sprintf_s(debugMsg, "ROM size changed after patching: %zu -> %zu", romSize, patchedSize);
+    if (hasPatches) {
+        /* Apply BPS patches from patches folder */
+        StaticLogDebug("Checking for BPS patches...");
+        size_t patchedSize = romSize;
+        CV64_BPS_Result bpsResult = CV64_BPS_ApplyPatches(romImage.buffer, &patchedSize, romSize);
+        if (bpsResult == CV64_BPS_SUCCESS) {
+            if (patchedSize != romSize) {
+                sprintf_s(debugMsg, "ROM size changed after patching: %zu -> %zu", romSize, patchedSize);
+                StaticLogDebug(debugMsg);
+                romSize = patchedSize;
+            }
+            StaticLogDebug("BPS patches applied successfully");
+        } else if (bpsResult != CV64_BPS_NO_PATCHES_FOUND) {
+            sprintf_s(debugMsg, "BPS patching failed: %s", CV64_BPS_GetErrorMessage(bpsResult));
             StaticLogDebug(debugMsg);
-            romSize = patchedSize;
         }
-        StaticLogDebug("BPS patches applied successfully");
-    } else if (bpsResult != CV64_BPS_NO_PATCHES_FOUND) {
-        sprintf_s(debugMsg, "BPS patching failed: %s", CV64_BPS_GetErrorMessage(bpsResult));
-        StaticLogDebug(debugMsg);
     }
     
-    /* Open ROM in core */
-    sprintf_s(debugMsg, "Calling CoreDoCommand(M64CMD_ROM_OPEN, %d, %p)", (int)romSize, (void*)romData.data());
+    /* Open ROM in core (the core keeps its own copy) */
+    sprintf_s(debugMsg, "Calling CoreDoCommand(M64CMD_ROM_OPEN, %d, %p)", (int)romSize, (void*)romImage.data);
     StaticLogDebug(debugMsg);
     
-    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)romSize, romData.data());
+    const char* loadMode = hasPatches ? "patched copy" : (romImage.buffer ? "converted copy" : "mapped");
+    m64p_error result = CoreDoCommand(M64CMD_ROM_OPEN, (int)romSize, (void*)romImage.data);
+    CV64_Rom_CloseImage(&romImage);
     if (result != M64ERR_SUCCESS) {
         StaticSetError("CoreDoCommand(ROM_OPEN) failed: " + std::string(CoreErrorMessage(result)));
         return false;
     }
     
+    PROCESS_MEMORY_COUNTERS memCounters = {};
+    memCounters.cb = sizeof(memCounters);
+    GetProcessMemoryInfo(GetCurrentProcess(), &memCounters, sizeof(memCounters));
+    sprintf_s(debugMsg, "ROM ready in %.2f ms (%s), peak working set %.1f MB",
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count(),
+              loadMode,
+              memCounters.PeakWorkingSetSize / (1024.0 * 1024.0));
+    StaticLogDebug(debugMsg);
+    
     /* Get ROM header */
     result = CoreDoCommand(M64CMD_ROM_GET_HEADER, sizeof(s_staticRomHeader), &s_staticRomHeader);
     if (result != M64ERR_SUCCESS) {
@@ -699,8 +742,8 @@ bool CV64_M64P_Static_Start() {
         .enableAsyncAudio = true,      // SDL audio callback is async
         .enableWorkerThreads = true,   // Worker pool for async tasks
         .workerThreadCount = 0,        // Auto-detect based on CPU cores
-        .graphicsQueueDepth = 2,       // Double buffering (safer than triple)
-        .enableParallelRSP = false     // Keep RSP synchronous for safety
+        .enableParallelRSP = false,    // Keep RSP synchronous for safety
+        .framePolicy = CV64_FRAME_POLICY_LATEST // Present the newest frame
     };
     
     if (!CV64_Threading_Init(&threadConfig)) {
@@ -733,6 +776,7 @@ void CV64_M64P_Static_Stop() {
     
     StaticLogDebug("Stopping emulation...");
     s_staticStopRequested = true;
+    StaticRestoreSpeedLimiter();
     CoreDoCommand(M64CMD_STOP, 0, NULL);
     
     if (s_staticEmulationThread.joinable()) {
@@ -898,6 +942,19 @@ void CV64_M64P_Static_SetSpeedLimiter(bool enabled) {
     if (ConfigOpenSection("Core", &configHandle) == M64ERR_SUCCESS) {
         ConfigSetParameter(configHandle, "SpeedLimiter", M64TYPE_BOOL, &value);
     }
+    
+    /* Apply to the running core as well */
+    if (s_staticEmulationRunning &&
+        CoreDoCommand(M64CMD_CORE_STATE_SET, M64CORE_SPEED_LIMITER, &value) == M64ERR_SUCCESS) {
+        s_staticLimiterOverridden = false;
+        CV64_Audio_SetSpeedLimiterState(enabled);
+    }
+}
+
+bool CV64_M64P_Static_GetSpeedLimiter() {
+    int value = 1;
+    CoreDoCommand(M64CMD_CORE_STATE_QUERY, M64CORE_SPEED_LIMITER, &value);
+    return value != 0;
 }
 
 /*===========================================================================
@@ -1081,6 +1138,10 @@ void CV64_M64P_SetSpeedLimiter(bool enabled) {
     CV64_M64P_Static_SetSpeedLimiter(enabled);
 }
 
+bool CV64_M64P_GetSpeedLimiter() {
+    return CV64_M64P_Static_GetSpeedLimiter();
+}
+
 void CV64_M64P_SetFrameCallback(CV64_FrameCallback callback, void* context) {
     CV64_M64P_Static_SetFrameCallback(callback, context);
 }
@@ -0,0 +1,141 @@
+/**
+ * @file cv64_mapped_file.cpp
+ * @brief Castlevania 64 PC Recomp - Read-only memory-mapped files
+ *
+ * @copyright 2024 CV64 Recomp Team
+ */
+
+#include "../include/cv64_mapped_file.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool CV64_MappedFile_Open(const char* path, CV64_MappedFile* file) {
+    if (!file) {
+        return false;
+    }
+    memset(file, 0, sizeof(CV64_MappedFile));
+    if (!path) {
+        return false;
+    }
+
+#ifdef _WIN32
+    HANDLE fh = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (fh == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || size.QuadPart <= 0 ||
+        (u64)size.QuadPart > (u64)SIZE_MAX) {
+        CloseHandle(fh);
+        return false;
+    }
+
+    HANDLE mh = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mh) {
+        CloseHandle(fh);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mh);
+        CloseHandle(fh);
+        return false;
+    }
+
+    file->data = (const u8*)view;
+    file->size = (size_t)size.QuadPart;
+    file->fileHandle = fh;
+    file->mapHandle = mh;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  /* The mapping keeps the file referenced */
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    madvise(view, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    file->data = (const u8*)view;
+    file->size = (size_t)st.st_size;
+#endif
+
+    return true;
+}
+
+void CV64_MappedFile_Advise(const CV64_MappedFile* file, size_t offset, size_t size,
+                            CV64_MapAdvice advice) {
+    if (!file || !file->data || offset >= file->size || size == 0) {
+        return;
+    }
+    if (size > file->size - offset) {
+        size = file->size - offset;
+    }
+
+#ifdef _WIN32
+    if (advice != CV64_MAP_ADVICE_WILLNEED) {
+        return;
+    }
+
+    typedef BOOL (WINAPI *PrefetchFunc)(HANDLE, ULONG_PTR, PWIN32_MEMORY_RANGE_ENTRY, ULONG);
+    static PrefetchFunc s_prefetch = (PrefetchFunc)GetProcAddress(
+        GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory");
+    if (s_prefetch) {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = (PVOID)(file->data + offset);
+        range.NumberOfBytes = size;
+        s_prefetch(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    static const size_t s_pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset & ~(s_pageSize - 1);
+    int flag = MADV_NORMAL;
+    switch (advice) {
+        case CV64_MAP_ADVICE_SEQUENTIAL: flag = MADV_SEQUENTIAL; break;
+        case CV64_MAP_ADVICE_RANDOM:     flag = MADV_RANDOM; break;
+        case CV64_MAP_ADVICE_WILLNEED:   flag = MADV_WILLNEED; break;
+        default:                         break;
+    }
+    madvise((void*)(file->data + start), offset + size - start, flag);
+#endif
+}
+
+void CV64_MappedFile_Close(CV64_MappedFile* file) {
+    if (!file || !file->data) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(file->data);
+    if (file->mapHandle) {
+        CloseHandle((HANDLE)file->mapHandle);
+    }
+    if (file->fileHandle) {
+        CloseHandle((HANDLE)file->fileHandle);
+    }
+#else
+    munmap((void*)file->data, file->size);
+#endif
+
+    memset(file, 0, sizeof(CV64_MappedFile));
+}
@@ -10,6 +10,8 @@
  * - Thread-safe access to RDRAM pointer via atomic operations
  * - Addresses are validated before every read/write
  * - Failed operations return safe default values
+ * - Fixed-address game state is gathered once per frame into a snapshot
+ *   (GatherSnapshot) and all readers use that copy
  * 
  * @copyright 2024 CV64 Recomp Team
  */
@@ -17,13 +19,22 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "../include/cv64_memory_hook.h"
+#include "../include/cv64_actor_table.h"
 #include "../include/cv64_memory_map.h"
 #include "../include/cv64_camera_patch.h"
 #include "../include/cv64_controller.h"
+#include "../include/cv64_cpu_features.h"
+#include "../include/cv64_gameshark.h"
+#include "../include/cv64_seqlock.h"
 #include <Windows.h>
+#include <cstddef>
 #include <cstring>
 #include <cstdio>
 #include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <vector>
 
 /*===========================================================================
  * mupen64plus-core internals for dynarec cache invalidation
@@ -66,18 +77,42 @@ static std::atomic<s32> s_camera_zoom_mult_x1000{1000};  /* stored as int*1000 f
 
 /* Enhanced state tracking */
 static std::atomic<CV64_GameState> s_game_state{CV64_STATE_NOT_RUNNING};
-static std::atomic<s16> s_last_map_id{-1};
 static CV64_MapChangeCallback s_map_change_callback = nullptr;
 static std::atomic<bool> s_is_soft_reset{false};
 static std::atomic<u32> s_game_time{0};
 static std::atomic<bool> s_is_daytime{true};
 
+/* Per-frame RDRAM snapshot. The emulation thread publishes it through the
+ * seqlock; each reader keeps its own thread_local copy and reloads it only
+ * when the generation changes (see CV64_Memory_GetSnapshot). */
+static CV64_Seqlock<CV64_RDRAMSnapshot> s_snapshot;
+static std::atomic<u32> s_snapshot_first_gen{1};    /* Older generations predate the current RDRAM */
+static u32 s_snapshot_frame = 0;                    /* Emulation thread only */
+
+/* Fields inside RDRAM (gathered), and the subset the hook itself may use
+ * under IsAddressValid()'s policy. Both depend only on RDRAM size. */
+static std::atomic<u64> s_snapshot_bounds_mask{0};
+static std::atomic<u64> s_snapshot_hook_mask{0};
+static std::atomic<u32> s_snapshot_camera_mgr{0};
+
+/* CV64_GameInfo built once per frame on the emulation thread and published
+ * to every other thread through a seqlock */
+struct PublishedGameInfo {
+    CV64_GameInfo info;
+    bool valid;
+};
+static CV64_Seqlock<PublishedGameInfo> s_game_info;
+
 /*===========================================================================
  * Forward Declarations
  *===========================================================================*/
 
 static s16 ReadCurrentMapId(void);
-static CV64_GameState ComputeGameState(u8* rdram, s16 mapId);
+static CV64_GameState ComputeGameState(const CV64_RDRAMSnapshot* snap, s16 mapId);
+static void SnapshotSetRDRAMSize(u32 size);
+static void DirtySetRDRAM(void);
+static void GatherSnapshot(u8* rdram);
+static void PublishGameInfo(void);
 
 /*===========================================================================
  * Debug Logging
@@ -150,6 +185,31 @@ static inline u32 CV64_VirtToPhys(u32 addr) {
     return addr & 0x1FFFFFFF;
 }
 
+/**
+ * @brief Latest published snapshot, or NULL before the first gather
+ *
+ * Returns the calling thread's copy, refreshed through the seqlock when a
+ * newer frame was published, so a concurrent gather never tears it.
+ */
+static inline const CV64_RDRAMSnapshot* SnapGet(void) {
+    static thread_local CV64_RDRAMSnapshot t_snap;
+    static thread_local u32 t_gen = 0;
+    if (s_snapshot.Generation() != t_gen) {
+        t_gen = s_snapshot.Load(t_snap);
+    }
+    if (t_gen < s_snapshot_first_gen.load(std::memory_order_acquire)) return nullptr;
+    return &t_snap;
+}
+
+/**
+ * @brief Check a snapshot field is present and passes IsAddressValid()
+ */
+static inline bool SnapHas(const CV64_RDRAMSnapshot* snap, CV64_SnapField field) {
+    if (!snap) return false;
+    u64 mask = snap->validMask & s_snapshot_hook_mask.load(std::memory_order_relaxed);
+    return ((mask >> field) & 1u) != 0;
+}
+
 /*===========================================================================
  * Memory Initialization
  *===========================================================================*/
@@ -173,6 +233,8 @@ void CV64_Memory_SetRDRAM(u8* rdram, u32 size) {
     
     s_rdram.store(rdram, std::memory_order_release);
     s_rdram_size.store(size, std::memory_order_release);
+    SnapshotSetRDRAMSize(rdram ? size : 0);
+    DirtySetRDRAM();
     s_initialized.store(rdram != nullptr && size > 0, std::memory_order_release);
     
     if (s_initialized.load()) {
@@ -218,43 +280,25 @@ static u32 ReadCameraMgrPtr(void) {
     if (!rdram) return 0;
 
     /* Use the fixed BSS address directly — more reliable than pointer-chasing
-     * through system_work + CV64_SYS_OFFSET_CAMERA_MGR_PTR */
-    if (!IsAddressValid(CV64_ADDR_CAMERA_MGR, 0x90)) {
-        static bool logged = false;
-        if (!logged) {
-            LogWarning("ReadCameraMgrPtr: BSS address 0x%08X out of bounds", CV64_ADDR_CAMERA_MGR);
-            logged = true;
-        }
-        return 0;
-    }
-
-    return CV64_ADDR_CAMERA_MGR;
+     * through system_work + CV64_SYS_OFFSET_CAMERA_MGR_PTR. Validated once
+     * per RDRAM mapping in SnapshotSetRDRAMSize. */
+    return s_snapshot_camera_mgr.load(std::memory_order_relaxed);
 }
 
 /**
  * @brief Read pointer to Player from system_work
  */
 static u32 ReadPlayerPtr(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return 0;
-    
-    u32 addr = s_system_work_addr + CV64_SYS_OFFSET_PLAYER_PTR;
-    if (!IsAddressValid(addr, 4)) return 0;
-    
-    return CV64_ReadU32(rdram, addr);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_PLAYER_PTR) ? snap->playerPtr : 0;
 }
 
 /**
  * @brief Read current menu state
  */
 static u16 ReadCurrentMenu(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return 0;
-    
-    u32 addr = s_system_work_addr + CV64_SYS_OFFSET_CURRENT_MENU;
-    if (!IsAddressValid(addr, 2)) return 0;
-    
-    return CV64_ReadU16(rdram, addr);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_CURRENT_MENU) ? snap->currentMenu : 0;
 }
 
 /*===========================================================================
@@ -749,19 +793,13 @@ bool CV64_Memory_ShouldDPadControlCamera(void) {
     if (state != CV64_STATE_GAMEPLAY) return false;
 
     /* Check first-person and R-lock flags from verified sym addresses */
-    u8* rdram = SafeGetRDRAM();
-    if (rdram) {
-        /* Don't override camera during first-person view (C-Up) */
-        if (IsAddressValid(CV64_ADDR_IN_FIRST_PERSON, 4)) {
-            if (CV64_ReadU32(rdram, CV64_ADDR_IN_FIRST_PERSON) != 0)
-                return false;
-        }
-        /* Don't override camera during R-button lock */
-        if (IsAddressValid(CV64_ADDR_R_LOCK_VIEW, 4)) {
-            if (CV64_ReadU32(rdram, CV64_ADDR_R_LOCK_VIEW) != 0)
-                return false;
-        }
-    }
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    /* Don't override camera during first-person view (C-Up) */
+    if (SnapHas(snap, CV64_SNAP_IN_FIRST_PERSON) && snap->inFirstPerson != 0)
+        return false;
+    /* Don't override camera during R-button lock */
+    if (SnapHas(snap, CV64_SNAP_R_LOCK_VIEW) && snap->rLockView != 0)
+        return false;
 
     return true;
 }
@@ -821,77 +859,6 @@ bool CV64_Memory_IsCameraPatchCheatEnabled(void) {
     return s_cheat_camera_patch_enabled;
 }
 
-/**
- * @brief Safely apply a single Gameshark-style memory write
- * @return true if write succeeded, false if address out of bounds
- */
-static bool SafeApplyCheatWrite16(u32 addr, u16 value) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) {
-        static bool loggedNoRdram = false;
-        if (!loggedNoRdram) {
-            LogWarning("SafeApplyCheatWrite16: RDRAM not available");
-            loggedNoRdram = true;
-        }
-        return false;
-    }
-    
-    if (!IsAddressValid(addr, 2)) {
-        static u32 lastFailedAddr = 0;
-        if (addr != lastFailedAddr) {
-            u32 offset = N64_ADDR_TO_OFFSET(addr);
-            u32 size = s_rdram_size.load(std::memory_order_acquire);
-            LogWarning("SafeApplyCheatWrite16: Address 0x%08X (offset 0x%06X) out of bounds (RDRAM size: 0x%X)",
-                       addr, offset, size);
-            lastFailedAddr = addr;
-        }
-        return false;
-    }
-    
-    /* Write directly to RDRAM using the dynamic size for validation */
-    u32 offset = N64_ADDR_TO_OFFSET(addr);
-    u8* ptr = rdram + offset;
-    
-    /* Write big-endian 16-bit value */
-    ptr[0] = (value >> 8) & 0xFF;
-    ptr[1] = value & 0xFF;
-    
-    return true;
-}
-
-/**
- * @brief Apply all active Gameshark cheats
- * Called every frame to continuously apply memory modifications.
- * Uses safe memory access that validates bounds before writing.
- */
-static void ApplyGamesharkCheats(void) {
-    if (!s_initialized.load(std::memory_order_acquire)) return;
-    
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return;
-    
-    /* Log RDRAM info once */
-    static bool s_rdram_info_logged = false;
-    if (!s_rdram_info_logged) {
-        u32 size = s_rdram_size.load(std::memory_order_acquire);
-        LogInfo("ApplyGamesharkCheats: RDRAM available at %p, size=0x%X (%u MB)",
-                rdram, size, size / (1024 * 1024));
-        s_rdram_info_logged = true;
-    }
-    
-    /* Camera Patch - Our main feature! 
-     * This enables D-PAD/right stick camera control by updating camera angles
-     * based on user input. The actual camera update happens in CV64_CameraPatch_Update
-     * which is called from CV64_Memory_FrameUpdate */
-    if (s_cheat_camera_patch_enabled) {
-        if (!s_cheat_camera_logged) {
-            LogInfo("Camera Patch active: D-PAD and Right Stick will control camera rotation");
-            s_cheat_camera_logged = true;
-        }
-        /* Camera patch is applied via CV64_CameraPatch_Update in FrameUpdate */
-    }
-}
-
 /*===========================================================================
  * Additional Cheats - Lag Reduction & Performance Fixes
  *===========================================================================*/
@@ -909,45 +876,51 @@ static void ApplyGamesharkCheats(void) {
 #define CV64_CHEAT_LAG_DIVISIONS_ADDR   0x80096AC0  /* u32: processMeter_number_of_divisions */
 
 /**
- * @brief Forest of Silence FPS Fix
- * 
- * Uses verified addresses from CASTLEVANIA.sym to reduce processing load:
- *   processBar_sizeDivisor (0x80096AC4, float) — increase frame budget
- *   fog_distance_end (0x80387AE2, u16) — push fog end farther to reduce re-draws
- *   dont_update_map_lighting (0x80185F7C, u32) — skip per-frame lighting recalc
- */
-#define CV64_CHEAT_FOREST_DIVISOR_ADDR  0x80096AC4  /* float: processBar_sizeDivisor */
-#define CV64_CHEAT_FOREST_FOG_END_ADDR  0x80387AE2  /* u16: fog_distance_end */
-#define CV64_CHEAT_FOREST_LIGHTING_ADDR 0x80185F7C  /* u32: dont_update_map_lighting */
-
-/**
- * @brief Infinite Health Cheat
- * Verified CV64 v1.0 USA cheat code from mupencheat.txt:
- *   81389C3E 0064  - Set HP to 100
- * sym: Player_health at 0x80389C3E (system_work + 0x26186)
+ * @brief Moon Jump button check (read into the per-frame snapshot)
+ * sym: system_work button state byte tested by the D0 code below
  */
-#define CV64_CHEAT_HEALTH_ADDR          0x80389C3E
-#define CV64_CHEAT_HEALTH_VALUE         0x0064
+#define CV64_CHEAT_MOONJUMP_CHECK_ADDR  0x80387D7F
 
 /**
- * @brief Infinite Sub-weapon Ammo
- * Verified CV64 v1.0 USA cheat code from mupencheat.txt:
- *   81389C48 0064  - Set sub-weapon count to 100
- * system_work + 0x26190
+ * @brief Built-in cheats that are plain code lists
+ *
+ * These run through the GameShark engine like any user list; the setters
+ * below only toggle the list.
+ *
+ * Forest of Silence FPS Fix (map_ID 0x80389EE0 == 0, MORI), using verified
+ * addresses from CASTLEVANIA.sym to reduce processing load:
+ *   processBar_sizeDivisor (0x80096AC4, float) = 6.0 - larger frame budget
+ *   fog_distance_end (0x80387AE2, u16) = 1200 - less overdraw recalculation
+ *   dont_update_map_lighting (0x80185F7C, u32) = 1 - skip per-frame lighting
+ *
+ * Infinite Health / Sub-weapon / Moon Jump are the verified CV64 v1.0 USA
+ * codes from mupencheat.txt:
+ *   Player_health at 0x80389C3E (system_work + 0x26186)
+ *   sub-weapon count at 0x80389C48 (system_work + 0x26190)
+ *   Moon Jump: if L held (0x80387D7F == 0x20), set player Y velocity high
  */
-#define CV64_CHEAT_SUBWEAPON_ADDR       0x80389C48
-#define CV64_CHEAT_SUBWEAPON_VALUE      0x0063
+enum BuiltinCheat {
+    BUILTIN_CHEAT_FOREST_FIX = 0,
+    BUILTIN_CHEAT_INFINITE_HEALTH,
+    BUILTIN_CHEAT_INFINITE_SUBWEAPON,
+    BUILTIN_CHEAT_MOON_JUMP,
+    BUILTIN_CHEAT_COUNT
+};
 
-/**
- * @brief Moon Jump - Increase Y velocity when L is held
- * Verified CV64 v1.0 USA cheat code from mupencheat.txt:
- *   D0387D7F 0020  - If L pressed (button check in system_work)
- *   81350810 3FCB  - Set Y velocity high (in player object)
- */
-#define CV64_CHEAT_MOONJUMP_CHECK_ADDR  0x80387D7F
-#define CV64_CHEAT_MOONJUMP_WRITE_ADDR  0x80350810
-#define CV64_CHEAT_MOONJUMP_L_BUTTON    0x0020
-#define CV64_CHEAT_MOONJUMP_VALUE       0x3FCB
+static const struct {
+    const char* name;
+    const char* codes;
+} s_builtinCheats[BUILTIN_CHEAT_COUNT] = {
+    { "Forest FPS Fix",
+      "D1389EE0 0000\n81096AC4 40C0\n"
+      "D1389EE0 0000\n81096AC6 0000\n"
+      "D1389EE0 0000\n81387AE2 04B0\n"
+      "D1389EE0 0000\n81185F7C 0000\n"
+      "D1389EE0 0000\n81185F7E 0001\n" },
+    { "Infinite Health",     "81389C3E 0064\n" },
+    { "Infinite Sub-weapon", "81389C48 0063\n" },
+    { "Moon Jump",           "D0387D7F 0020\n81350810 3FCB\n" },
+};
 
 /* Cheat enable flags */
 static bool s_cheat_lag_reduction_enabled = false;  /* Uses processBar_sizeDivisor */
@@ -965,12 +938,27 @@ static f32 s_draw_distance_multiplier = 2.5f;  /* how much farther to push fog *
 
 /* Logging flags */
 static bool s_cheat_lag_logged = false;
-static bool s_cheat_forest_logged = false;
-static bool s_cheat_health_logged = false;
-static bool s_cheat_subweapon_logged = false;
-static bool s_cheat_moonjump_logged = false;
 static bool s_cheat_draw_logged = false;
 
+/**
+ * @brief Compile the built-in code lists on first use and toggle one
+ */
+static void SetBuiltinCheat(BuiltinCheat which, bool enabled) {
+    static s32 s_builtin_list_ids[BUILTIN_CHEAT_COUNT];
+    static const bool s_builtins_registered = [] {
+        for (int i = 0; i < BUILTIN_CHEAT_COUNT; i++) {
+            s_builtin_list_ids[i] = CV64_GameShark_AddList(s_builtinCheats[i].name,
+                                                           s_builtinCheats[i].codes, false, nullptr);
+        }
+        return true;
+    }();
+    (void)s_builtins_registered;
+
+    if (!CV64_GameShark_SetListEnabled(s_builtin_list_ids[which], enabled)) {
+        LogWarning("Built-in cheat '%s' failed to compile", s_builtinCheats[which].name);
+    }
+}
+
 void CV64_Memory_SetLagReductionCheat(bool enabled) {
     s_cheat_lag_reduction_enabled = enabled;
     s_cheat_lag_logged = false;
@@ -983,7 +971,7 @@ bool CV64_Memory_IsLagReductionCheatEnabled(void) {
 
 void CV64_Memory_SetForestFpsFixCheat(bool enabled) {
     s_cheat_forest_fix_enabled = enabled;
-    s_cheat_forest_logged = false;
+    SetBuiltinCheat(BUILTIN_CHEAT_FOREST_FIX, enabled);
     LogInfo("Forest FPS Fix cheat %s", enabled ? "ENABLED" : "DISABLED");
 }
 
@@ -993,7 +981,7 @@ bool CV64_Memory_IsForestFpsFixCheatEnabled(void) {
 
 void CV64_Memory_SetInfiniteHealthCheat(bool enabled) {
     s_cheat_infinite_health_enabled = enabled;
-    s_cheat_health_logged = false;
+    SetBuiltinCheat(BUILTIN_CHEAT_INFINITE_HEALTH, enabled);
     LogInfo("Infinite Health cheat %s", enabled ? "ENABLED" : "DISABLED");
 }
 
@@ -1003,7 +991,7 @@ bool CV64_Memory_IsInfiniteHealthCheatEnabled(void) {
 
 void CV64_Memory_SetInfiniteSubweaponCheat(bool enabled) {
     s_cheat_infinite_subweapon_enabled = enabled;
-    s_cheat_subweapon_logged = false;
+    SetBuiltinCheat(BUILTIN_CHEAT_INFINITE_SUBWEAPON, enabled);
     LogInfo("Infinite Sub-weapon cheat %s", enabled ? "ENABLED" : "DISABLED");
 }
 
@@ -1013,7 +1001,7 @@ bool CV64_Memory_IsInfiniteSubweaponCheatEnabled(void) {
 
 void CV64_Memory_SetMoonJumpCheat(bool enabled) {
     s_cheat_moon_jump_enabled = enabled;
-    s_cheat_moonjump_logged = false;
+    SetBuiltinCheat(BUILTIN_CHEAT_MOON_JUMP, enabled);
     LogInfo("Moon Jump cheat %s", enabled ? "ENABLED" : "DISABLED");
 }
 
@@ -1132,11 +1120,12 @@ static void ApplyPerformanceCheats(void) {
         }
 
         /* Read process meter to detect frame pressure */
+        const CV64_RDRAMSnapshot* snap = SnapGet();
         f32 greenBar = 0.0f, blueBar = 0.0f;
-        if (IsAddressValid(CV64_ADDR_PROCESS_GREEN_SIZE, 4))
-            greenBar = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_GREEN_SIZE);
-        if (IsAddressValid(CV64_ADDR_PROCESS_BLUE_SIZE, 4))
-            blueBar = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_BLUE_SIZE);
+        if (SnapHas(snap, CV64_SNAP_PROCESS_GREEN))
+            greenBar = snap->processGreenSize;
+        if (SnapHas(snap, CV64_SNAP_PROCESS_BLUE))
+            blueBar = snap->processBlueSize;
 
         f32 totalLoad = greenBar + blueBar;
 
@@ -1174,30 +1163,6 @@ static void ApplyPerformanceCheats(void) {
         }
     }
 
-    /* Forest FPS Fix — Only apply in Forest areas (map ID 0x02 or 0x03)
-     * Increases process budget further and reduces lighting recalculation */
-    if (s_cheat_forest_fix_enabled) {
-        s16 mapId = CV64_Memory_GetCurrentMapId();
-        if (mapId == 0x00) {  // MORI = Forest of Silence
-            bool success = true;
-            /* Larger budget for forest's heavy object load */
-            success &= CV64_WriteF32(rdram, CV64_CHEAT_FOREST_DIVISOR_ADDR, 6.0f);
-            /* Push fog end slightly farther to reduce overdraw recalculation */
-            success &= CV64_WriteU16(rdram, CV64_CHEAT_FOREST_FOG_END_ADDR, 1200);
-            /* Skip per-frame lighting recalc (trees/shadows) */
-            success &= CV64_WriteU32(rdram, CV64_CHEAT_FOREST_LIGHTING_ADDR, 1);
-
-            if (!s_cheat_forest_logged) {
-                if (success) {
-                    LogInfo("Forest FPS Fix applied (Map %d): divisor=6.0, fogEnd=1200, skipLighting=1", mapId);
-                } else {
-                    LogWarning("Forest FPS Fix: Some addresses failed (Map %d)", mapId);
-                }
-                s_cheat_forest_logged = true;
-            }
-        }
-    }
-
     /* Extended Draw Distance — push fog start/end farther to increase visibility.
      * Reads the game's default fog values on map load, then applies a multiplier.
      * Each map has different fog settings so we scale rather than hardcode. */
@@ -1206,10 +1171,11 @@ static void ApplyPerformanceCheats(void) {
 
         /* Snapshot the game's original fog values when entering a new map */
         if (mapId != s_fog_snapshot_map && mapId >= 0) {
-            if (IsAddressValid(CV64_ADDR_FOG_DIST_START, 2) &&
-                IsAddressValid(CV64_ADDR_FOG_DIST_END, 2)) {
-                u16 curStart = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_START);
-                u16 curEnd   = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_END);
+            const CV64_RDRAMSnapshot* snap = SnapGet();
+            if (SnapHas(snap, CV64_SNAP_FOG_DIST_START) &&
+                SnapHas(snap, CV64_SNAP_FOG_DIST_END)) {
+                u16 curStart = snap->fogDistStart;
+                u16 curEnd   = snap->fogDistEnd;
                 /* Only snapshot if game has set real values (not 0) */
                 if (curEnd > 0) {
                     s_fog_original_start = curStart;
@@ -1255,62 +1221,682 @@ static void ApplyPerformanceCheats(void) {
 }
 
 /**
- * @brief Apply gameplay cheats (infinite health, sub-weapon, etc.)
+ * @brief Run all enabled GameShark code lists (built-in and user) once
+ *
+ * Runs after the adaptive cheats so fixed code lists have the last word,
+ * as they did when the Forest FPS Fix was applied after lag tuning.
  */
-static void ApplyGameplayCheats(void) {
+static void ApplyGamesharkCheats(void) {
     u8* rdram = SafeGetRDRAM();
     if (!rdram) return;
+
+    /* Camera Patch has no code list; it is applied via CV64_CameraPatch_Update
+     * in FrameUpdate */
+    if (s_cheat_camera_patch_enabled && !s_cheat_camera_logged) {
+        LogInfo("Camera Patch active: D-PAD and Right Stick will control camera rotation");
+        s_cheat_camera_logged = true;
+    }
+
+    CV64_GameShark_Run(rdram, s_rdram_size.load(std::memory_order_acquire));
+}
+
+/**
+ * @brief Public API to apply all cheats
+ * This is automatically called each frame from CV64_Memory_FrameUpdate
+ */
+void CV64_Memory_ApplyAllCheats(void) {
+    if (!s_initialized.load(std::memory_order_acquire)) return;
     
-    /* Infinite Health */
-    if (s_cheat_infinite_health_enabled) {
-        if (SafeApplyCheatWrite16(CV64_CHEAT_HEALTH_ADDR, CV64_CHEAT_HEALTH_VALUE)) {
-            if (!s_cheat_health_logged) {
-                LogInfo("Infinite Health cheat applied: HP locked at %d", CV64_CHEAT_HEALTH_VALUE);
-                s_cheat_health_logged = true;
-            }
+    ApplyPerformanceCheats();
+    ApplyGamesharkCheats();
+}
+
+/*===========================================================================
+ * Per-Frame RDRAM Snapshot
+ *===========================================================================*/
+
+/**
+ * @brief One watched field: where it lives in RDRAM and where it lands
+ *
+ * size is the snapshot member's size. 1- and 2-byte fields are fetched
+ * through the same byte/half-word lane swizzle as CV64_ReadU8/U16; larger
+ * fields are runs of host-order words.
+ */
+struct SnapFieldDesc {
+    u32 addr;
+    u16 offset;
+    u16 size;
+    u32 id;
+};
+
+#define CV64_SNAP_FIELD(id, member, addr) \
+    { (u32)(addr), (u16)offsetof(CV64_RDRAMSnapshot, member), \
+      (u16)sizeof(((CV64_RDRAMSnapshot*)0)->member), (u32)(id) }
+
+/* Indexed by CV64_SnapField. current_player_position is listed by physical
+ * address, which is how ReadExtendedSaveData has always validated it. */
+static constexpr SnapFieldDesc s_snapFields[CV64_SNAP_FIELD_COUNT] = {
+    CV64_SNAP_FIELD(CV64_SNAP_PLAYER_PTR,          playerPtr,          CV64_ADDR_SYSTEM_WORK + CV64_SYS_OFFSET_PLAYER_PTR),
+    CV64_SNAP_FIELD(CV64_SNAP_GOLD,                gold,               CV64_ADDR_SAVE_GOLD),
+    CV64_SNAP_FIELD(CV64_SNAP_IN_GAMEPLAY_LOOP,    inGameplayLoop,     CV64_ADDR_IN_GAMEPLAY_LOOP),
+    CV64_SNAP_FIELD(CV64_SNAP_GAME_TIME,           gameTime,           CV64_ADDR_GAME_TIME),
+    CV64_SNAP_FIELD(CV64_SNAP_IN_FIRST_PERSON,     inFirstPerson,      CV64_ADDR_IN_FIRST_PERSON),
+    CV64_SNAP_FIELD(CV64_SNAP_R_LOCK_VIEW,         rLockView,          CV64_ADDR_R_LOCK_VIEW),
+    CV64_SNAP_FIELD(CV64_SNAP_PROCESS_GREEN,       processGreenSize,   CV64_ADDR_PROCESS_GREEN_SIZE),
+    CV64_SNAP_FIELD(CV64_SNAP_PROCESS_BLUE,        processBlueSize,    CV64_ADDR_PROCESS_BLUE_SIZE),
+    CV64_SNAP_FIELD(CV64_SNAP_PROCESS_DIVISOR,     processBarDivisor,  CV64_ADDR_PROCESS_BAR_DIVISOR),
+    CV64_SNAP_FIELD(CV64_SNAP_PROCESS_DIVISIONS,   processDivisions,   CV64_ADDR_PROCESS_DIVISIONS),
+    CV64_SNAP_FIELD(CV64_SNAP_BOSS_BAR_COLOR,      bossBarFillColor,   CV64_ADDR_BOSS_BAR_FILL_COLOR),
+    CV64_SNAP_FIELD(CV64_SNAP_FOG_COLOR,           fogColor,           CV64_ADDR_MAP_FOG_COLOR),
+    CV64_SNAP_FIELD(CV64_SNAP_AMBIENT_BRIGHT,      ambientBrightness,  CV64_ADDR_MAP_AMBIENT_BRIGHT),
+    CV64_SNAP_FIELD(CV64_SNAP_DIFFUSE_COLOR,       diffuseColor,       CV64_ADDR_MAP_DIFFUSE_COLOR),
+    CV64_SNAP_FIELD(CV64_SNAP_DONT_UPDATE_LIGHTING, dontUpdateLighting, CV64_ADDR_DONT_UPDATE_LIGHTING),
+    CV64_SNAP_FIELD(CV64_SNAP_ENEMY_TARGET_PTR,    enemyTargetGfxPtr,  CV64_ADDR_PTR_ENEMY_TARGET_GFX),
+    CV64_SNAP_FIELD(CV64_SNAP_PLAYER_POS,          playerPos,          CV64_ADDR_CURRENT_PLAYER_POS & 0x1FFFFFFF),
+    CV64_SNAP_FIELD(CV64_SNAP_MAP_ID,              mapId,              CV64_ADDR_SYSTEM_WORK + CV64_SYS_OFFSET_MAP_ID),
+    CV64_SNAP_FIELD(CV64_SNAP_CURRENT_MENU,        currentMenu,        CV64_ADDR_SYSTEM_WORK + CV64_SYS_OFFSET_CURRENT_MENU),
+    CV64_SNAP_FIELD(CV64_SNAP_CHARACTER,           character,          CV64_ADDR_SAVE_CHARACTER),
+    CV64_SNAP_FIELD(CV64_SNAP_HEALTH,              health,             CV64_ADDR_SAVE_HEALTH),
+    CV64_SNAP_FIELD(CV64_SNAP_MAX_HEALTH,          maxHealth,          CV64_ADDR_SAVE_MAX_HEALTH),
+    CV64_SNAP_FIELD(CV64_SNAP_SUBWEAPON,           subweapon,          CV64_ADDR_SAVE_SUBWEAPON),
+    CV64_SNAP_FIELD(CV64_SNAP_SUBWEAPON_AMMO,      subweaponAmmo,      CV64_ADDR_SAVE_SUBWEAPON_AMMO),
+    CV64_SNAP_FIELD(CV64_SNAP_MAP_ENTRANCE,        mapEntrance,        CV64_ADDR_SAVE_MAP_ENTRANCE),
+    CV64_SNAP_FIELD(CV64_SNAP_IS_SOFT_RESET,       isSoftReset,        CV64_ADDR_IS_SOFT_RESET),
+    CV64_SNAP_FIELD(CV64_SNAP_FADE_SETTINGS,       fadeSettings,       CV64_ADDR_FADE_SETTINGS),
+    CV64_SNAP_FIELD(CV64_SNAP_FADE_CURRENT_TIME,   fadeCurrentTime,    CV64_ADDR_FADE_CURRENT_TIME),
+    CV64_SNAP_FIELD(CV64_SNAP_FADE_MAX_TIME,       fadeMaxTime,        CV64_ADDR_FADE_MAX_TIME),
+    CV64_SNAP_FIELD(CV64_SNAP_MAP_FADE_OUT_TIME,   mapFadeOutTime,     CV64_ADDR_MAP_FADE_OUT_TIME),
+    CV64_SNAP_FIELD(CV64_SNAP_READING_TEXT,        readingText,        CV64_ADDR_READING_TEXT),
+    CV64_SNAP_FIELD(CV64_SNAP_CUTSCENE_ID,         cutsceneId,         CV64_ADDR_CUTSCENE_ID),
+    CV64_SNAP_FIELD(CV64_SNAP_FOG_DIST_START,      fogDistStart,       CV64_ADDR_FOG_DIST_START),
+    CV64_SNAP_FIELD(CV64_SNAP_FOG_DIST_END,        fogDistEnd,         CV64_ADDR_FOG_DIST_END),
+    CV64_SNAP_FIELD(CV64_SNAP_JEWELS,              jewels,             CV64_ADDR_SAVE_JEWELS),
+    CV64_SNAP_FIELD(CV64_SNAP_DIFFICULTY,          difficulty,         CV64_ADDR_SAVE_DIFFICULTY),
+    CV64_SNAP_FIELD(CV64_SNAP_SAVE_FILE_NUMBER,    saveFileNumber,     CV64_ADDR_SAVE_FILE_NUMBER),
+    CV64_SNAP_FIELD(CV64_SNAP_POWERUP,             powerupLevel,       CV64_ADDR_SAVE_POWERUP),
+    CV64_SNAP_FIELD(CV64_SNAP_COSTUME,             alternateCostume,   CV64_ADDR_SAVE_COSTUME),
+    CV64_SNAP_FIELD(CV64_SNAP_CONTPAK_FILE_NO,     contPakFileNo,      CV64_ADDR_CONTPAK_FILE_NO),
+    CV64_SNAP_FIELD(CV64_SNAP_HAS_MAX_HEALTH,      hasMaxHealth,       CV64_ADDR_HAS_MAX_HEALTH),
+    CV64_SNAP_FIELD(CV64_SNAP_MOONJUMP_BUTTONS,    moonJumpButtons,    CV64_CHEAT_MOONJUMP_CHECK_ADDR),
+};
+
+#undef CV64_SNAP_FIELD
+
+static_assert(CV64_SNAP_FIELD_COUNT <= 64, "validMask is 64 bits");
+static_assert([] {
+    for (u32 i = 0; i < CV64_SNAP_FIELD_COUNT; i++) {
+        const SnapFieldDesc& f = s_snapFields[i];
+        if (f.id != i) return false;
+        if (f.size != 1 && f.size != 2 && (f.size % 4) != 0) return false;
+        if ((f.addr % (f.size < 4 ? f.size : 4)) != 0) return false;
+    }
+    return true;
+}(), "s_snapFields must be in CV64_SnapField order with naturally aligned addresses");
+
+/**
+ * @brief Recompute which fields can be gathered for a given RDRAM size
+ * Called from CV64_Memory_SetRDRAM so the per-frame pass does no validation.
+ */
+static void SnapshotSetRDRAMSize(u32 size) {
+    u64 bounds = 0;
+    u64 hook = 0;
+    if (size != 0) {
+        for (u32 i = 0; i < CV64_SNAP_FIELD_COUNT; i++) {
+            const SnapFieldDesc& f = s_snapFields[i];
+            if (!N64_ADDR_IS_VALID(f.addr, f.size, size)) continue;
+            bounds |= 1ull << i;
+            if (IsAddressValid(f.addr, f.size)) hook |= 1ull << i;
         }
     }
-    
-    /* Infinite Sub-weapon */
-    if (s_cheat_infinite_subweapon_enabled) {
-        if (SafeApplyCheatWrite16(CV64_CHEAT_SUBWEAPON_ADDR, CV64_CHEAT_SUBWEAPON_VALUE)) {
-            if (!s_cheat_subweapon_logged) {
-                LogInfo("Infinite Sub-weapon cheat applied: Ammo locked at %d", CV64_CHEAT_SUBWEAPON_VALUE);
-                s_cheat_subweapon_logged = true;
-            }
+
+    u32 cameraMgr = 0;
+    if (size != 0) {
+        if (IsAddressValid(CV64_ADDR_CAMERA_MGR, 0x90)) {
+            cameraMgr = CV64_ADDR_CAMERA_MGR;
+        } else {
+            LogWarning("ReadCameraMgrPtr: BSS address 0x%08X out of bounds", CV64_ADDR_CAMERA_MGR);
         }
     }
-    
-    /* Moon Jump - check if L button is held (byte check per D0 cheat code format) */
-    if (s_cheat_moon_jump_enabled) {
-        if (IsAddressValid(CV64_CHEAT_MOONJUMP_CHECK_ADDR, 1)) {
-            u8 buttons = CV64_ReadU8(rdram, CV64_CHEAT_MOONJUMP_CHECK_ADDR);
-            if (buttons & CV64_CHEAT_MOONJUMP_L_BUTTON) {
-                SafeApplyCheatWrite16(CV64_CHEAT_MOONJUMP_WRITE_ADDR, CV64_CHEAT_MOONJUMP_VALUE);
-                if (!s_cheat_moonjump_logged) {
-                    LogInfo("Moon Jump cheat active: Hold L to jump higher");
-                    s_cheat_moonjump_logged = true;
-                }
+
+    s_snapshot_first_gen.store(s_snapshot.Generation() + 1, std::memory_order_release);
+    s_snapshot_bounds_mask.store(bounds, std::memory_order_relaxed);
+    s_snapshot_hook_mask.store(hook, std::memory_order_relaxed);
+    s_snapshot_camera_mgr.store(cameraMgr, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copy every watched field out of RDRAM and publish the result
+ * One pass per VI, on the emulation thread, before anything reads game state.
+ */
+static void GatherSnapshot(u8* rdram) {
+    const u64 mask = s_snapshot_bounds_mask.load(std::memory_order_relaxed);
+    static CV64_RDRAMSnapshot scratch;
+    CV64_RDRAMSnapshot* snap = &scratch;
+    memset(snap, 0, sizeof(*snap));
+
+    u8* base = reinterpret_cast<u8*>(snap);
+    for (u32 i = 0; i < CV64_SNAP_FIELD_COUNT; i++) {
+        if (!((mask >> i) & 1u)) continue;
+        const SnapFieldDesc& f = s_snapFields[i];
+        const u32 offset = N64_ADDR_TO_OFFSET(f.addr);
+        switch (f.size) {
+            case 1:  base[f.offset] = rdram[offset ^ 3]; break;
+            case 2:  memcpy(base + f.offset, rdram + (offset ^ 2), 2); break;
+            default: memcpy(base + f.offset, rdram + offset, f.size); break;
+        }
+    }
+
+    snap->validMask = mask;
+    snap->frame = ++s_snapshot_frame;
+    snap->cameraMgr = s_snapshot_camera_mgr.load(std::memory_order_relaxed);
+    s_snapshot.Store(*snap);
+}
+
+const CV64_RDRAMSnapshot* CV64_Memory_GetSnapshot(void) {
+    return SnapGet();
+}
+
+bool CV64_Memory_CopySnapshot(CV64_RDRAMSnapshot* out) {
+    if (!out) return false;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return false;
+    *out = *snap;
+    return true;
+}
+
+/*===========================================================================
+ * RDRAM Dirty Page Tracking
+ *===========================================================================*/
+
+#define DIRTY_MAX_PAGES     (N64_RDRAM_SIZE >> CV64_RDRAM_PAGE_SHIFT)
+#define DIRTY_BITMAP_WORDS  (DIRTY_MAX_PAGES / 64)
+
+/**
+ * @brief One VI's diff result (published through a seqlock like the snapshot)
+ * An all-zero frame means no diff is available.
+ */
+struct DirtyFrame {
+    u64 bits[DIRTY_BITMAP_WORDS];
+    CV64_DirtyStats stats;
+};
+
+static CV64_Seqlock<DirtyFrame> s_dirty_frame;
+static std::atomic<u32> s_dirty_first_gen{1};      /* Older generations predate the current RDRAM */
+static std::atomic<bool> s_dirty_enabled{false};
+static std::atomic<u32> s_dirty_mapping_gen{0};
+
+/* Emulation thread only */
+static std::vector<u8> s_dirty_shadow;
+static u32 s_dirty_shadow_gen = 0;
+
+typedef bool (*PageEqualFn)(const u8* a, const u8* b);
+
+/* Each kernel ORs together the XOR of the whole page and tests once at the
+ * end: clean pages are the common case and must be read in full anyway. */
+#if !defined(CV64_CPU_X64) && !defined(CV64_CPU_ARM64)
+static bool PageEqual_Scalar(const u8* a, const u8* b) {
+    return memcmp(a, b, CV64_RDRAM_PAGE_SIZE) == 0;
+}
+#endif
+
+#ifdef CV64_CPU_X64
+static bool PageEqual_SSE2(const u8* a, const u8* b) {
+    __m128i acc = _mm_setzero_si128();
+    for (u32 i = 0; i < CV64_RDRAM_PAGE_SIZE; i += 64) {
+        __m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i)),
+                                   _mm_loadu_si128((const __m128i*)(b + i)));
+        __m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 16)),
+                                   _mm_loadu_si128((const __m128i*)(b + i + 16)));
+        __m128i x2 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 32)),
+                                   _mm_loadu_si128((const __m128i*)(b + i + 32)));
+        __m128i x3 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 48)),
+                                   _mm_loadu_si128((const __m128i*)(b + i + 48)));
+        acc = _mm_or_si128(acc, _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3)));
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) == 0xFFFF;
+}
+
+CV64_CPU_TARGET("avx2")
+static bool PageEqual_AVX2(const u8* a, const u8* b) {
+    __m256i acc = _mm256_setzero_si256();
+    for (u32 i = 0; i < CV64_RDRAM_PAGE_SIZE; i += 128) {
+        __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                      _mm256_loadu_si256((const __m256i*)(b + i)));
+        __m256i x1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i + 32)),
+                                      _mm256_loadu_si256((const __m256i*)(b + i + 32)));
+        __m256i x2 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i + 64)),
+                                      _mm256_loadu_si256((const __m256i*)(b + i + 64)));
+        __m256i x3 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i + 96)),
+                                      _mm256_loadu_si256((const __m256i*)(b + i + 96)));
+        acc = _mm256_or_si256(acc, _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3)));
+    }
+    return _mm256_testz_si256(acc, acc) != 0;
+}
+#endif
+
+#ifdef CV64_CPU_ARM64
+static bool PageEqual_NEON(const u8* a, const u8* b) {
+    uint8x16_t acc = vdupq_n_u8(0);
+    for (u32 i = 0; i < CV64_RDRAM_PAGE_SIZE; i += 64) {
+        uint8x16_t x0 = veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        uint8x16_t x1 = veorq_u8(vld1q_u8(a + i + 16), vld1q_u8(b + i + 16));
+        uint8x16_t x2 = veorq_u8(vld1q_u8(a + i + 32), vld1q_u8(b + i + 32));
+        uint8x16_t x3 = veorq_u8(vld1q_u8(a + i + 48), vld1q_u8(b + i + 48));
+        acc = vorrq_u8(acc, vorrq_u8(vorrq_u8(x0, x1), vorrq_u8(x2, x3)));
+    }
+    return vmaxvq_u8(acc) == 0;
+}
+#endif
+
+static PageEqualFn SelectPageEqual(void) {
+#if defined(CV64_CPU_X64)
+    if (CV64_Cpu_HasAVX2()) return PageEqual_AVX2;
+    return PageEqual_SSE2;
+#elif defined(CV64_CPU_ARM64)
+    return PageEqual_NEON;
+#else
+    return PageEqual_Scalar;
+#endif
+}
+
+/**
+ * @brief Force a full resync on the next diff (RDRAM was remapped)
+ */
+static void DirtySetRDRAM(void) {
+    s_dirty_mapping_gen.fetch_add(1, std::memory_order_acq_rel);
+    s_dirty_first_gen.store(s_dirty_frame.Generation() + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Latest published diff, or NULL if there is none
+ * Returns the calling thread's copy, refreshed when a newer diff was published.
+ */
+static const DirtyFrame* DirtyGet(void) {
+    static thread_local DirtyFrame t_frame;
+    static thread_local u32 t_gen = 0;
+    if (s_dirty_frame.Generation() != t_gen) {
+        t_gen = s_dirty_frame.Load(t_frame);
+    }
+    if (t_gen < s_dirty_first_gen.load(std::memory_order_acquire)) return nullptr;
+    if (t_frame.stats.pageCount == 0) return nullptr;
+    return &t_frame;
+}
+
+/**
+ * @brief Diff RDRAM against the shadow copy and publish the dirty bitmap
+ * One pass per VI, on the emulation thread, right after GatherSnapshot.
+ */
+static void UpdateDirtyPages(u8* rdram) {
+    if (!s_dirty_enabled.load(std::memory_order_acquire)) {
+        if (!s_dirty_shadow.empty()) {
+            static const DirtyFrame empty = {};
+            s_dirty_frame.Store(empty);
+            std::vector<u8>().swap(s_dirty_shadow);
+        }
+        return;
+    }
+
+    static const PageEqualFn pageEqual = SelectPageEqual();
+    auto start = std::chrono::steady_clock::now();
+
+    u32 size = s_rdram_size.load(std::memory_order_acquire);
+    if (size > N64_RDRAM_SIZE) size = N64_RDRAM_SIZE;
+    const u32 pageCount = size >> CV64_RDRAM_PAGE_SHIFT;
+    const u32 bytes = pageCount << CV64_RDRAM_PAGE_SHIFT;
+
+    static DirtyFrame scratch;
+    DirtyFrame* out = &scratch;
+    memset(out->bits, 0, sizeof(out->bits));
+
+    u32 dirtyPages = 0;
+    const u32 gen = s_dirty_mapping_gen.load(std::memory_order_acquire);
+    if (s_dirty_shadow.size() != bytes || gen != s_dirty_shadow_gen) {
+        /* New mapping or first enable: everything counts as changed */
+        s_dirty_shadow.assign(rdram, rdram + bytes);
+        s_dirty_shadow_gen = gen;
+        for (u32 page = 0; page < pageCount; page++) {
+            out->bits[page >> 6] |= 1ull << (page & 63);
+        }
+        dirtyPages = pageCount;
+    } else {
+        u8* shadow = s_dirty_shadow.data();
+        for (u32 page = 0; page < pageCount; page++) {
+            const u32 offset = page << CV64_RDRAM_PAGE_SHIFT;
+            if (pageEqual(rdram + offset, shadow + offset)) continue;
+            memcpy(shadow + offset, rdram + offset, CV64_RDRAM_PAGE_SIZE);
+            out->bits[page >> 6] |= 1ull << (page & 63);
+            dirtyPages++;
+        }
+    }
+
+    /* A range starts at every set bit whose predecessor is clear */
+    u32 ranges = 0;
+    for (u32 w = 0; w < DIRTY_BITMAP_WORDS; w++) {
+        u64 carry = w ? (out->bits[w - 1] >> 63) : 0;
+        ranges += (u32)std::popcount(out->bits[w] & ~((out->bits[w] << 1) | carry));
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    out->stats.frame = s_snapshot_frame;
+    out->stats.pageCount = pageCount;
+    out->stats.dirtyPages = dirtyPages;
+    out->stats.dirtyRanges = ranges;
+    out->stats.lastDiffMicros = std::chrono::duration<f64, std::micro>(end - start).count();
+    s_dirty_frame.Store(*out);
+}
+
+void CV64_Memory_SetDirtyTracking(bool enabled) {
+    s_dirty_enabled.store(enabled, std::memory_order_release);
+    LogInfo("RDRAM dirty page tracking %s", enabled ? "ENABLED" : "DISABLED");
+}
+
+bool CV64_Memory_IsDirtyTrackingEnabled(void) {
+    return s_dirty_enabled.load(std::memory_order_acquire);
+}
+
+u32 CV64_Memory_ForEachDirtyRange(CV64_DirtyRangeCallback callback, void* userData) {
+    const DirtyFrame* latest = DirtyGet();
+    if (!latest || !callback) return 0;
+
+    /* The callback may query the tracker again, which refreshes the per-thread copy */
+    const DirtyFrame copy = *latest;
+    const DirtyFrame* frame = &copy;
+
+    u32 visited = 0;
+    u32 page = 0;
+    const u32 pageCount = frame->stats.pageCount;
+    while (page < pageCount) {
+        /* Skip to the next set bit, then to the next clear bit */
+        u64 word = frame->bits[page >> 6] >> (page & 63);
+        if (word == 0) {
+            page = (page | 63) + 1;
+            continue;
+        }
+        page += (u32)std::countr_zero(word);
+        u32 first = page;
+        while (page < pageCount) {
+            u64 run = ~frame->bits[page >> 6] >> (page & 63);
+            if (run == 0) {
+                page = (page | 63) + 1;
+                continue;
             }
+            page += (u32)std::countr_zero(run);
+            break;
         }
+        if (page > pageCount) page = pageCount;
+        callback(first << CV64_RDRAM_PAGE_SHIFT, (page - first) << CV64_RDRAM_PAGE_SHIFT, userData);
+        visited++;
+    }
+    return visited;
+}
+
+bool CV64_Memory_IsRangeDirty(u32 addr, u32 size) {
+    const DirtyFrame* frame = DirtyGet();
+    if (!frame) return true;
+    if (size == 0) return false;
+
+    const u32 offset = N64_ADDR_TO_OFFSET(addr);
+    const u32 firstPage = offset >> CV64_RDRAM_PAGE_SHIFT;
+    const u32 lastPage = (u32)(((u64)offset + size - 1) >> CV64_RDRAM_PAGE_SHIFT);
+    if (lastPage >= frame->stats.pageCount) return true;
+
+    for (u32 page = firstPage; page <= lastPage; page++) {
+        if ((frame->bits[page >> 6] >> (page & 63)) & 1u) return true;
+    }
+    return false;
+}
+
+void CV64_Memory_GetDirtyStats(CV64_DirtyStats* stats) {
+    if (!stats) return;
+    const DirtyFrame* frame = DirtyGet();
+    if (frame) {
+        *stats = frame->stats;
+    } else {
+        memset(stats, 0, sizeof(*stats));
     }
 }
 
+/*===========================================================================
+ * Address Watchpoints
+ *===========================================================================*/
+
 /**
- * @brief Public API to apply all cheats
- * This is automatically called each frame from CV64_Memory_FrameUpdate
+ * @brief Per-watch data that is only needed once a value changed
  */
-void CV64_Memory_ApplyAllCheats(void) {
-    if (!s_initialized.load(std::memory_order_acquire)) return;
-    
-    ApplyPerformanceCheats();
-    ApplyGameplayCheats();
+struct WatchEntry {
+    s32 id;
+    u32 addr;
+    CV64_WatchPredicate predicate;
+    CV64_WatchCallback callback;
+    void* userData;
+};
+
+/**
+ * @brief A change detected this VI, dispatched after the table is unlocked
+ */
+struct WatchEvent {
+    WatchEntry entry;
+    u32 oldValue;
+    u32 newValue;
+};
+
+/* Structure of arrays: the per-VI gather and compare only touch the
+ * offset/size/value columns. Value arrays are padded to a multiple of 4
+ * with equal zeros so the compare needs no tail loop. */
+static std::mutex s_watch_mutex;
+static std::vector<WatchEntry> s_watch_entries;
+static std::vector<u32> s_watch_offset;     /* Lane-swizzled RDRAM offset */
+static std::vector<u8> s_watch_size;
+static std::vector<u8> s_watch_primed;
+static std::vector<u32> s_watch_prev;
+static std::vector<u32> s_watch_cur;
+static s32 s_watch_next_id = 1;
+
+static void WatchResizeValues(size_t count) {
+    size_t padded = (count + 3) & ~(size_t)3;
+    s_watch_prev.resize(padded, 0);
+    s_watch_cur.resize(padded, 0);
+}
+
+/**
+ * @brief Call visit(i) for every lane where a and b differ, in order
+ * count must be a multiple of 4.
+ */
+template <typename Visit>
+static inline void WatchCompare(const u32* a, const u32* b, size_t count, Visit visit) {
+    for (size_t i = 0; i < count; i += 4) {
+#if defined(CV64_CPU_X64)
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)),
+                                     _mm_loadu_si128((const __m128i*)(b + i)));
+        u32 diff = (u32)_mm_movemask_ps(_mm_castsi128_ps(eq)) ^ 0xFu;
+#elif defined(CV64_CPU_ARM64)
+        uint32x4_t eq = vceqq_u32(vld1q_u32(a + i), vld1q_u32(b + i));
+        if (vminvq_u32(eq) == 0xFFFFFFFFu) continue;
+        u32 diff = 0;
+        for (u32 lane = 0; lane < 4; lane++) {
+            if (a[i + lane] != b[i + lane]) diff |= 1u << lane;
+        }
+#else
+        u32 diff = 0;
+        for (u32 lane = 0; lane < 4; lane++) {
+            if (a[i + lane] != b[i + lane]) diff |= 1u << lane;
+        }
+#endif
+        while (diff) {
+            visit(i + (size_t)std::countr_zero(diff));
+            diff &= diff - 1;
+        }
+    }
+}
+
+/**
+ * @brief Gather every watched value, diff against last VI, fire callbacks
+ * One pass per VI, on the emulation thread, right after GatherSnapshot.
+ */
+static void EvaluateWatches(u8* rdram) {
+    std::vector<WatchEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(s_watch_mutex);
+        const size_t count = s_watch_entries.size();
+        if (count == 0) return;
+
+        const u32 rdramSize = s_rdram_size.load(std::memory_order_acquire);
+        u32* cur = s_watch_cur.data();
+        u32* prev = s_watch_prev.data();
+        for (size_t i = 0; i < count; i++) {
+            const u32 offset = s_watch_offset[i];
+            const u32 size = s_watch_size[i];
+            /* Swizzling never moves a value across its aligned word */
+            if ((offset & ~3u) + 4 > rdramSize) {
+                cur[i] = prev[i];
+                continue;
+            }
+            switch (size) {
+                case 1:  cur[i] = rdram[offset]; break;
+                case 2:  { u16 v; memcpy(&v, rdram + offset, 2); cur[i] = v; break; }
+                default: memcpy(&cur[i], rdram + offset, 4); break;
+            }
+        }
+
+        WatchCompare(prev, cur, s_watch_prev.size(), [&](size_t i) {
+            if (s_watch_primed[i]) {
+                events.push_back({ s_watch_entries[i], prev[i], cur[i] });
+            }
+        });
+
+        /* Newly added watches take their first value without firing */
+        for (size_t i = 0; i < count; i++) {
+            s_watch_primed[i] = 1;
+        }
+        s_watch_prev.swap(s_watch_cur);
+    }
+
+    for (const WatchEvent& ev : events) {
+        const WatchEntry& e = ev.entry;
+        if (e.predicate && !e.predicate(ev.oldValue, ev.newValue, e.userData)) continue;
+        e.callback(e.id, e.addr, ev.oldValue, ev.newValue, e.userData);
+    }
+}
+
+s32 CV64_Memory_Watch(u32 addr, u32 size, CV64_WatchPredicate predicate,
+                      CV64_WatchCallback callback, void* userData) {
+    if (!callback || (size != 1 && size != 2 && size != 4) || (addr & (size - 1)) != 0) {
+        LogWarning("CV64_Memory_Watch: invalid watch (addr=0x%08X, size=%u)", addr, size);
+        return CV64_WATCH_INVALID;
+    }
+    const u32 offset = N64_ADDR_TO_OFFSET(addr);
+    if (offset + size > N64_RDRAM_SIZE) {
+        LogWarning("CV64_Memory_Watch: address 0x%08X outside RDRAM", addr);
+        return CV64_WATCH_INVALID;
+    }
+
+    std::lock_guard<std::mutex> lock(s_watch_mutex);
+    WatchEntry entry = { s_watch_next_id++, addr, predicate, callback, userData };
+    s_watch_entries.push_back(entry);
+    s_watch_offset.push_back(size == 1 ? (offset ^ 3) : size == 2 ? (offset ^ 2) : offset);
+    s_watch_size.push_back((u8)size);
+    s_watch_primed.push_back(0);
+    WatchResizeValues(s_watch_entries.size());
+    return entry.id;
+}
+
+bool CV64_Memory_Unwatch(s32 watchId) {
+    std::lock_guard<std::mutex> lock(s_watch_mutex);
+    const size_t count = s_watch_entries.size();
+    for (size_t i = 0; i < count; i++) {
+        if (s_watch_entries[i].id != watchId) continue;
+        /* Swap-remove across every column */
+        const size_t last = count - 1;
+        s_watch_entries[i] = s_watch_entries[last];
+        s_watch_offset[i] = s_watch_offset[last];
+        s_watch_size[i] = s_watch_size[last];
+        s_watch_primed[i] = s_watch_primed[last];
+        s_watch_prev[i] = s_watch_prev[last];
+        s_watch_entries.pop_back();
+        s_watch_offset.pop_back();
+        s_watch_size.pop_back();
+        s_watch_primed.pop_back();
+        s_watch_prev[last] = 0;
+        s_watch_cur[last] = 0;
+        WatchResizeValues(last);
+        return true;
+    }
+    return false;
+}
+
+u32 CV64_Memory_GetWatchCount(void) {
+    std::lock_guard<std::mutex> lock(s_watch_mutex);
+    return (u32)s_watch_entries.size();
 }
 
 /*===========================================================================
  * Frame Update Hook
  *===========================================================================*/
 
+/* Map change tracking (emulation thread only, -1 = none seen yet) */
+static s16 s_last_map = -1;         /* Last in-range map, title/select screens included */
+static s16 s_last_stage_map = -1;   /* Last playable stage */
+
+static inline bool MapIsInRange(s16 mapId) {
+    return mapId >= 0 && mapId < 0x20;
+}
+
+static inline bool MapIsStage(s16 mapId) {
+    return mapId > 1 && mapId < 0x20;
+}
+
+/**
+ * @brief Map change watch filter: any change to an in-range map
+ * Maps 0/1 and out-of-range IDs are the title/select screens; 0/1 are
+ * still passed through so the callback can track them.
+ */
+static bool MapChangePredicate(u32 oldValue, u32 newValue, void* userData) {
+    (void)oldValue;
+    (void)userData;
+    return MapIsInRange((s16)newValue);
+}
+
+/**
+ * @brief Map change watch callback (emulation thread)
+ *
+ * Fires on every entry into a stage. The previous map is the last stage
+ * played, so stage X -> title -> stage Y reports X -> Y; before any stage
+ * was seen it is the last in-range map.
+ */
+static void OnMapChanged(s32 watchId, u32 addr, u32 oldValue, u32 newValue, void* userData) {
+    (void)watchId;
+    (void)addr;
+    (void)userData;
+    s16 currentMap = (s16)newValue;
+
+    /* The watch takes its first value silently; seed from it */
+    if (s_last_map == -1 && MapIsInRange((s16)oldValue)) {
+        s_last_map = (s16)oldValue;
+        if (MapIsStage(s_last_map)) s_last_stage_map = s_last_map;
+    }
+
+    s16 prevMap = (s_last_stage_map != -1) ? s_last_stage_map : s_last_map;
+    s_last_map = currentMap;
+    if (!MapIsStage(currentMap)) return;
+    s_last_stage_map = currentMap;
+    if (prevMap == -1) return;
+
+    if (s_map_change_callback) {
+        s_map_change_callback(prevMap, currentMap);
+    }
+    /* Reset camera yaw offset on map change */
+    s_camera_yaw_offset.store(0, std::memory_order_relaxed);
+    /* Reset zoom to default on map change */
+    s_camera_zoom_mult_x1000.store(1000, std::memory_order_relaxed);
+    /* Reset adaptive divisor so it re-profiles for the new map */
+    s_adaptive_divisor = 2.0f;
+    s_adaptive_logged = false;
+    s_cheat_lag_logged = false;
+    LogInfo("Map changed: %d (%s) -> %d (%s)",
+            prevMap, CV64_Memory_GetMapName(prevMap),
+            currentMap, CV64_Memory_GetMapName(currentMap));
+}
+
 /**
  * @brief Called each frame to update our patches with game state
  * PERFORMANCE: Only update cache every few frames to reduce memory read overhead
@@ -1318,7 +1904,7 @@ void CV64_Memory_ApplyAllCheats(void) {
  * NOTE: No memory patching or adjustments are performed while on the Title Screen
  *       or Character Select screen, as doing so causes save/load issues.
  */
-void CV64_Memory_FrameUpdate(void) {
+static void FrameUpdateHooks(void) {
     static int frameCount = 0;
     static bool loggedFirstSuccess = false;
     static bool loggedHookRunning = false;
@@ -1341,6 +1927,11 @@ void CV64_Memory_FrameUpdate(void) {
         loggedHookRunning = true;
     }
 
+    /* Map changes arrive as watch events instead of being polled */
+    static const s32 mapChangeWatch = CV64_Memory_Watch(CV64_ADDR_MAP_ID, 2, MapChangePredicate,
+                                                        OnMapChanged, nullptr);
+    (void)mapChangeWatch;
+
     frameCount++;
 
     u8* rdram = SafeGetRDRAM();
@@ -1352,6 +1943,13 @@ void CV64_Memory_FrameUpdate(void) {
         return;
     }
 
+    /* Gather every watched field once; everything below reads the snapshot */
+    GatherSnapshot(rdram);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    UpdateDirtyPages(rdram);
+    EvaluateWatches(rdram);
+    CV64_Actors_Update(rdram, s_rdram_size.load(std::memory_order_acquire));
+
     /* Read current map ID for state tracking */
     s16 currentMap = ReadCurrentMapId();
 
@@ -1363,8 +1961,8 @@ void CV64_Memory_FrameUpdate(void) {
      * the first frames of a map load or a cutscene). Only skip patches when
      * the gameplay loop flag is 0 AND the map ID is out of the valid range. */
     bool onTitleScreen = false;
-    if (IsAddressValid(CV64_ADDR_IN_GAMEPLAY_LOOP, 4)) {
-        u32 inLoop = CV64_ReadU32(rdram, CV64_ADDR_IN_GAMEPLAY_LOOP);
+    if (SnapHas(snap, CV64_SNAP_IN_GAMEPLAY_LOOP)) {
+        u32 inLoop = snap->inGameplayLoop;
         if (inLoop == 0 && !(currentMap >= 0 && currentMap < 0x20)) {
             onTitleScreen = true;
         }
@@ -1384,17 +1982,14 @@ void CV64_Memory_FrameUpdate(void) {
     }
     loggedTitleScreenSkip = false;  /* Reset so we log again if we return to title */
 
-    /* Apply Gameshark cheats every frame (before other processing) */
-    ApplyGamesharkCheats();
-
-    /* Apply gameplay cheats every frame (health/subweapon must be continuous) */
-    ApplyGameplayCheats();
-
     /* Apply performance cheats EVERY frame — the game re-sets fog values each
      * frame, so our extended draw distance override must be written continuously
      * or the game's defaults immediately overwrite ours (3 out of 4 frames). */
     ApplyPerformanceCheats();
 
+    /* Apply GameShark code lists every frame (health/subweapon must be continuous) */
+    ApplyGamesharkCheats();
+
     /* Apply accumulated camera yaw offset every frame when camera mode is 0.
      * The game recalculates player_angle_yaw each frame from the player's
      * facing direction, so we must re-apply our offset continuously. */
@@ -1461,8 +2056,8 @@ void CV64_Memory_FrameUpdate(void) {
         }
 
         /* Read game_time (sym: game_time at 0x800A7900) */
-        if (IsAddressValid(CV64_ADDR_GAME_TIME, 4)) {
-            u32 gt = CV64_ReadU32(rdram, CV64_ADDR_GAME_TIME);
+        if (SnapHas(snap, CV64_SNAP_GAME_TIME)) {
+            u32 gt = snap->gameTime;
             s_game_time.store(gt, std::memory_order_release);
             /* Day/Night: day when cycle position in [0x4000, 0xC000) */
             u16 cyclePos = (u16)(gt & 0xFFFF);
@@ -1470,35 +2065,15 @@ void CV64_Memory_FrameUpdate(void) {
         }
 
         /* Check soft reset (sym: isSoftReset at 0x800947F8) */
-        if (IsAddressValid(CV64_ADDR_IS_SOFT_RESET, 2)) {
-            u16 sr = CV64_ReadU16(rdram, CV64_ADDR_IS_SOFT_RESET);
+        if (SnapHas(snap, CV64_SNAP_IS_SOFT_RESET)) {
+            u16 sr = snap->isSoftReset;
             s_is_soft_reset.store(sr != 0, std::memory_order_release);
         }
 
         /* Compute detailed game state using multi-signal detection */
-        CV64_GameState newState = ComputeGameState(rdram, currentMap);
+        CV64_GameState newState = ComputeGameState(snap, currentMap);
         s_game_state.store(newState, std::memory_order_release);
 
-        /* Map change detection & callback */
-        s16 prevMap = s_last_map_id.load(std::memory_order_acquire);
-        if (currentMap != prevMap && prevMap != -1 && currentMap > 1) {
-            if (s_map_change_callback) {
-                s_map_change_callback(prevMap, currentMap);
-            }
-            /* Reset camera yaw offset on map change */
-            s_camera_yaw_offset.store(0, std::memory_order_relaxed);
-            /* Reset zoom to default on map change */
-            s_camera_zoom_mult_x1000.store(1000, std::memory_order_relaxed);
-            /* Reset adaptive divisor so it re-profiles for the new map */
-            s_adaptive_divisor = 2.0f;
-            s_adaptive_logged = false;
-            s_cheat_lag_logged = false;
-            LogInfo("Map changed: %d (%s) -> %d (%s)",
-                    prevMap, CV64_Memory_GetMapName(prevMap),
-                    currentMap, CV64_Memory_GetMapName(currentMap));
-        }
-        s_last_map_id.store(currentMap, std::memory_order_release);
-
         /* Update gameplay state — use detailed state for more accuracy */
         bool inGameplay = (newState == CV64_STATE_GAMEPLAY);
         s_is_in_gameplay.store(inGameplay, std::memory_order_release);
@@ -1506,8 +2081,7 @@ void CV64_Memory_FrameUpdate(void) {
     
     /* Debug: Log game state periodically - heartbeat to confirm hook is active */
     if (frameCount == 60 || frameCount == 300 || frameCount == 600 || (frameCount % 1800 == 0)) {
-        u32 mapAddr = s_system_work_addr + CV64_SYS_OFFSET_MAP_ID;
-        s16 mapId = IsAddressValid(mapAddr, 2) ? (s16)CV64_ReadU16(rdram, mapAddr) : -1;
+        s16 mapId = SnapHas(snap, CV64_SNAP_MAP_ID) ? snap->mapId : -1;
         u32 cameraMgr = s_camera_mgr_addr.load(std::memory_order_acquire);
         u32 player = s_player_addr.load(std::memory_order_acquire);
         u32 mode = s_current_camera_mode.load(std::memory_order_acquire);
@@ -1544,12 +2118,10 @@ void CV64_Memory_FrameUpdate(void) {
         CV64_GameState state = s_game_state.load(std::memory_order_acquire);
         bool locked = (state != CV64_STATE_GAMEPLAY);
         /* Also lock if player is using first-person or R-lock (native camera modes) */
-        if (!locked && rdram) {
-            if (IsAddressValid(CV64_ADDR_IN_FIRST_PERSON, 4) &&
-                CV64_ReadU32(rdram, CV64_ADDR_IN_FIRST_PERSON) != 0)
+        if (!locked) {
+            if (SnapHas(snap, CV64_SNAP_IN_FIRST_PERSON) && snap->inFirstPerson != 0)
                 locked = true;
-            if (IsAddressValid(CV64_ADDR_R_LOCK_VIEW, 4) &&
-                CV64_ReadU32(rdram, CV64_ADDR_R_LOCK_VIEW) != 0)
+            if (SnapHas(snap, CV64_SNAP_R_LOCK_VIEW) && snap->rLockView != 0)
                 locked = true;
         }
         CV64_CameraPatch_SetLocked(locked);
@@ -1608,6 +2180,15 @@ void CV64_Memory_FrameUpdate(void) {
      * which calls CV64_CameraPatch_ProcessDPad directly */
 }
 
+void CV64_Memory_FrameUpdate(void) {
+    FrameUpdateHooks();
+
+    /* Publish this frame's game info for the UI, HUD and savestate threads */
+    if (s_initialized.load(std::memory_order_acquire)) {
+        PublishGameInfo();
+    }
+}
+
 /*===========================================================================
  * Debug Functions
  *===========================================================================*/
@@ -1751,8 +2332,8 @@ static const char* const s_difficultyNames[] = {
  * Uses the LIVE map_ID (not the save copy) to avoid stale values during transitions
  */
 static s16 ReadCurrentMapId(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return -1;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return -1;
 
     /* Use CV64_SYS_OFFSET_MAP_ID (live map ID at system_work + 0x26428)
      * instead of CV64_SYS_OFFSET_MAP_ID_COPY (save copy at +0x261D8)
@@ -1760,8 +2341,8 @@ static s16 ReadCurrentMapId(void) {
     u32 addr = s_system_work_addr + CV64_SYS_OFFSET_MAP_ID;
 
     /* Debug: Try reading from the configured offset first */
-    if (IsAddressValid(addr, 2)) {
-        s16 mapId = (s16)CV64_ReadU16(rdram, addr);
+    if (SnapHas(snap, CV64_SNAP_MAP_ID)) {
+        s16 mapId = snap->mapId;
 
         /* Debug: Log map ID reads periodically and on change */
         static int readCount = 0;
@@ -1826,12 +2407,8 @@ s16 CV64_Memory_GetCurrentMapId(void) {
  * Uses verified address: sym Player_health at 0x80389C3E
  */
 s16 CV64_Memory_GetPlayerHealth(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return -1;
-
-    if (!IsAddressValid(CV64_DIRECT_HEALTH_ADDR, 2)) return -1;
-
-    return (s16)CV64_ReadU16(rdram, CV64_DIRECT_HEALTH_ADDR);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_HEALTH) ? snap->health : -1;
 }
 
 /**
@@ -1840,12 +2417,8 @@ s16 CV64_Memory_GetPlayerHealth(void) {
  * Follows Player_health in SaveStruct_gameplay.
  */
 s16 CV64_Memory_GetPlayerMaxHealth(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return -1;
-
-    if (!IsAddressValid(CV64_ADDR_SAVE_MAX_HEALTH, 2)) return -1;
-
-    return (s16)CV64_ReadU16(rdram, CV64_ADDR_SAVE_MAX_HEALTH);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_MAX_HEALTH) ? snap->maxHealth : -1;
 }
 
 /**
@@ -1853,12 +2426,10 @@ s16 CV64_Memory_GetPlayerMaxHealth(void) {
  * Reads s16 from verified address 0x80389C3C (sym: getCurrentCharacter)
  */
 const char* CV64_Memory_GetCharacterName(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return " ";
-
-    if (!IsAddressValid(CV64_DIRECT_CHARACTER_ADDR, 2)) return " ";
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!SnapHas(snap, CV64_SNAP_CHARACTER)) return " ";
 
-    s16 charId = (s16)CV64_ReadU16(rdram, CV64_DIRECT_CHARACTER_ADDR);
+    s16 charId = snap->character;
     if (charId < 0 || charId > 1) return " ";
 
     return s_characterNames[charId];
@@ -1915,15 +2486,12 @@ const char* CV64_Memory_GetTimeOfDayString(void) {
  * @brief Compute detailed game state from multiple memory signals
  * Uses verified sym addresses for accurate multi-signal detection
  */
-static CV64_GameState ComputeGameState(u8* rdram, s16 mapId) {
-    if (!rdram) return CV64_STATE_NOT_RUNNING;
+static CV64_GameState ComputeGameState(const CV64_RDRAMSnapshot* snap, s16 mapId) {
+    if (!snap) return CV64_STATE_NOT_RUNNING;
 
     /* Check soft reset first */
-    if (IsAddressValid(CV64_ADDR_IS_SOFT_RESET, 2)) {
-        u16 softReset = CV64_ReadU16(rdram, CV64_ADDR_IS_SOFT_RESET);
-        if (softReset != 0)
-            return CV64_STATE_SOFT_RESET;
-    }
+    if (SnapHas(snap, CV64_SNAP_IS_SOFT_RESET) && snap->isSoftReset != 0)
+        return CV64_STATE_SOFT_RESET;
 
     /* Title screen / character select detection:
      * Map IDs 0+ are all real stages (0=Forest of Silence, 1=Castle Wall, etc.)
@@ -1931,53 +2499,35 @@ static CV64_GameState ComputeGameState(u8* rdram, s16 mapId) {
      * and map_ID being 0 with no gameplay active. */
 
     /* Check fade state (map transitions) */
-    if (IsAddressValid(CV64_ADDR_FADE_SETTINGS, 2)) {
-        u16 fadeSettings = CV64_ReadU16(rdram, CV64_ADDR_FADE_SETTINGS);
-        if (fadeSettings != 0) {
-            if (IsAddressValid(CV64_ADDR_FADE_CURRENT_TIME, 2) &&
-                IsAddressValid(CV64_ADDR_FADE_MAX_TIME, 2)) {
-                u16 fadeTime = CV64_ReadU16(rdram, CV64_ADDR_FADE_CURRENT_TIME);
-                u16 fadeMax  = CV64_ReadU16(rdram, CV64_ADDR_FADE_MAX_TIME);
-                if (fadeTime > 0 && fadeTime < fadeMax)
-                    return CV64_STATE_FADING;
-            }
+    if (SnapHas(snap, CV64_SNAP_FADE_SETTINGS) && snap->fadeSettings != 0) {
+        if (SnapHas(snap, CV64_SNAP_FADE_CURRENT_TIME) &&
+            SnapHas(snap, CV64_SNAP_FADE_MAX_TIME)) {
+            u16 fadeTime = snap->fadeCurrentTime;
+            u16 fadeMax  = snap->fadeMaxTime;
+            if (fadeTime > 0 && fadeTime < fadeMax)
+                return CV64_STATE_FADING;
         }
     }
 
     /* Check menu state */
-    if (IsAddressValid(CV64_ADDR_CURRENT_MENU, 2)) {
-        u16 menu = CV64_ReadU16(rdram, CV64_ADDR_CURRENT_MENU);
-        if (menu != 0)
-            return CV64_STATE_MENU;
-    }
+    if (SnapHas(snap, CV64_SNAP_CURRENT_MENU) && snap->currentMenu != 0)
+        return CV64_STATE_MENU;
 
     /* Check text reading */
-    if (IsAddressValid(CV64_ADDR_READING_TEXT, 2)) {
-        u16 reading = CV64_ReadU16(rdram, CV64_ADDR_READING_TEXT);
-        if (reading != 0)
-            return CV64_STATE_READING_TEXT;
-    }
+    if (SnapHas(snap, CV64_SNAP_READING_TEXT) && snap->readingText != 0)
+        return CV64_STATE_READING_TEXT;
 
     /* Check cutscene */
-    if (IsAddressValid(CV64_ADDR_CUTSCENE_ID, 2)) {
-        u16 cutscene = CV64_ReadU16(rdram, CV64_ADDR_CUTSCENE_ID);
-        if (cutscene != 0)
-            return CV64_STATE_CUTSCENE;
-    }
+    if (SnapHas(snap, CV64_SNAP_CUTSCENE_ID) && snap->cutsceneId != 0)
+        return CV64_STATE_CUTSCENE;
 
     /* Check first-person view */
-    if (IsAddressValid(CV64_ADDR_IN_FIRST_PERSON, 4)) {
-        s32 fp = (s32)CV64_ReadU32(rdram, CV64_ADDR_IN_FIRST_PERSON);
-        if (fp != 0)
-            return CV64_STATE_FIRST_PERSON;
-    }
+    if (SnapHas(snap, CV64_SNAP_IN_FIRST_PERSON) && snap->inFirstPerson != 0)
+        return CV64_STATE_FIRST_PERSON;
 
     /* Check gameplay loop flag */
-    if (IsAddressValid(CV64_ADDR_IN_GAMEPLAY_LOOP, 4)) {
-        u32 inLoop = CV64_ReadU32(rdram, CV64_ADDR_IN_GAMEPLAY_LOOP);
-        if (inLoop != 0)
-            return CV64_STATE_GAMEPLAY;
-    }
+    if (SnapHas(snap, CV64_SNAP_IN_GAMEPLAY_LOOP) && snap->inGameplayLoop != 0)
+        return CV64_STATE_GAMEPLAY;
 
     /* Not in gameplay loop and no other state detected.
      * Distinguish between title screen and being on a real map:
@@ -2005,14 +2555,12 @@ const char* CV64_Memory_GetSubweaponName(u16 type) {
 }
 
 bool CV64_Memory_IsMapTransition(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!SnapHas(snap, CV64_SNAP_FADE_CURRENT_TIME)) return false;
+    if (!SnapHas(snap, CV64_SNAP_FADE_MAX_TIME)) return false;
 
-    if (!IsAddressValid(CV64_ADDR_FADE_CURRENT_TIME, 2)) return false;
-    if (!IsAddressValid(CV64_ADDR_FADE_MAX_TIME, 2)) return false;
-
-    u16 fadeTime = CV64_ReadU16(rdram, CV64_ADDR_FADE_CURRENT_TIME);
-    u16 fadeMax  = CV64_ReadU16(rdram, CV64_ADDR_FADE_MAX_TIME);
+    u16 fadeTime = snap->fadeCurrentTime;
+    u16 fadeMax  = snap->fadeMaxTime;
 
     return (fadeTime > 0 && fadeTime < fadeMax);
 }
@@ -2058,12 +2606,8 @@ bool CV64_Memory_SetDifficulty(u8 difficulty) {
 }
 
 s32 CV64_Memory_GetDifficulty(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return -1;
-
-    if (!IsAddressValid(CV64_ADDR_SAVE_DIFFICULTY, 1)) return -1;
-
-    return (s32)CV64_ReadU8(rdram, CV64_ADDR_SAVE_DIFFICULTY);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_DIFFICULTY) ? (s32)snap->difficulty : -1;
 }
 
 const char* CV64_Memory_GetDifficultyName(u8 difficulty) {
@@ -2080,20 +2624,20 @@ bool CV64_Memory_GetProcessMeter(CV64_ProcessMeterInfo* out) {
     if (!out) return false;
     memset(out, 0, sizeof(CV64_ProcessMeterInfo));
 
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return false;
 
-    if (IsAddressValid(CV64_ADDR_PROCESS_GREEN_SIZE, 4))
-        out->greenBarSize = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_GREEN_SIZE);
+    if (SnapHas(snap, CV64_SNAP_PROCESS_GREEN))
+        out->greenBarSize = snap->processGreenSize;
 
-    if (IsAddressValid(CV64_ADDR_PROCESS_BLUE_SIZE, 4))
-        out->blueBarSize = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_BLUE_SIZE);
+    if (SnapHas(snap, CV64_SNAP_PROCESS_BLUE))
+        out->blueBarSize = snap->processBlueSize;
 
-    if (IsAddressValid(CV64_ADDR_PROCESS_BAR_DIVISOR, 4))
-        out->sizeDivisor = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_BAR_DIVISOR);
+    if (SnapHas(snap, CV64_SNAP_PROCESS_DIVISOR))
+        out->sizeDivisor = snap->processBarDivisor;
 
-    if (IsAddressValid(CV64_ADDR_PROCESS_DIVISIONS, 4))
-        out->numDivisions = CV64_ReadU32(rdram, CV64_ADDR_PROCESS_DIVISIONS);
+    if (SnapHas(snap, CV64_SNAP_PROCESS_DIVISIONS))
+        out->numDivisions = snap->processDivisions;
 
     return true;
 }
@@ -2106,12 +2650,12 @@ bool CV64_Memory_GetBossHealth(CV64_BossHealthInfo* out) {
     if (!out) return false;
     memset(out, 0, sizeof(CV64_BossHealthInfo));
 
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return false;
 
     /* Boss bar fill color: non-zero means boss bar is visible on HUD */
-    if (IsAddressValid(CV64_ADDR_BOSS_BAR_FILL_COLOR, 4)) {
-        out->bossBarFillColor = CV64_ReadU32(rdram, CV64_ADDR_BOSS_BAR_FILL_COLOR);
+    if (SnapHas(snap, CV64_SNAP_BOSS_BAR_COLOR)) {
+        out->bossBarFillColor = snap->bossBarFillColor;
         out->bossBarVisible = (out->bossBarFillColor != 0);
     }
 
@@ -2126,26 +2670,26 @@ bool CV64_Memory_GetFogInfo(CV64_FogInfo* out) {
     if (!out) return false;
     memset(out, 0, sizeof(CV64_FogInfo));
 
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return false;
 
-    if (IsAddressValid(CV64_ADDR_MAP_FOG_COLOR, 4))
-        out->fogColor = CV64_ReadU32(rdram, CV64_ADDR_MAP_FOG_COLOR);
+    if (SnapHas(snap, CV64_SNAP_FOG_COLOR))
+        out->fogColor = snap->fogColor;
 
-    if (IsAddressValid(CV64_ADDR_FOG_DIST_START, 2))
-        out->fogDistanceStart = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_START);
+    if (SnapHas(snap, CV64_SNAP_FOG_DIST_START))
+        out->fogDistanceStart = snap->fogDistStart;
 
-    if (IsAddressValid(CV64_ADDR_FOG_DIST_END, 2))
-        out->fogDistanceEnd = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_END);
+    if (SnapHas(snap, CV64_SNAP_FOG_DIST_END))
+        out->fogDistanceEnd = snap->fogDistEnd;
 
-    if (IsAddressValid(CV64_ADDR_MAP_AMBIENT_BRIGHT, 4))
-        out->ambientBrightness = CV64_ReadF32(rdram, CV64_ADDR_MAP_AMBIENT_BRIGHT);
+    if (SnapHas(snap, CV64_SNAP_AMBIENT_BRIGHT))
+        out->ambientBrightness = snap->ambientBrightness;
 
-    if (IsAddressValid(CV64_ADDR_MAP_DIFFUSE_COLOR, 4))
-        out->diffuseColor = CV64_ReadU32(rdram, CV64_ADDR_MAP_DIFFUSE_COLOR);
+    if (SnapHas(snap, CV64_SNAP_DIFFUSE_COLOR))
+        out->diffuseColor = snap->diffuseColor;
 
-    if (IsAddressValid(CV64_ADDR_DONT_UPDATE_LIGHTING, 4))
-        out->lightingUpdateDisabled = (CV64_ReadU32(rdram, CV64_ADDR_DONT_UPDATE_LIGHTING) != 0);
+    if (SnapHas(snap, CV64_SNAP_DONT_UPDATE_LIGHTING))
+        out->lightingUpdateDisabled = (snap->dontUpdateLighting != 0);
 
     return true;
 }
@@ -2155,12 +2699,8 @@ bool CV64_Memory_GetFogInfo(CV64_FogInfo* out) {
  *===========================================================================*/
 
 s16 CV64_Memory_GetContPakFileNo(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return -1;
-
-    if (!IsAddressValid(CV64_ADDR_CONTPAK_FILE_NO, 1)) return -1;
-
-    return (s16)CV64_ReadU8(rdram, CV64_ADDR_CONTPAK_FILE_NO);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_CONTPAK_FILE_NO) ? (s16)snap->contPakFileNo : -1;
 }
 
 /*===========================================================================
@@ -2169,22 +2709,12 @@ s16 CV64_Memory_GetContPakFileNo(void) {
  *===========================================================================*/
 
 bool CV64_Memory_IsEnemyTargetActive(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
-
-    if (!IsAddressValid(CV64_ADDR_PTR_ENEMY_TARGET_GFX, 4)) return false;
-
-    u32 ptr = CV64_ReadU32(rdram, CV64_ADDR_PTR_ENEMY_TARGET_GFX);
-    return (ptr != 0);
+    return CV64_Memory_GetEnemyTargetPtr() != 0;
 }
 
 u32 CV64_Memory_GetEnemyTargetPtr(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return 0;
-
-    if (!IsAddressValid(CV64_ADDR_PTR_ENEMY_TARGET_GFX, 4)) return 0;
-
-    return CV64_ReadU32(rdram, CV64_ADDR_PTR_ENEMY_TARGET_GFX);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_ENEMY_TARGET_PTR) ? snap->enemyTargetGfxPtr : 0;
 }
 
 /*===========================================================================
@@ -2193,79 +2723,72 @@ u32 CV64_Memory_GetEnemyTargetPtr(void) {
  *===========================================================================*/
 
 bool CV64_Memory_PlayerHasMaxHealth(void) {
-    u8* rdram = SafeGetRDRAM();
-    if (!rdram) return false;
-
-    if (!IsAddressValid(CV64_ADDR_HAS_MAX_HEALTH, 1)) return false;
-
-    return (CV64_ReadU8(rdram, CV64_ADDR_HAS_MAX_HEALTH) != 0);
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    return SnapHas(snap, CV64_SNAP_HAS_MAX_HEALTH) && snap->hasMaxHealth != 0;
 }
 
 /**
- * @brief Read all extended save data fields from RDRAM
- * Called from GetGameInfo and during frame update
+ * @brief Fill extended save data fields from the frame snapshot
+ * Called from GetGameInfo
  */
-static void ReadExtendedSaveData(u8* rdram, CV64_GameInfo* info) {
+static void ReadExtendedSaveData(const CV64_RDRAMSnapshot* snap, CV64_GameInfo* info) {
     /* Gold (u32 at 0x80389C44) — sym: Player_gold */
-    if (IsAddressValid(CV64_ADDR_SAVE_GOLD, 4))
-        info->gold = CV64_ReadU32(rdram, CV64_ADDR_SAVE_GOLD);
+    if (SnapHas(snap, CV64_SNAP_GOLD))
+        info->gold = snap->gold;
 
     /* Red jewels (u8 at 0x80389C49) — sym: Player_red_jewels */
-    if (IsAddressValid(CV64_ADDR_SAVE_JEWELS, 1))
-        info->jewels = CV64_ReadU8(rdram, CV64_ADDR_SAVE_JEWELS);
+    if (SnapHas(snap, CV64_SNAP_JEWELS))
+        info->jewels = snap->jewels;
 
     /* Subweapon type (u16 at 0x80389C42) */
-    if (IsAddressValid(CV64_ADDR_SAVE_SUBWEAPON, 2))
-        info->subweapon = CV64_ReadU16(rdram, CV64_ADDR_SAVE_SUBWEAPON);
+    if (SnapHas(snap, CV64_SNAP_SUBWEAPON))
+        info->subweapon = snap->subweapon;
 
     /* Subweapon ammo (u16 at 0x80389C48) */
-    if (IsAddressValid(CV64_ADDR_SAVE_SUBWEAPON_AMMO, 2))
-        info->subweaponAmmo = CV64_ReadU16(rdram, CV64_ADDR_SAVE_SUBWEAPON_AMMO);
+    if (SnapHas(snap, CV64_SNAP_SUBWEAPON_AMMO))
+        info->subweaponAmmo = snap->subweaponAmmo;
 
     /* Powerup level (u8 at 0x80389CEC) — sym: current_PowerUp_level */
-    if (IsAddressValid(CV64_ADDR_SAVE_POWERUP, 1))
-        info->powerupLevel = CV64_ReadU8(rdram, CV64_ADDR_SAVE_POWERUP);
+    if (SnapHas(snap, CV64_SNAP_POWERUP))
+        info->powerupLevel = snap->powerupLevel;
 
     /* Alternate costume (u8 at 0x80389CEE) — sym: alternate_costume */
-    if (IsAddressValid(CV64_ADDR_SAVE_COSTUME, 1))
-        info->alternateCostume = CV64_ReadU8(rdram, CV64_ADDR_SAVE_COSTUME);
+    if (SnapHas(snap, CV64_SNAP_COSTUME))
+        info->alternateCostume = snap->alternateCostume;
 
     /* Difficulty (u8 at 0x80389CC8) — sym: save_difficulty */
-    if (IsAddressValid(CV64_ADDR_SAVE_DIFFICULTY, 1))
-        info->difficulty = CV64_ReadU8(rdram, CV64_ADDR_SAVE_DIFFICULTY);
+    if (SnapHas(snap, CV64_SNAP_DIFFICULTY))
+        info->difficulty = snap->difficulty;
 
     /* Save file number (u8 at 0x80389CDB) — sym: save_file_number */
-    if (IsAddressValid(CV64_ADDR_SAVE_FILE_NUMBER, 1))
-        info->saveFileNumber = CV64_ReadU8(rdram, CV64_ADDR_SAVE_FILE_NUMBER);
+    if (SnapHas(snap, CV64_SNAP_SAVE_FILE_NUMBER))
+        info->saveFileNumber = snap->saveFileNumber;
 
     /* Map entrance ID (u16 at 0x80389C92) — sym: map_entrance_ID_copy */
-    if (IsAddressValid(CV64_ADDR_SAVE_MAP_ENTRANCE, 2))
-        info->mapEntrance = (s16)CV64_ReadU16(rdram, CV64_ADDR_SAVE_MAP_ENTRANCE);
+    if (SnapHas(snap, CV64_SNAP_MAP_ENTRANCE))
+        info->mapEntrance = snap->mapEntrance;
 
     /* Player position from current_player_position (Vec3f at 0x8009E1B0) */
-    u32 phys = CV64_VirtToPhys(CV64_ADDR_CURRENT_PLAYER_POS);
-
-    if (IsAddressValid(phys, 12)) {
-        info->playerX = CV64_ReadF32(rdram, phys);
-        info->playerY = CV64_ReadF32(rdram, phys + 4);
-        info->playerZ = CV64_ReadF32(rdram, phys + 8);
+    if (SnapHas(snap, CV64_SNAP_PLAYER_POS)) {
+        info->playerX = snap->playerPos[0];
+        info->playerY = snap->playerPos[1];
+        info->playerZ = snap->playerPos[2];
     }
 
-
     /* Cutscene ID */
-    if (IsAddressValid(CV64_ADDR_CUTSCENE_ID, 2))
-        info->cutsceneId = CV64_ReadU16(rdram, CV64_ADDR_CUTSCENE_ID);
+    if (SnapHas(snap, CV64_SNAP_CUTSCENE_ID))
+        info->cutsceneId = snap->cutsceneId;
 
     /* Camera mode */
     info->cameraMode = s_current_camera_mode.load(std::memory_order_acquire);
 
     /* First person flag */
-    if (IsAddressValid(CV64_ADDR_IN_FIRST_PERSON, 4))
-        info->isFirstPerson = (CV64_ReadU32(rdram, CV64_ADDR_IN_FIRST_PERSON) != 0);
+    if (SnapHas(snap, CV64_SNAP_IN_FIRST_PERSON))
+        info->isFirstPerson = (snap->inFirstPerson != 0);
 
     /* R-lock flag */
-    if (IsAddressValid(CV64_ADDR_R_LOCK_VIEW, 4))
-        info->isRLocked = (CV64_ReadU32(rdram, CV64_ADDR_R_LOCK_VIEW) != 0);
+    if (SnapHas(snap, CV64_SNAP_R_LOCK_VIEW))
+        info->isRLocked = (snap->rLockView != 0);
 
     /* Game time & day/night */
     info->gameTime = s_game_time.load(std::memory_order_acquire);
@@ -2278,59 +2801,63 @@ static void ReadExtendedSaveData(u8* rdram, CV64_GameInfo* info) {
     info->gameState = s_game_state.load(std::memory_order_acquire);
 
     /* Process meter (frame budget) */
-    if (IsAddressValid(CV64_ADDR_PROCESS_GREEN_SIZE, 4))
-        info->processMeterGreen = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_GREEN_SIZE);
-    if (IsAddressValid(CV64_ADDR_PROCESS_BLUE_SIZE, 4))
-        info->processMeterBlue = CV64_ReadF32(rdram, CV64_ADDR_PROCESS_BLUE_SIZE);
+    if (SnapHas(snap, CV64_SNAP_PROCESS_GREEN))
+        info->processMeterGreen = snap->processGreenSize;
+    if (SnapHas(snap, CV64_SNAP_PROCESS_BLUE))
+        info->processMeterBlue = snap->processBlueSize;
 
     /* Boss bar visibility */
-    if (IsAddressValid(CV64_ADDR_BOSS_BAR_FILL_COLOR, 4))
-        info->bossBarVisible = (CV64_ReadU32(rdram, CV64_ADDR_BOSS_BAR_FILL_COLOR) != 0);
+    if (SnapHas(snap, CV64_SNAP_BOSS_BAR_COLOR))
+        info->bossBarVisible = (snap->bossBarFillColor != 0);
 
     /* Fog info */
-    if (IsAddressValid(CV64_ADDR_FOG_DIST_START, 2))
-        info->fogDistStart = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_START);
-    if (IsAddressValid(CV64_ADDR_FOG_DIST_END, 2))
-        info->fogDistEnd = CV64_ReadU16(rdram, CV64_ADDR_FOG_DIST_END);
-    if (IsAddressValid(CV64_ADDR_MAP_AMBIENT_BRIGHT, 4))
-        info->ambientBrightness = CV64_ReadF32(rdram, CV64_ADDR_MAP_AMBIENT_BRIGHT);
+    if (SnapHas(snap, CV64_SNAP_FOG_DIST_START))
+        info->fogDistStart = snap->fogDistStart;
+    if (SnapHas(snap, CV64_SNAP_FOG_DIST_END))
+        info->fogDistEnd = snap->fogDistEnd;
+    if (SnapHas(snap, CV64_SNAP_AMBIENT_BRIGHT))
+        info->ambientBrightness = snap->ambientBrightness;
 
     /* Controller pak file number */
-    if (IsAddressValid(CV64_ADDR_CONTPAK_FILE_NO, 1))
-        info->contPakFileNo = (s16)CV64_ReadU8(rdram, CV64_ADDR_CONTPAK_FILE_NO);
+    if (SnapHas(snap, CV64_SNAP_CONTPAK_FILE_NO))
+        info->contPakFileNo = (s16)snap->contPakFileNo;
     else
         info->contPakFileNo = -1;
 
     /* Enemy target lock-on */
-    if (IsAddressValid(CV64_ADDR_PTR_ENEMY_TARGET_GFX, 4))
-        info->isEnemyTargetActive = (CV64_ReadU32(rdram, CV64_ADDR_PTR_ENEMY_TARGET_GFX) != 0);
+    if (SnapHas(snap, CV64_SNAP_ENEMY_TARGET_PTR))
+        info->isEnemyTargetActive = (snap->enemyTargetGfxPtr != 0);
 
     /* Player has max health */
-    if (IsAddressValid(CV64_ADDR_HAS_MAX_HEALTH, 1))
-        info->hasMaxHealth = (CV64_ReadU8(rdram, CV64_ADDR_HAS_MAX_HEALTH) != 0);
+    if (SnapHas(snap, CV64_SNAP_HAS_MAX_HEALTH))
+        info->hasMaxHealth = (snap->hasMaxHealth != 0);
 }
 
 /**
- * @brief Get full game info structure for window title display & PC HUD
+ * @brief Reset a CV64_GameInfo to its "not running" defaults
  */
-bool CV64_Memory_GetGameInfo(CV64_GameInfo* info) {
-    if (!info) return false;
-
-    /* Initialize with defaults */
+static void InitGameInfoDefaults(CV64_GameInfo* info) {
     memset(info, 0, sizeof(CV64_GameInfo));
     info->mapId = -1;
     info->mapEntrance = -1;
     info->health = -1;
     info->maxHealth = -1;
+    info->character = -1;
     info->gameState = CV64_STATE_NOT_RUNNING;
     info->contPakFileNo = -1;
+    strncpy(info->mapName, "Not Running", sizeof(info->mapName) - 1);
+    strncpy(info->characterName, " ", sizeof(info->characterName) - 1);
+}
 
-    u8* rdram = SafeGetRDRAM();
-    if (!s_initialized.load(std::memory_order_acquire) || !rdram) {
-        strncpy(info->mapName, "Not Running", sizeof(info->mapName) - 1);
-        strncpy(info->characterName, " ", sizeof(info->characterName) - 1);
-        return false;
-    }
+/**
+ * @brief Build the full game info from the current snapshot
+ * Emulation thread only; other threads get the published copy.
+ */
+static bool BuildGameInfo(CV64_GameInfo* info) {
+    InitGameInfoDefaults(info);
+
+    const CV64_RDRAMSnapshot* snap = SnapGet();
+    if (!snap) return false;
 
     /* Read map info */
     info->mapId = ReadCurrentMapId();
@@ -2343,6 +2870,8 @@ bool CV64_Memory_GetGameInfo(CV64_GameInfo* info) {
     info->maxHealth = CV64_Memory_GetPlayerMaxHealth();
 
     /* Get character name */
+    if (SnapHas(snap, CV64_SNAP_CHARACTER))
+        info->character = snap->character;
     const char* charName = CV64_Memory_GetCharacterName();
     strncpy(info->characterName, charName, sizeof(info->characterName) - 1);
 
@@ -2350,7 +2879,44 @@ bool CV64_Memory_GetGameInfo(CV64_GameInfo* info) {
     info->isInGameplay = s_is_in_gameplay.load(std::memory_order_acquire);
 
     /* Read all extended data (gold, jewels, subweapon, position, etc.) */
-    ReadExtendedSaveData(rdram, info);
+    ReadExtendedSaveData(snap, info);
 
     return true;
 }
+
+/**
+ * @brief Build this frame's game info and publish it
+ */
+static void PublishGameInfo(void) {
+    PublishedGameInfo published;
+    published.valid = BuildGameInfo(&published.info);
+    s_game_info.Store(published);
+}
+
+/**
+ * @brief Get full game info structure for window title display & PC HUD
+ * Safe from any thread: copies the last frame published by the emulation
+ * thread and never touches RDRAM.
+ */
+bool CV64_Memory_GetGameInfo(CV64_GameInfo* info) {
+    if (!info) return false;
+
+    PublishedGameInfo published;
+    u32 generation = 0;
+    if (s_initialized.load(std::memory_order_acquire)) {
+        generation = s_game_info.Load(published);
+    }
+
+    if (generation == 0) {
+        InitGameInfoDefaults(info);
+        return false;
+    }
+
+    *info = published.info;
+    info->generation = generation;
+    return published.valid;
+}
+
+u32 CV64_Memory_GetGameInfoGeneration(void) {
+    return s_game_info.Generation();
+}
@@ -820,6 +820,18 @@ uint32_t CV64_ModelViewer_ScanROM(const char* romPath) {
         g_models.push_back(modelInfo);
     }
     
+    // Queue every model's vertex data for read-in as one batch, so loading
+    // models afterwards hits resident pages instead of faulting each one in
+    if (g_romFile && modelCount > 0) {
+        std::vector<CV64_ROMReadRequest> prefetch(modelCount);
+        for (uint32_t i = 0; i < modelCount; i++) {
+            prefetch[i].offset = database[i].vertexOffset;
+            prefetch[i].size = database[i].dataSize < 0x10000 ? database[i].dataSize : 0x10000;
+            prefetch[i].buffer = NULL;
+        }
+        CV64_ROM_ReadV(g_romFile, prefetch.data(), prefetch.size());
+    }
+    
     char logMsg[256];
     sprintf_s(logMsg, "[CV64] Model viewer scanned %u models from database\n", modelCount);
     OutputDebugStringA(logMsg);
@@ -874,36 +886,37 @@ bool CV64_ModelViewer_LoadModel(uint32_t modelID) {
                     uint32_t dataSize = dbEntry->dataSize;
                     if (dataSize > 0x10000) dataSize = 0x10000; // Safety limit: 64KB
                     
-                    uint8_t* romData = (uint8_t*)malloc(dataSize);
-                    if (romData) {
-                        size_t bytesRead = CV64_ROM_Read(g_romFile, dbEntry->vertexOffset, romData, dataSize);
-                        
-                        if (bytesRead > 0) {
-                            // Try to parse as vertex data
-                            if (CV64_ParseN64Vertices(romData, bytesRead, &g_currentGeometry)) {
-                                g_geometryLoaded = true;
-                                
-                                // Update model info
-                                g_currentModel.vertexCount = g_currentGeometry.vertexCount;
-                                g_currentModel.triangleCount = g_currentGeometry.triangleCount;
-                                g_currentModel.minX = g_currentGeometry.minX;
-                                g_currentModel.minY = g_currentGeometry.minY;
-                                g_currentModel.minZ = g_currentGeometry.minZ;
-                                g_currentModel.maxX = g_currentGeometry.maxX;
-                                g_currentModel.maxY = g_currentGeometry.maxY;
-                                g_currentModel.maxZ = g_currentGeometry.maxZ;
-                                
-                                sprintf_s(logMsg, "[CV64] Successfully loaded geometry: %u vertices, %u triangles\n",
-                                    g_currentGeometry.vertexCount, g_currentGeometry.triangleCount);
-                                OutputDebugStringA(logMsg);
-                            } else {
-                                OutputDebugStringA("[CV64] Failed to parse geometry data\n");
-                            }
+                    // Parse straight out of the mapped ROM (clamped to its end)
+                    size_t romSize = CV64_ROM_GetSize(g_romFile);
+                    size_t bytesRead = 0;
+                    if (dbEntry->vertexOffset < romSize) {
+                        bytesRead = romSize - dbEntry->vertexOffset;
+                        if (bytesRead > dataSize) bytesRead = dataSize;
+                    }
+                    const uint8_t* romData = (const uint8_t*)CV64_ROM_Map(g_romFile, dbEntry->vertexOffset, bytesRead);
+                    if (romData && bytesRead > 0) {
+                        // Try to parse as vertex data
+                        if (CV64_ParseN64Vertices(romData, bytesRead, &g_currentGeometry)) {
+                            g_geometryLoaded = true;
+                            
+                            // Update model info
+                            g_currentModel.vertexCount = g_currentGeometry.vertexCount;
+                            g_currentModel.triangleCount = g_currentGeometry.triangleCount;
+                            g_currentModel.minX = g_currentGeometry.minX;
+                            g_currentModel.minY = g_currentGeometry.minY;
+                            g_currentModel.minZ = g_currentGeometry.minZ;
+                            g_currentModel.maxX = g_currentGeometry.maxX;
+                            g_currentModel.maxY = g_currentGeometry.maxY;
+                            g_currentModel.maxZ = g_currentGeometry.maxZ;
+                            
+                            sprintf_s(logMsg, "[CV64] Successfully loaded geometry: %u vertices, %u triangles\n",
+                                g_currentGeometry.vertexCount, g_currentGeometry.triangleCount);
+                            OutputDebugStringA(logMsg);
                         } else {
-                            OutputDebugStringA("[CV64] Failed to read from ROM\n");
+                            OutputDebugStringA("[CV64] Failed to parse geometry data\n");
                         }
-                        
-                        free(romData);
+                    } else {
+                        OutputDebugStringA("[CV64] Failed to read from ROM\n");
                     }
                 } else {
                     OutputDebugStringA("[CV64] ROM not loaded, using placeholder geometry\n");
@@ -78,6 +78,7 @@ static CV64_PerformanceConfig s_config = {
     .enableTextureCaching = true,
     .enableFramebufferOptimization = true,
     .enableDrawCallBatching = true,
+    .enableDrawCallMerging = true,
     .maxTextureSize = 2048,  // Limit texture size for performance
     .mipmapBias = 0.0f,
     
@@ -108,49 +109,157 @@ static CV64_PerformanceConfig s_config = {
  * Texture Cache Optimization
  *===========================================================================*/
 
+// Cache entries live in a flat pool and are threaded onto an intrusive
+// doubly-linked LRU list (head = most recent). Lookup goes through an
+// open-addressing table (linear probing, backward-shift deletion) that maps
+// the packed cache key to a pool index. Touch and evict are O(1); eviction
+// runs whenever cached bytes exceed textureMemoryBudget.
 struct TextureCacheEntry {
+    uint64_t key;
     GLuint textureId;
     uint32_t crc;
     uint32_t width;
     uint32_t height;
     uint32_t format;
     size_t memorySize;
-    std::chrono::steady_clock::time_point lastUsed;
+    uint32_t lruPrev;
+    uint32_t lruNext;
 };
 
-static std::unordered_map<uint64_t, TextureCacheEntry> s_textureCache;
+static constexpr uint32_t TEXCACHE_NIL = 0xFFFFFFFFu;
+static constexpr uint32_t TEXCACHE_INITIAL_ENTRIES = 2048;
+
+struct TextureCacheSlot {
+    uint64_t key;
+    uint32_t entry;          // Pool index, TEXCACHE_NIL when empty
+};
+
+static std::vector<TextureCacheEntry> s_texEntries;
+static std::vector<TextureCacheSlot> s_texSlots;    // Power-of-two size
+static uint32_t s_texFreeHead = TEXCACHE_NIL;       // Free list through lruNext
+static uint32_t s_texLruHead = TEXCACHE_NIL;
+static uint32_t s_texLruTail = TEXCACHE_NIL;
+static size_t s_texCount = 0;
 static std::atomic<size_t> s_textureCacheMemory(0);
-static const size_t MAX_TEXTURE_CACHE_ENTRIES = 2048;
+static std::atomic<uint64_t> s_textureCacheEvictions(0);
 
 // Calculate texture cache key from address and parameters
 static uint64_t CalculateTextureCacheKey(uint32_t addr, uint32_t width, uint32_t height, uint32_t format) {
     return ((uint64_t)addr << 32) | ((uint64_t)width << 16) | ((uint64_t)height << 8) | format;
 }
 
-// Evict least recently used textures when cache is full
-static void EvictLRUTextures(size_t targetSize) {
-    if (s_textureCache.empty()) return;
-    
-    std::vector<std::pair<uint64_t, std::chrono::steady_clock::time_point>> entries;
-    for (const auto& [key, entry] : s_textureCache) {
-        entries.push_back({key, entry.lastUsed});
+static inline size_t TexSlotHome(uint64_t key) {
+    // splitmix64 finalizer - the packed key has long runs of zero bits
+    key ^= key >> 30; key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27; key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return (size_t)key & (s_texSlots.size() - 1);
+}
+
+static void TexLruUnlink(uint32_t idx) {
+    TextureCacheEntry& e = s_texEntries[idx];
+    if (e.lruPrev != TEXCACHE_NIL) s_texEntries[e.lruPrev].lruNext = e.lruNext;
+    else s_texLruHead = e.lruNext;
+    if (e.lruNext != TEXCACHE_NIL) s_texEntries[e.lruNext].lruPrev = e.lruPrev;
+    else s_texLruTail = e.lruPrev;
+    e.lruPrev = e.lruNext = TEXCACHE_NIL;
+}
+
+static void TexLruPushFront(uint32_t idx) {
+    TextureCacheEntry& e = s_texEntries[idx];
+    e.lruPrev = TEXCACHE_NIL;
+    e.lruNext = s_texLruHead;
+    if (s_texLruHead != TEXCACHE_NIL) s_texEntries[s_texLruHead].lruPrev = idx;
+    s_texLruHead = idx;
+    if (s_texLruTail == TEXCACHE_NIL) s_texLruTail = idx;
+}
+
+static size_t TexFindSlot(uint64_t key) {
+    if (s_texSlots.empty()) return SIZE_MAX;
+    size_t mask = s_texSlots.size() - 1;
+    for (size_t i = TexSlotHome(key);; i = (i + 1) & mask) {
+        const TextureCacheSlot& slot = s_texSlots[i];
+        if (slot.entry == TEXCACHE_NIL) return SIZE_MAX;
+        if (slot.key == key) return i;
     }
-    
-    // Sort by last used time (oldest first)
-    std::sort(entries.begin(), entries.end(), 
-        [](const auto& a, const auto& b) { return a.second < b.second; });
-    
-    // Evict oldest entries until we're under budget
-    for (const auto& [key, time] : entries) {
-        if (s_textureCacheMemory.load() <= targetSize) break;
-        
-        auto it = s_textureCache.find(key);
-        if (it != s_textureCache.end()) {
-            glDeleteTextures(1, &it->second.textureId);
-            s_textureCacheMemory -= it->second.memorySize;
-            s_textureCache.erase(it);
+}
+
+static void TexInsertSlot(uint64_t key, uint32_t entry) {
+    size_t mask = s_texSlots.size() - 1;
+    size_t i = TexSlotHome(key);
+    while (s_texSlots[i].entry != TEXCACHE_NIL) i = (i + 1) & mask;
+    s_texSlots[i] = { key, entry };
+}
+
+// Backward-shift delete keeps probe chains intact without tombstones
+static void TexEraseSlot(size_t hole) {
+    size_t mask = s_texSlots.size() - 1;
+    size_t i = hole;
+    for (;;) {
+        i = (i + 1) & mask;
+        if (s_texSlots[i].entry == TEXCACHE_NIL) break;
+        size_t home = TexSlotHome(s_texSlots[i].key);
+        // Move i into the hole if its home is not in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            s_texSlots[hole] = s_texSlots[i];
+            hole = i;
         }
     }
+    s_texSlots[hole].entry = TEXCACHE_NIL;
+}
+
+// Keep the table at most half full. Only happens while the cache grows.
+static void TexReserve(size_t entries) {
+    size_t slotCount = 16;
+    while (slotCount < entries * 2) slotCount <<= 1;
+    if (slotCount <= s_texSlots.size()) return;
+    
+    s_texSlots.assign(slotCount, TextureCacheSlot{ 0, TEXCACHE_NIL });
+    for (uint32_t idx = s_texLruHead; idx != TEXCACHE_NIL; idx = s_texEntries[idx].lruNext) {
+        TexInsertSlot(s_texEntries[idx].key, idx);
+    }
+}
+
+static void TexGrowPool(size_t newSize) {
+    size_t oldSize = s_texEntries.size();
+    if (newSize <= oldSize) return;
+    s_texEntries.resize(newSize);
+    for (size_t i = newSize; i-- > oldSize;) {
+        s_texEntries[i].lruNext = s_texFreeHead;
+        s_texFreeHead = (uint32_t)i;
+    }
+    TexReserve(newSize);
+}
+
+static uint32_t TexAllocEntry() {
+    if (s_texFreeHead == TEXCACHE_NIL) {
+        TexGrowPool(s_texEntries.empty() ? TEXCACHE_INITIAL_ENTRIES : s_texEntries.size() * 2);
+    }
+    uint32_t idx = s_texFreeHead;
+    s_texFreeHead = s_texEntries[idx].lruNext;
+    return idx;
+}
+
+static void TexRemoveEntry(uint32_t idx, bool deleteTexture) {
+    TextureCacheEntry& e = s_texEntries[idx];
+    size_t slot = TexFindSlot(e.key);
+    if (slot != SIZE_MAX) TexEraseSlot(slot);
+    TexLruUnlink(idx);
+    if (deleteTexture) glDeleteTextures(1, &e.textureId);
+    s_textureCacheMemory -= e.memorySize;
+    s_texCount--;
+    e.lruNext = s_texFreeHead;
+    s_texFreeHead = idx;
+}
+
+// Evict least recently used textures until cached bytes fit the budget
+static void EvictLRUTextures(size_t targetSize, uint32_t keepIdx) {
+    while (s_textureCacheMemory.load() > targetSize && s_texLruTail != TEXCACHE_NIL) {
+        uint32_t victim = s_texLruTail;
+        if (victim == keepIdx) break;   // Never evict what we just inserted
+        TexRemoveEntry(victim, true);
+        s_textureCacheEvictions++;
+    }
 }
 
 bool CV64_Perf_CacheTexture(uint32_t addr, uint32_t width, uint32_t height, 
@@ -159,13 +268,19 @@ bool CV64_Perf_CacheTexture(uint32_t addr, uint32_t width, uint32_t height,
     
     uint64_t key = CalculateTextureCacheKey(addr, width, height, format);
     
-    auto it = s_textureCache.find(key);
-    if (it != s_textureCache.end() && it->second.crc == crc) {
-        // Cache hit!
-        it->second.lastUsed = std::chrono::steady_clock::now();
-        *outTextureId = it->second.textureId;
-        s_perfStats.textureCacheHits++;
-        return true;
+    size_t slot = TexFindSlot(key);
+    if (slot != SIZE_MAX) {
+        uint32_t idx = s_texSlots[slot].entry;
+        if (s_texEntries[idx].crc == crc) {
+            // Cache hit! Move to the front of the LRU list
+            if (idx != s_texLruHead) {
+                TexLruUnlink(idx);
+                TexLruPushFront(idx);
+            }
+            *outTextureId = s_texEntries[idx].textureId;
+            s_perfStats.textureCacheHits++;
+            return true;
+        }
     }
     
     s_perfStats.textureCacheMisses++;
@@ -176,34 +291,58 @@ void CV64_Perf_AddToTextureCache(uint32_t addr, uint32_t width, uint32_t height,
                                   uint32_t format, uint32_t crc, GLuint textureId) {
     if (!s_config.enableTextureCaching) return;
     
-    // Evict old entries if cache is too large
-    if (s_textureCache.size() >= MAX_TEXTURE_CACHE_ENTRIES) {
-        EvictLRUTextures(s_config.textureMemoryBudget * 0.8); // Keep at 80%
+    uint64_t key = CalculateTextureCacheKey(addr, width, height, format);
+    size_t memSize = (size_t)width * height * 4; // Assume RGBA
+    
+    uint32_t idx;
+    size_t slot = TexFindSlot(key);
+    if (slot != SIZE_MAX) {
+        // Same address/size/format with new contents: replace in place
+        idx = s_texSlots[slot].entry;
+        TextureCacheEntry& old = s_texEntries[idx];
+        if (old.textureId != textureId) {
+            glDeleteTextures(1, &old.textureId);
+        }
+        s_textureCacheMemory -= old.memorySize;
+        TexLruUnlink(idx);
+    } else {
+        idx = TexAllocEntry();
+        TexInsertSlot(key, idx);
+        s_texCount++;
     }
     
-    uint64_t key = CalculateTextureCacheKey(addr, width, height, format);
-    size_t memSize = width * height * 4; // Assume RGBA
-    
-    TextureCacheEntry entry = {
-        .textureId = textureId,
-        .crc = crc,
-        .width = width,
-        .height = height,
-        .format = format,
-        .memorySize = memSize,
-        .lastUsed = std::chrono::steady_clock::now()
-    };
-    
-    s_textureCache[key] = entry;
+    TextureCacheEntry& entry = s_texEntries[idx];
+    entry.key = key;
+    entry.textureId = textureId;
+    entry.crc = crc;
+    entry.width = width;
+    entry.height = height;
+    entry.format = format;
+    entry.memorySize = memSize;
+    TexLruPushFront(idx);
     s_textureCacheMemory += memSize;
-    s_perfStats.textureCacheSize.store(s_textureCache.size());
+    
+    if (s_textureCacheMemory.load() > s_config.textureMemoryBudget) {
+        EvictLRUTextures(s_config.textureMemoryBudget, idx);
+    }
+    
+    s_perfStats.textureCacheSize.store(s_texCount);
 }
 
 void CV64_Perf_ClearTextureCache() {
-    for (auto& [key, entry] : s_textureCache) {
-        glDeleteTextures(1, &entry.textureId);
+    for (uint32_t idx = s_texLruHead; idx != TEXCACHE_NIL; idx = s_texEntries[idx].lruNext) {
+        glDeleteTextures(1, &s_texEntries[idx].textureId);
+    }
+    
+    // Keep the storage; rebuild the free list
+    for (auto& slot : s_texSlots) slot.entry = TEXCACHE_NIL;
+    s_texFreeHead = TEXCACHE_NIL;
+    for (size_t i = s_texEntries.size(); i-- > 0;) {
+        s_texEntries[i].lruNext = s_texFreeHead;
+        s_texFreeHead = (uint32_t)i;
     }
-    s_textureCache.clear();
+    s_texLruHead = s_texLruTail = TEXCACHE_NIL;
+    s_texCount = 0;
     s_textureCacheMemory.store(0);
     s_perfStats.textureCacheSize.store(0);
 }
@@ -314,6 +453,15 @@ void CV64_Perf_ProcessRSPTask(void* task, uint32_t taskType) {
  * Draw Call Batching
  *===========================================================================*/
 
+// Draws are recorded into a fixed arena and ordered by a packed 64-bit key:
+//
+//   63        40 39        16 15  12 11      0
+//   | texture  | state hash | mode | depth   |
+//
+// The sort is a stable LSD radix sort (8 x 8-bit passes, all histograms
+// built in one sweep, passes skipped when every key shares that byte), so
+// draws with identical keys keep their submission order. Key fields are
+// truncated; the merge and bind logic always compares the full values.
 struct BatchedDrawCall {
     GLenum mode;
     uint32_t vertexCount;
@@ -322,43 +470,142 @@ struct BatchedDrawCall {
     uint32_t state;
 };
 
-static std::vector<BatchedDrawCall> s_drawCallBatch;
-static const uint32_t MAX_BATCH_SIZE = 256;
+struct DrawSortItem {
+    uint64_t key;
+    uint32_t index;
+};
+
+static const uint32_t DRAW_BATCH_CAPACITY = 4096;
+static const uint32_t DRAW_DEPTH_BUCKETS = 4096;
+
+static BatchedDrawCall s_drawCallBatch[DRAW_BATCH_CAPACITY];
+static DrawSortItem s_drawSortItems[DRAW_BATCH_CAPACITY];
+static DrawSortItem s_drawSortScratch[DRAW_BATCH_CAPACITY];
+static GLint s_multiDrawFirst[DRAW_BATCH_CAPACITY];
+static GLsizei s_multiDrawCount[DRAW_BATCH_CAPACITY];
+static uint32_t s_drawCallCount = 0;
+static std::atomic<uint64_t> s_drawCallsSubmitted(0);
+static double s_frameDrawSortMs = 0.0;          // Accumulated during the current frame
+static std::atomic<double> s_lastDrawSortMs(0.0);
+
+static inline uint64_t MakeDrawSortKey(GLuint texture, uint32_t state, GLenum mode, uint32_t depthBucket) {
+    uint64_t tex = texture & 0xFFFFFF;
+    uint64_t stateHash = (state ^ (state >> 24)) & 0xFFFFFF;
+    uint64_t prim = mode & 0xF;     // GL_POINTS..GL_POLYGON are 0-9
+    return (tex << 40) | (stateHash << 16) | (prim << 12) | (depthBucket & 0xFFF);
+}
+
+// Returns the buffer holding the sorted result (items or scratch)
+static DrawSortItem* RadixSortDrawKeys(DrawSortItem* items, DrawSortItem* scratch, uint32_t count) {
+    uint32_t histogram[8][256] = {};
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t key = items[i].key;
+        for (int pass = 0; pass < 8; pass++) {
+            histogram[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+    
+    DrawSortItem* src = items;
+    DrawSortItem* dst = scratch;
+    for (int pass = 0; pass < 8; pass++) {
+        uint32_t* counts = histogram[pass];
+        uint32_t firstByte = (uint32_t)(src[0].key >> (pass * 8)) & 0xFF;
+        if (counts[firstByte] == count) continue;   // Byte is constant - nothing to do
+        
+        uint32_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            uint32_t c = counts[b];
+            counts[b] = offset;
+            offset += c;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t b = (uint32_t)(src[i].key >> (pass * 8)) & 0xFF;
+            dst[counts[b]++] = src[i];
+        }
+        DrawSortItem* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    return src;
+}
+
+// Primitive lists can be concatenated; strips and fans cannot
+static inline bool IsListPrimitive(GLenum mode) {
+    return mode == GL_POINTS || mode == GL_LINES || mode == GL_TRIANGLES;
+}
 
 void CV64_Perf_BeginDrawCallBatching() {
     if (!s_config.enableDrawCallBatching) return;
-    s_drawCallBatch.clear();
+    s_drawCallCount = 0;
 }
 
 void CV64_Perf_AddDrawCall(GLenum mode, uint32_t vertexCount, uint32_t startIndex,
                            GLuint texture, uint32_t state) {
+    CV64_Perf_AddDrawCallEx(mode, vertexCount, startIndex, texture, state, 0.0f);
+}
+
+void CV64_Perf_AddDrawCallEx(GLenum mode, uint32_t vertexCount, uint32_t startIndex,
+                             GLuint texture, uint32_t state, float depth) {
     if (!s_config.enableDrawCallBatching) return;
     
-    BatchedDrawCall call = { mode, vertexCount, startIndex, texture, state };
-    s_drawCallBatch.push_back(call);
+    uint32_t bucket = 0;
+    if (depth > 0.0f) {
+        bucket = depth >= 1.0f ? DRAW_DEPTH_BUCKETS - 1 : (uint32_t)(depth * DRAW_DEPTH_BUCKETS);
+    }
+    
+    uint32_t index = s_drawCallCount++;
+    s_drawCallBatch[index] = { mode, vertexCount, startIndex, texture, state };
+    s_drawSortItems[index] = { MakeDrawSortKey(texture, state, mode, bucket), index };
     
     // Flush if batch is full
-    if (s_drawCallBatch.size() >= MAX_BATCH_SIZE) {
+    if (s_drawCallCount >= DRAW_BATCH_CAPACITY) {
         CV64_Perf_FlushDrawCalls();
     }
 }
 
 void CV64_Perf_FlushDrawCalls() {
-    if (!s_config.enableDrawCallBatching || s_drawCallBatch.empty()) return;
+    if (!s_config.enableDrawCallBatching || s_drawCallCount == 0) return;
+    
+    const uint32_t count = s_drawCallCount;
+    s_drawCallCount = 0;
+    s_drawCallsSubmitted += count;
     
-    // Sort by texture and state to minimize state changes
-    std::sort(s_drawCallBatch.begin(), s_drawCallBatch.end(),
-        [](const BatchedDrawCall& a, const BatchedDrawCall& b) {
-            if (a.texture != b.texture) return a.texture < b.texture;
-            if (a.state != b.state) return a.state < b.state;
-            return a.mode < b.mode;
-        });
+    // Sort by texture, state, mode and depth to minimize state changes
+    auto sortStart = std::chrono::high_resolution_clock::now();
+    const DrawSortItem* sorted = RadixSortDrawKeys(s_drawSortItems, s_drawSortScratch, count);
+    s_frameDrawSortMs += std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - sortStart).count();
     
     // Execute batched draw calls with minimal state changes
     GLuint currentTexture = 0;
     uint32_t currentState = 0xFFFFFFFF;
+    const bool merge = s_config.enableDrawCallMerging;
     
-    for (const auto& call : s_drawCallBatch) {
+    uint32_t i = 0;
+    while (i < count) {
+        const BatchedDrawCall& call = s_drawCallBatch[sorted[i].index];
+        
+        // Gather the run of compatible draws into one multi-draw record
+        uint32_t ranges = 1;
+        s_multiDrawFirst[0] = (GLint)call.startIndex;
+        s_multiDrawCount[0] = (GLsizei)call.vertexCount;
+        i++;
+        while (merge && i < count) {
+            const BatchedDrawCall& next = s_drawCallBatch[sorted[i].index];
+            if (next.texture != call.texture || next.state != call.state || next.mode != call.mode) break;
+            
+            uint32_t last = ranges - 1;
+            if (IsListPrimitive(call.mode) &&
+                (uint32_t)s_multiDrawFirst[last] + (uint32_t)s_multiDrawCount[last] == next.startIndex) {
+                s_multiDrawCount[last] += (GLsizei)next.vertexCount;   // Contiguous - extend range
+            } else {
+                s_multiDrawFirst[ranges] = (GLint)next.startIndex;
+                s_multiDrawCount[ranges] = (GLsizei)next.vertexCount;
+                ranges++;
+            }
+            i++;
+        }
+        
         if (call.texture != currentTexture) {
             glBindTexture(GL_TEXTURE_2D, call.texture);
             currentTexture = call.texture;
@@ -370,11 +617,9 @@ void CV64_Perf_FlushDrawCalls() {
         }
         
         // Execute draw call
-        // glDrawArrays(call.mode, call.startIndex, call.vertexCount);
+        // glMultiDrawArrays(call.mode, s_multiDrawFirst, s_multiDrawCount, ranges);
         s_perfStats.drawCalls++;
     }
-    
-    s_drawCallBatch.clear();
 }
 
 /*===========================================================================
@@ -425,6 +670,9 @@ void CV64_Perf_BeginFrame() {
 void CV64_Perf_EndFrame() {
     // Flush any pending draw calls
     CV64_Perf_FlushDrawCalls();
+    
+    s_lastDrawSortMs.store(s_frameDrawSortMs);
+    s_frameDrawSortMs = 0.0;
 }
 
 bool CV64_Perf_ShouldSkipFrame() {
@@ -512,9 +760,12 @@ void CV64_Perf_GetStats(CV64_PerformanceStats* stats) {
     
     stats->textureUploads = s_perfStats.textureUploads.load();
     stats->drawCalls = s_perfStats.drawCalls.load();
+    stats->drawCallsSubmitted = s_drawCallsSubmitted.load();
+    stats->drawSortTimeMs = s_lastDrawSortMs.load();
     stats->textureCacheHits = s_perfStats.textureCacheHits.load();
     stats->textureCacheMisses = s_perfStats.textureCacheMisses.load();
     stats->textureCacheSize = s_perfStats.textureCacheSize.load();
+    stats->textureCacheEvictions = s_textureCacheEvictions.load();
     stats->textureCacheMemoryMB = s_textureCacheMemory.load() / (1024.0 * 1024.0);
     
     stats->rspAudioTasks = s_perfStats.rspAudioTasks.load();
@@ -528,8 +779,11 @@ void CV64_Perf_ResetStats() {
     s_perfStats.droppedFrames.store(0);
     s_perfStats.textureUploads.store(0);
     s_perfStats.drawCalls.store(0);
+    s_drawCallsSubmitted.store(0);
+    s_lastDrawSortMs.store(0.0);
     s_perfStats.textureCacheHits.store(0);
     s_perfStats.textureCacheMisses.store(0);
+    s_textureCacheEvictions.store(0);
     s_perfStats.rspAudioTasks.store(0);
     s_perfStats.rspGraphicsTasks.store(0);
     s_perfStats.avgFrameTimeMs = 0.0;
@@ -554,8 +808,7 @@ bool CV64_Perf_Initialize() {
     
     // Preallocate buffers if enabled
     if (s_config.preallocateBuffers) {
-        s_drawCallBatch.reserve(MAX_BATCH_SIZE);
-        s_textureCache.reserve(MAX_TEXTURE_CACHE_ENTRIES);
+        TexGrowPool(TEXCACHE_INITIAL_ENTRIES);
         OutputDebugStringA("[CV64_PERF] Preallocated buffers\n");
     }
     
@@ -591,9 +844,9 @@ void CV64_Perf_Shutdown() {
         "  Total Frames: %llu\n"
         "  Dropped Frames: %llu\n"
         "  Avg FPS: %.2f\n"
-        "  Texture Cache: %llu hits, %llu misses (%.1f%% hit rate)\n"
+        "  Texture Cache: %llu hits, %llu misses (%.1f%% hit rate), %llu evictions\n"
         "  Cache Memory: %.2f MB\n"
-        "  Draw Calls: %llu\n"
+        "  Draw Calls: %llu submitted, %llu after merging\n"
         "  RSP Tasks: %llu audio, %llu graphics\n",
         stats.totalFrames,
         stats.droppedFrames,
@@ -602,7 +855,9 @@ void CV64_Perf_Shutdown() {
         stats.textureCacheMisses,
         (stats.textureCacheHits + stats.textureCacheMisses > 0) ?
             (100.0 * stats.textureCacheHits / (stats.textureCacheHits + stats.textureCacheMisses)) : 0.0,
+        stats.textureCacheEvictions,
         stats.textureCacheMemoryMB,
+        stats.drawCallsSubmitted,
         stats.drawCalls,
         stats.rspAudioTasks,
         stats.rspGraphicsTasks
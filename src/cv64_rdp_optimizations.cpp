@@ -20,11 +20,17 @@
 #include "../include/cv64_rdp_optimizations.h"
 #include "../include/cv64_performance_optimizations.h"
 
+#include "../include/cv64_cpu_features.h"
+
 #include <Windows.h>
 #include <vector>
-#include <unordered_map>
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
 #include <cstring>
+#include <limits>
+#include <random>
 
 /*===========================================================================
  * RDP State Tracking
@@ -155,15 +161,35 @@ bool CV64_RDP_SetTextureImage(uint32_t image) {
  * Triangle Culling Optimization
  *===========================================================================*/
 
-bool CV64_RDP_ShouldCullTriangle(float x0, float y0, float z0,
-                                  float x1, float y1, float z1,
-                                  float x2, float y2, float z2) {
-    if (!s_config.enableTriangleCulling) {
-        return false;
-    }
-    
+// Snapshot of the culling switches so the batch kernels see one consistent
+// set of parameters and do not re-read globals per triangle.
+struct CullParams {
+    bool backface;
+    bool scissor;
+    bool zeroArea;
+    float scissorX0, scissorY0;
+    float scissorX1, scissorY1;
+};
+
+static CullParams GetCullParams() {
+    CullParams p;
+    p.backface = (s_rdpState.geometryMode & 0x200) != 0; // G_CULL_BACK
+    p.scissor = s_config.enableScissorCulling;
+    p.zeroArea = s_config.enableZeroAreaCulling;
+    p.scissorX0 = s_rdpState.scissorX0;
+    p.scissorY0 = s_rdpState.scissorY0;
+    p.scissorX1 = s_rdpState.scissorX1;
+    p.scissorY1 = s_rdpState.scissorY1;
+    return p;
+}
+
+// Reference test. The SIMD kernels below reproduce it exactly: same
+// operation order, min/max written as (a < b ? a : b) which is what
+// MINPS/MAXPS compute, and ordered comparisons so NaN never culls.
+static inline bool CullTriangleScalar(const CullParams& p,
+                                      float x0, float y0, float x1, float y1, float x2, float y2) {
     // Backface culling (if enabled in geometry mode)
-    if (s_rdpState.geometryMode & 0x200) { // G_CULL_BACK
+    if (p.backface) {
         // Calculate triangle normal using cross product
         float dx1 = x1 - x0;
         float dy1 = y1 - y0;
@@ -174,53 +200,651 @@ bool CV64_RDP_ShouldCullTriangle(float x0, float y0, float z0,
         float cross = dx1 * dy2 - dy1 * dx2;
         
         if (cross < 0) {
-            s_rdpState.trianglesCulled++;
             return true; // Backfacing triangle
         }
     }
     
     // Scissor box culling
-    if (s_config.enableScissorCulling) {
+    if (p.scissor) {
         // Check if all vertices are outside scissor box
         float minX = (x0 < x1) ? ((x0 < x2) ? x0 : x2) : ((x1 < x2) ? x1 : x2);
         float maxX = (x0 > x1) ? ((x0 > x2) ? x0 : x2) : ((x1 > x2) ? x1 : x2);
         float minY = (y0 < y1) ? ((y0 < y2) ? y0 : y2) : ((y1 < y2) ? y1 : y2);
         float maxY = (y0 > y1) ? ((y0 > y2) ? y0 : y2) : ((y1 > y2) ? y1 : y2);
         
-        if (maxX < s_rdpState.scissorX0 || minX > s_rdpState.scissorX1 ||
-            maxY < s_rdpState.scissorY0 || minY > s_rdpState.scissorY1) {
-            s_rdpState.trianglesCulled++;
+        if (maxX < p.scissorX0 || minX > p.scissorX1 ||
+            maxY < p.scissorY0 || minY > p.scissorY1) {
             return true; // Completely outside scissor box
         }
     }
     
     // Zero-area triangle culling
-    if (s_config.enableZeroAreaCulling) {
-        float area = abs((x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0));
+    if (p.zeroArea) {
+        float area = std::fabs((x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0));
         if (area < 0.01f) {
-            s_rdpState.trianglesCulled++;
             return true; // Degenerate triangle
         }
     }
     
+    return false;
+}
+
+bool CV64_RDP_ShouldCullTriangle(float x0, float y0, float z0,
+                                  float x1, float y1, float z1,
+                                  float x2, float y2, float z2) {
+    if (!s_config.enableTriangleCulling) {
+        return false;
+    }
+    
+    if (CullTriangleScalar(GetCullParams(), x0, y0, x1, y1, x2, y2)) {
+        s_rdpState.trianglesCulled++;
+        return true;
+    }
+    
     s_rdpState.trianglesProcessed++;
     return false;
 }
 
+/*===========================================================================
+ * Batched Triangle Culling
+ *===========================================================================*/
+
+// SoA input: nine arrays of `count` floats in the order x0 y0 z0 x1 y1 z1
+// x2 y2 z2. Kernels write bit i of mask[i / 64] for culled triangles and
+// expect the mask to be zeroed. `begin` must be a multiple of 8 so a SIMD
+// group never straddles two mask words.
+struct CullStreams {
+    const float* x0; const float* y0;
+    const float* x1; const float* y1;
+    const float* x2; const float* y2;
+};
+
+static inline CullStreams GetCullStreams(const float* xyzSoA, uint32_t count) {
+    CullStreams s;
+    s.x0 = xyzSoA + (size_t)count * 0;
+    s.y0 = xyzSoA + (size_t)count * 1;
+    s.x1 = xyzSoA + (size_t)count * 3;
+    s.y1 = xyzSoA + (size_t)count * 4;
+    s.x2 = xyzSoA + (size_t)count * 6;
+    s.y2 = xyzSoA + (size_t)count * 7;
+    return s;
+}
+
+typedef void (*CullKernelFunc)(const CullParams& p, const CullStreams& s,
+                               uint32_t begin, uint32_t end, uint64_t* mask);
+
+static void CullKernelScalar(const CullParams& p, const CullStreams& s,
+                             uint32_t begin, uint32_t end, uint64_t* mask) {
+    for (uint32_t i = begin; i < end; i++) {
+        if (CullTriangleScalar(p, s.x0[i], s.y0[i], s.x1[i], s.y1[i], s.x2[i], s.y2[i])) {
+            mask[i >> 6] |= 1ULL << (i & 63);
+        }
+    }
+}
+
+#ifdef CV64_CPU_X64
+
+static void CullKernelSSE(const CullParams& p, const CullStreams& s,
+                          uint32_t begin, uint32_t end, uint64_t* mask) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 minArea = _mm_set1_ps(0.01f);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 sx0 = _mm_set1_ps(p.scissorX0), sy0 = _mm_set1_ps(p.scissorY0);
+    const __m128 sx1 = _mm_set1_ps(p.scissorX1), sy1 = _mm_set1_ps(p.scissorY1);
+    
+    uint32_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 x0 = _mm_loadu_ps(s.x0 + i), y0 = _mm_loadu_ps(s.y0 + i);
+        __m128 x1 = _mm_loadu_ps(s.x1 + i), y1 = _mm_loadu_ps(s.y1 + i);
+        __m128 x2 = _mm_loadu_ps(s.x2 + i), y2 = _mm_loadu_ps(s.y2 + i);
+        __m128 cull = zero;
+        
+        if (p.backface || p.zeroArea) {
+            __m128 dx1 = _mm_sub_ps(x1, x0), dy1 = _mm_sub_ps(y1, y0);
+            __m128 dx2 = _mm_sub_ps(x2, x0), dy2 = _mm_sub_ps(y2, y0);
+            __m128 cross = _mm_sub_ps(_mm_mul_ps(dx1, dy2), _mm_mul_ps(dy1, dx2));
+            if (p.backface) {
+                cull = _mm_or_ps(cull, _mm_cmplt_ps(cross, zero));
+            }
+            if (p.zeroArea) {
+                cull = _mm_or_ps(cull, _mm_cmplt_ps(_mm_and_ps(cross, absMask), minArea));
+            }
+        }
+        if (p.scissor) {
+            __m128 minX = _mm_min_ps(_mm_min_ps(x0, x1), x2);
+            __m128 maxX = _mm_max_ps(_mm_max_ps(x0, x1), x2);
+            __m128 minY = _mm_min_ps(_mm_min_ps(y0, y1), y2);
+            __m128 maxY = _mm_max_ps(_mm_max_ps(y0, y1), y2);
+            cull = _mm_or_ps(cull, _mm_or_ps(
+                _mm_or_ps(_mm_cmplt_ps(maxX, sx0), _mm_cmpgt_ps(minX, sx1)),
+                _mm_or_ps(_mm_cmplt_ps(maxY, sy0), _mm_cmpgt_ps(minY, sy1))));
+        }
+        
+        mask[i >> 6] |= (uint64_t)_mm_movemask_ps(cull) << (i & 63);
+    }
+    CullKernelScalar(p, s, i, end, mask);
+}
+
+CV64_CPU_TARGET("avx2")
+static void CullKernelAVX2(const CullParams& p, const CullStreams& s,
+                           uint32_t begin, uint32_t end, uint64_t* mask) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 minArea = _mm256_set1_ps(0.01f);
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 sx0 = _mm256_set1_ps(p.scissorX0), sy0 = _mm256_set1_ps(p.scissorY0);
+    const __m256 sx1 = _mm256_set1_ps(p.scissorX1), sy1 = _mm256_set1_ps(p.scissorY1);
+    
+    uint32_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 x0 = _mm256_loadu_ps(s.x0 + i), y0 = _mm256_loadu_ps(s.y0 + i);
+        __m256 x1 = _mm256_loadu_ps(s.x1 + i), y1 = _mm256_loadu_ps(s.y1 + i);
+        __m256 x2 = _mm256_loadu_ps(s.x2 + i), y2 = _mm256_loadu_ps(s.y2 + i);
+        __m256 cull = zero;
+        
+        if (p.backface || p.zeroArea) {
+            __m256 dx1 = _mm256_sub_ps(x1, x0), dy1 = _mm256_sub_ps(y1, y0);
+            __m256 dx2 = _mm256_sub_ps(x2, x0), dy2 = _mm256_sub_ps(y2, y0);
+            __m256 cross = _mm256_sub_ps(_mm256_mul_ps(dx1, dy2), _mm256_mul_ps(dy1, dx2));
+            if (p.backface) {
+                cull = _mm256_or_ps(cull, _mm256_cmp_ps(cross, zero, _CMP_LT_OQ));
+            }
+            if (p.zeroArea) {
+                cull = _mm256_or_ps(cull, _mm256_cmp_ps(_mm256_and_ps(cross, absMask), minArea, _CMP_LT_OQ));
+            }
+        }
+        if (p.scissor) {
+            __m256 minX = _mm256_min_ps(_mm256_min_ps(x0, x1), x2);
+            __m256 maxX = _mm256_max_ps(_mm256_max_ps(x0, x1), x2);
+            __m256 minY = _mm256_min_ps(_mm256_min_ps(y0, y1), y2);
+            __m256 maxY = _mm256_max_ps(_mm256_max_ps(y0, y1), y2);
+            cull = _mm256_or_ps(cull, _mm256_or_ps(
+                _mm256_or_ps(_mm256_cmp_ps(maxX, sx0, _CMP_LT_OQ), _mm256_cmp_ps(minX, sx1, _CMP_GT_OQ)),
+                _mm256_or_ps(_mm256_cmp_ps(maxY, sy0, _CMP_LT_OQ), _mm256_cmp_ps(minY, sy1, _CMP_GT_OQ))));
+        }
+        
+        mask[i >> 6] |= (uint64_t)_mm256_movemask_ps(cull) << (i & 63);
+    }
+    CullKernelScalar(p, s, i, end, mask);
+}
+
+#endif /* CV64_CPU_X64 */
+
+#ifdef CV64_CPU_ARM64
+
+// NEON FMIN/FMAX propagate NaN, unlike MINPS/the scalar ternaries, so
+// min/max are built from compare + select.
+static inline float32x4_t CullMinNeon(float32x4_t a, float32x4_t b) {
+    return vbslq_f32(vcltq_f32(a, b), a, b);
+}
+
+static inline float32x4_t CullMaxNeon(float32x4_t a, float32x4_t b) {
+    return vbslq_f32(vcgtq_f32(a, b), a, b);
+}
+
+static void CullKernelNEON(const CullParams& p, const CullStreams& s,
+                           uint32_t begin, uint32_t end, uint64_t* mask) {
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t minArea = vdupq_n_f32(0.01f);
+    const float32x4_t sx0 = vdupq_n_f32(p.scissorX0), sy0 = vdupq_n_f32(p.scissorY0);
+    const float32x4_t sx1 = vdupq_n_f32(p.scissorX1), sy1 = vdupq_n_f32(p.scissorY1);
+    const uint32_t laneBitsInit[4] = { 1, 2, 4, 8 };
+    const uint32x4_t laneBits = vld1q_u32(laneBitsInit);
+    
+    uint32_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        float32x4_t x0 = vld1q_f32(s.x0 + i), y0 = vld1q_f32(s.y0 + i);
+        float32x4_t x1 = vld1q_f32(s.x1 + i), y1 = vld1q_f32(s.y1 + i);
+        float32x4_t x2 = vld1q_f32(s.x2 + i), y2 = vld1q_f32(s.y2 + i);
+        uint32x4_t cull = vdupq_n_u32(0);
+        
+        if (p.backface || p.zeroArea) {
+            float32x4_t dx1 = vsubq_f32(x1, x0), dy1 = vsubq_f32(y1, y0);
+            float32x4_t dx2 = vsubq_f32(x2, x0), dy2 = vsubq_f32(y2, y0);
+            // Separate multiplies: a fused multiply-subtract would round differently
+            float32x4_t cross = vsubq_f32(vmulq_f32(dx1, dy2), vmulq_f32(dy1, dx2));
+            if (p.backface) {
+                cull = vorrq_u32(cull, vcltq_f32(cross, zero));
+            }
+            if (p.zeroArea) {
+                cull = vorrq_u32(cull, vcltq_f32(vabsq_f32(cross), minArea));
+            }
+        }
+        if (p.scissor) {
+            float32x4_t minX = CullMinNeon(CullMinNeon(x0, x1), x2);
+            float32x4_t maxX = CullMaxNeon(CullMaxNeon(x0, x1), x2);
+            float32x4_t minY = CullMinNeon(CullMinNeon(y0, y1), y2);
+            float32x4_t maxY = CullMaxNeon(CullMaxNeon(y0, y1), y2);
+            cull = vorrq_u32(cull, vorrq_u32(
+                vorrq_u32(vcltq_f32(maxX, sx0), vcgtq_f32(minX, sx1)),
+                vorrq_u32(vcltq_f32(maxY, sy0), vcgtq_f32(minY, sy1))));
+        }
+        
+        mask[i >> 6] |= (uint64_t)vaddvq_u32(vandq_u32(cull, laneBits)) << (i & 63);
+    }
+    CullKernelScalar(p, s, i, end, mask);
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+struct CullBackend {
+    CullKernelFunc kernel;
+    const char* name;
+};
+
+static CullBackend SelectCullBackend() {
+#ifdef CV64_CPU_X64
+    if (CV64_Cpu_HasAVX2()) return { CullKernelAVX2, "avx2" };
+    return { CullKernelSSE, "sse" };
+#elif defined(CV64_CPU_ARM64)
+    return { CullKernelNEON, "neon" };
+#else
+    return { CullKernelScalar, "scalar" };
+#endif
+}
+
+static const CullBackend& GetCullBackend() {
+    static const CullBackend backend = SelectCullBackend();
+    return backend;
+}
+
+uint32_t CV64_RDP_CullTriangles(const float* xyzSoA, uint32_t count, uint64_t* outMask) {
+    if (!outMask || count == 0) return 0;
+    memset(outMask, 0, ((size_t)(count + 63) / 64) * sizeof(uint64_t));
+    if (!xyzSoA || !s_config.enableTriangleCulling) {
+        return 0;
+    }
+    
+    const CullParams params = GetCullParams();
+    if (!params.backface && !params.scissor && !params.zeroArea) {
+        s_rdpState.trianglesProcessed += count;
+        return 0;
+    }
+    
+    GetCullBackend().kernel(params, GetCullStreams(xyzSoA, count), 0, count, outMask);
+    
+    uint32_t culled = 0;
+    for (uint32_t w = 0; w < (count + 63) / 64; w++) {
+        culled += (uint32_t)std::popcount(outMask[w]);
+    }
+    s_rdpState.trianglesCulled += culled;
+    s_rdpState.trianglesProcessed += count - culled;
+    return culled;
+}
+
+const char* CV64_RDP_GetCullBackend(void) {
+    return GetCullBackend().name;
+}
+
+/*===========================================================================
+ * Batched Culling Fuzzer and Benchmark
+ *===========================================================================*/
+
+static void CullLog(const char* msg) {
+    OutputDebugStringA("[CV64_RDP] ");
+    OutputDebugStringA(msg);
+    OutputDebugStringA("\n");
+}
+
+// Coordinates biased toward the cases that separate implementations:
+// shared vertices, near-degenerate slivers, signed zeros, NaN/Inf, denormals
+static float CullFuzzValue(std::mt19937& rng, float base) {
+    static const float specials[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.005f, -0.005f, 1e-39f, -1e-39f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), 3.4e38f, -3.4e38f, 319.5f, 239.5f
+    };
+    uint32_t pick = rng() % 16;
+    if (pick == 0) return specials[rng() % (sizeof(specials) / sizeof(specials[0]))];
+    if (pick == 1) return base;                                               // Shared coordinate
+    if (pick == 2) return std::nextafter(base, (rng() & 1) ? 1e30f : -1e30f); // Sliver
+    if (pick == 3) return base + (float)((int)(rng() % 21) - 10) * 0.001f;    // Near-zero area
+    return std::uniform_real_distribution<float>(-400.0f, 800.0f)(rng);
+}
+
+bool CV64_RDP_RunCullFuzzer(uint32_t iterations, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<float> soa;
+    std::vector<uint64_t> expected, actual;
+    
+    std::vector<CullBackend> backends = { { CullKernelScalar, "scalar" } };
+#ifdef CV64_CPU_X64
+    backends.push_back({ CullKernelSSE, "sse" });
+    if (CV64_Cpu_HasAVX2()) backends.push_back({ CullKernelAVX2, "avx2" });
+#endif
+#ifdef CV64_CPU_ARM64
+    backends.push_back({ CullKernelNEON, "neon" });
+#endif
+    
+    uint64_t trianglesChecked = 0;
+    for (uint32_t iter = 0; iter < iterations; iter++) {
+        uint32_t count = 1 + rng() % 300;
+        CullParams p;
+        p.backface = (rng() & 1) != 0;
+        p.scissor = (rng() & 1) != 0;
+        p.zeroArea = (rng() & 1) != 0;
+        p.scissorX0 = (float)(rng() % 320);
+        p.scissorY0 = (float)(rng() % 240);
+        p.scissorX1 = p.scissorX0 + (float)(rng() % 320);
+        p.scissorY1 = p.scissorY0 + (float)(rng() % 240);
+        
+        soa.assign((size_t)count * 9, 0.0f);
+        for (uint32_t i = 0; i < count; i++) {
+            float bx = std::uniform_real_distribution<float>(-100.0f, 400.0f)(rng);
+            float by = std::uniform_real_distribution<float>(-100.0f, 300.0f)(rng);
+            for (int v = 0; v < 3; v++) {
+                soa[(size_t)count * (v * 3 + 0) + i] = CullFuzzValue(rng, bx);
+                soa[(size_t)count * (v * 3 + 1) + i] = CullFuzzValue(rng, by);
+                soa[(size_t)count * (v * 3 + 2) + i] = CullFuzzValue(rng, 0.5f);
+            }
+        }
+        
+        const CullStreams s = GetCullStreams(soa.data(), count);
+        const size_t words = (count + 63) / 64;
+        expected.assign(words, 0);
+        for (uint32_t i = 0; i < count; i++) {
+            if (CullTriangleScalar(p, s.x0[i], s.y0[i], s.x1[i], s.y1[i], s.x2[i], s.y2[i])) {
+                expected[i >> 6] |= 1ULL << (i & 63);
+            }
+        }
+        
+        // Non-zero starts shift every lane group against the mask words
+        uint32_t begin = (count > 16) ? 8 * (rng() % 2) : 0;
+        for (const auto& backend : backends) {
+            actual.assign(words, 0);
+            CullKernelScalar(p, s, 0, begin, actual.data());
+            backend.kernel(p, s, begin, count, actual.data());
+            if (actual != expected) {
+                for (uint32_t i = 0; i < count; i++) {
+                    bool e = (expected[i >> 6] >> (i & 63)) & 1;
+                    bool a = (actual[i >> 6] >> (i & 63)) & 1;
+                    if (e != a) {
+                        char msg[256];
+                        snprintf(msg, sizeof(msg),
+                            "Cull fuzzer: %s mismatch (iter %u, tri %u): expected %d got %d "
+                            "v0=(%g,%g) v1=(%g,%g) v2=(%g,%g)",
+                            backend.name, iter, i, e, a,
+                            s.x0[i], s.y0[i], s.x1[i], s.y1[i], s.x2[i], s.y2[i]);
+                        CullLog(msg);
+                        break;
+                    }
+                }
+                return false;
+            }
+        }
+        trianglesChecked += count;
+    }
+    
+    char msg[128];
+    snprintf(msg, sizeof(msg), "Cull fuzzer: %llu triangles x %zu backends match scalar",
+             (unsigned long long)trianglesChecked, backends.size());
+    CullLog(msg);
+    return true;
+}
+
+bool CV64_RDP_RunCullBenchmark(uint32_t triangleCount, uint32_t iterations,
+                               CV64_RDPCullBenchResult* outResult) {
+    if (triangleCount == 0 || iterations == 0) return false;
+    
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-64.0f, 384.0f);
+    std::vector<float> soa((size_t)triangleCount * 9);
+    for (auto& v : soa) v = coord(rng);
+    std::vector<uint64_t> mask((triangleCount + 63) / 64);
+    const CullStreams s = GetCullStreams(soa.data(), triangleCount);
+    
+    // Run with every test enabled; restore caller state afterwards
+    const CV64_RDPState savedState = s_rdpState;
+    const CV64_RDPConfig savedConfig = s_config;
+    s_config.enableTriangleCulling = true;
+    s_config.enableScissorCulling = true;
+    s_config.enableZeroAreaCulling = true;
+    s_rdpState.geometryMode |= 0x200;
+    s_rdpState.scissorX0 = 0;
+    s_rdpState.scissorY0 = 0;
+    s_rdpState.scissorX1 = 319;
+    s_rdpState.scissorY1 = 239;
+    
+    using Clock = std::chrono::steady_clock;
+    volatile uint32_t sink = 0;
+    
+    auto start = Clock::now();
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (uint32_t i = 0; i < triangleCount; i++) {
+            sink = sink + CV64_RDP_ShouldCullTriangle(s.x0[i], s.y0[i], 0.0f,
+                                                      s.x1[i], s.y1[i], 0.0f,
+                                                      s.x2[i], s.y2[i], 0.0f);
+        }
+    }
+    double perCallSec = std::chrono::duration<double>(Clock::now() - start).count();
+    
+    const CullParams params = GetCullParams();
+    start = Clock::now();
+    for (uint32_t it = 0; it < iterations; it++) {
+        std::fill(mask.begin(), mask.end(), 0);
+        CullKernelScalar(params, s, 0, triangleCount, mask.data());
+    }
+    double scalarSec = std::chrono::duration<double>(Clock::now() - start).count();
+    
+    start = Clock::now();
+    for (uint32_t it = 0; it < iterations; it++) {
+        sink = sink + CV64_RDP_CullTriangles(soa.data(), triangleCount, mask.data());
+    }
+    double batchSec = std::chrono::duration<double>(Clock::now() - start).count();
+    (void)sink;
+    
+    s_rdpState = savedState;
+    s_config = savedConfig;
+    
+    const double tris = (double)triangleCount * iterations / 1.0e6;
+    CV64_RDPCullBenchResult r;
+    r.perCallMTrisPerSec = perCallSec > 0 ? tris / perCallSec : 0.0;
+    r.scalarBatchMTrisPerSec = scalarSec > 0 ? tris / scalarSec : 0.0;
+    r.simdBatchMTrisPerSec = batchSec > 0 ? tris / batchSec : 0.0;
+    r.backend = GetCullBackend().name;
+    
+    char msg[256];
+    snprintf(msg, sizeof(msg),
+        "Cull benchmark (%u tris x %u): per-call %.1f, scalar batch %.1f, %s batch %.1f Mtris/s",
+        triangleCount, iterations, r.perCallMTrisPerSec, r.scalarBatchMTrisPerSec,
+        r.backend, r.simdBatchMTrisPerSec);
+    CullLog(msg);
+    
+    if (outResult) *outResult = r;
+    return true;
+}
+
 /*===========================================================================
  * Display List Caching
  *===========================================================================*/
 
-struct DisplayListCache {
+// Open-addressed table keyed by display list hash, Robin Hood probing with
+// backward-shift deletion (no tombstones). Table slots only hold the hash
+// and the index of an entry in a fixed pool; entries never move, so they
+// sit on an intrusive LRU list (head = most recent) and eviction takes the
+// tail in O(1). Commands live in a ring of bump arenas, one per generation.
+// CV64_RDP_AdvanceFrame starts a new generation and recycles the oldest
+// arena: entries still used recently are copied into the previous arena
+// first, the rest are evicted. All storage is sized when the cache is
+// configured, so steady-state frames never allocate.
+#define DL_CACHE_GENERATIONS       4
+#define DL_ARENA_COMMANDS_PER_GEN  16384
+#define DL_CACHE_RETAIN_FRAMES     120     // Unused this long -> evicted on recycle
+#define DL_CACHE_NONE              UINT32_MAX
+
+struct DLCacheSlot {
+    uint32_t hash;
+    uint32_t probe;             // Distance from home slot + 1, 0 = empty
+    uint32_t entry;             // Index into s_dlEntries
+};
+
+struct DLCacheEntry {
     uint32_t hash;
     uint32_t address;
-    uint32_t size;
-    std::vector<RDPCommand> commands;
+    uint32_t generation;
+    uint32_t commandOffset;     // Index into that generation's arena
+    uint32_t commandCount;
+    uint32_t lruPrev;           // Towards the head (more recent)
+    uint32_t lruNext;           // Towards the tail; free list link when unused
     uint64_t lastUsed;
 };
 
-static std::unordered_map<uint32_t, DisplayListCache> s_dlCache;
+static std::vector<DLCacheSlot> s_dlSlots;
+static std::vector<DLCacheEntry> s_dlEntries;   // maxDLCacheSize entries
+static std::vector<RDPCommand> s_dlArena;      // DL_CACHE_GENERATIONS * DL_ARENA_COMMANDS_PER_GEN
+static uint32_t s_dlArenaUsed[DL_CACHE_GENERATIONS] = {};
+static uint32_t s_dlCurrentGen = 0;
+static uint32_t s_dlSlotMask = 0;
+static uint32_t s_dlLruHead = DL_CACHE_NONE;
+static uint32_t s_dlLruTail = DL_CACHE_NONE;
+static uint32_t s_dlFreeEntry = DL_CACHE_NONE;
+static size_t s_dlCount = 0;
 static uint64_t s_frameCounter = 0;
+static uint64_t s_dlEvictions = 0;
+static uint64_t s_dlHeapAllocs = 0;
+static uint64_t s_dlHeapAllocsAtFrameStart = 0;
+static uint64_t s_dlHeapAllocsLastFrame = 0;
+
+static inline RDPCommand* DLArenaBase(uint32_t generation) {
+    return s_dlArena.data() + (size_t)generation * DL_ARENA_COMMANDS_PER_GEN;
+}
+
+static inline uint32_t DLHomeSlot(uint32_t hash) {
+    return (hash ^ (hash >> 16)) & s_dlSlotMask;
+}
+
+static void DLLruUnlink(uint32_t index) {
+    DLCacheEntry& e = s_dlEntries[index];
+    if (e.lruPrev != DL_CACHE_NONE) s_dlEntries[e.lruPrev].lruNext = e.lruNext;
+    else s_dlLruHead = e.lruNext;
+    if (e.lruNext != DL_CACHE_NONE) s_dlEntries[e.lruNext].lruPrev = e.lruPrev;
+    else s_dlLruTail = e.lruPrev;
+}
+
+static void DLLruPushFront(uint32_t index) {
+    DLCacheEntry& e = s_dlEntries[index];
+    e.lruPrev = DL_CACHE_NONE;
+    e.lruNext = s_dlLruHead;
+    if (s_dlLruHead != DL_CACHE_NONE) s_dlEntries[s_dlLruHead].lruPrev = index;
+    else s_dlLruTail = index;
+    s_dlLruHead = index;
+}
+
+static void DLLruTouch(uint32_t index) {
+    if (s_dlLruHead != index) {
+        DLLruUnlink(index);
+        DLLruPushFront(index);
+    }
+    s_dlEntries[index].lastUsed = s_frameCounter;
+}
+
+// (Re)size storage for maxDLCacheSize entries. Only called on init/config.
+static void DLCacheAllocate(uint32_t maxEntries) {
+    uint32_t slotCount = 16;
+    while (slotCount < maxEntries * 2) slotCount <<= 1;
+    
+    if (s_dlSlots.size() != slotCount) {
+        s_dlSlots.assign(slotCount, DLCacheSlot{});
+        s_dlHeapAllocs++;
+    } else {
+        std::fill(s_dlSlots.begin(), s_dlSlots.end(), DLCacheSlot{});
+    }
+    if (s_dlEntries.size() != maxEntries) {
+        s_dlEntries.assign(maxEntries, DLCacheEntry{});
+        s_dlHeapAllocs++;
+    }
+    if (s_dlArena.empty()) {
+        s_dlArena.resize((size_t)DL_CACHE_GENERATIONS * DL_ARENA_COMMANDS_PER_GEN);
+        s_dlHeapAllocs++;
+    }
+    
+    // Chain every entry onto the free list
+    for (uint32_t i = 0; i < maxEntries; i++) {
+        s_dlEntries[i].lruNext = (i + 1 < maxEntries) ? i + 1 : DL_CACHE_NONE;
+    }
+    s_dlFreeEntry = maxEntries ? 0 : DL_CACHE_NONE;
+    s_dlLruHead = DL_CACHE_NONE;
+    s_dlLruTail = DL_CACHE_NONE;
+    
+    s_dlSlotMask = slotCount - 1;
+    s_dlCount = 0;
+    s_dlCurrentGen = 0;
+    memset(s_dlArenaUsed, 0, sizeof(s_dlArenaUsed));
+}
+
+static void DLCacheRelease() {
+    std::vector<DLCacheSlot>().swap(s_dlSlots);
+    std::vector<DLCacheEntry>().swap(s_dlEntries);
+    std::vector<RDPCommand>().swap(s_dlArena);
+    s_dlSlotMask = 0;
+    s_dlCount = 0;
+    s_dlLruHead = DL_CACHE_NONE;
+    s_dlLruTail = DL_CACHE_NONE;
+    s_dlFreeEntry = DL_CACHE_NONE;
+}
+
+static DLCacheSlot* DLCacheFind(uint32_t hash) {
+    if (s_dlSlots.empty()) return nullptr;
+    uint32_t i = DLHomeSlot(hash);
+    for (uint32_t dist = 1;; dist++, i = (i + 1) & s_dlSlotMask) {
+        DLCacheSlot& slot = s_dlSlots[i];
+        // Robin Hood invariant: once we pass a richer slot the key is absent
+        if (slot.probe < dist) return nullptr;
+        if (slot.hash == hash) return &slot;
+    }
+}
+
+static void DLCacheInsert(DLCacheSlot entry) {
+    uint32_t i = DLHomeSlot(entry.hash);
+    entry.probe = 1;
+    for (;; i = (i + 1) & s_dlSlotMask, entry.probe++) {
+        DLCacheSlot& slot = s_dlSlots[i];
+        if (slot.probe == 0) {
+            slot = entry;
+            s_dlCount++;
+            return;
+        }
+        if (slot.probe < entry.probe) {
+            std::swap(slot, entry);
+        }
+    }
+}
+
+// Remove a table slot and return its entry to the free list
+static void DLCacheErase(DLCacheSlot* slot) {
+    uint32_t index = slot->entry;
+    DLLruUnlink(index);
+    s_dlEntries[index].lruNext = s_dlFreeEntry;
+    s_dlFreeEntry = index;
+    
+    uint32_t i = (uint32_t)(slot - s_dlSlots.data());
+    uint32_t next = (i + 1) & s_dlSlotMask;
+    while (s_dlSlots[next].probe > 1) {
+        s_dlSlots[i] = s_dlSlots[next];
+        s_dlSlots[i].probe--;
+        i = next;
+        next = (next + 1) & s_dlSlotMask;
+    }
+    s_dlSlots[i].probe = 0;
+    s_dlCount--;
+}
+
+static bool DLCacheEvictLRU() {
+    if (s_dlLruTail == DL_CACHE_NONE) return false;
+    DLCacheSlot* victim = DLCacheFind(s_dlEntries[s_dlLruTail].hash);
+    if (!victim) return false;
+    DLCacheErase(victim);
+    s_dlEvictions++;
+    return true;
+}
+
+// Bump-allocate from the current generation; returns offset or UINT32_MAX
+static uint32_t DLArenaAlloc(uint32_t count) {
+    uint32_t& used = s_dlArenaUsed[s_dlCurrentGen];
+    if (count > DL_ARENA_COMMANDS_PER_GEN - used) return UINT32_MAX;
+    uint32_t offset = used;
+    used += count;
+    return offset;
+}
 
 uint32_t CV64_RDP_HashDisplayList(uint32_t address, const uint8_t* data, uint32_t size) {
     // Simple FNV-1a hash
@@ -237,16 +861,19 @@ bool CV64_RDP_GetCachedDisplayList(uint32_t address, uint32_t hash) {
         return false;
     }
     
-    auto it = s_dlCache.find(hash);
-    if (it != s_dlCache.end() && it->second.address == address) {
+    DLCacheSlot* slot = DLCacheFind(hash);
+    if (slot && s_dlEntries[slot->entry].address == address) {
         // Cache hit!
-        it->second.lastUsed = s_frameCounter;
+        DLLruTouch(slot->entry);
         s_rdpState.dlCacheHits++;
         
         // Execute cached commands
-        for (const auto& cmd : it->second.commands) {
+        const DLCacheEntry& entry = s_dlEntries[slot->entry];
+        const RDPCommand* commands = DLArenaBase(entry.generation) + entry.commandOffset;
+        for (uint32_t i = 0; i < entry.commandCount; i++) {
             // Execute command
             // NOTE: Actual execution would go here
+            (void)commands[i];
         }
         
         return true;
@@ -257,41 +884,91 @@ bool CV64_RDP_GetCachedDisplayList(uint32_t address, uint32_t hash) {
 }
 
 void CV64_RDP_CacheDisplayList(uint32_t address, uint32_t hash, 
-                                const RDPCommand* commands, uint32_t count) {
-    if (!s_config.enableDisplayListCaching) {
+                                const void* commands, uint32_t count) {
+    if (!s_config.enableDisplayListCaching || s_dlSlots.empty() || s_config.maxDLCacheSize == 0) {
         return;
     }
     
-    // Evict old entries if cache is too large
-    if (s_dlCache.size() >= MAX_DL_CACHE_ENTRIES) {
-        // Remove least recently used entry
-        uint32_t oldestHash = 0;
-        uint64_t oldestTime = s_frameCounter;
-        
-        for (const auto& [hash, cache] : s_dlCache) {
-            if (cache.lastUsed < oldestTime) {
-                oldestTime = cache.lastUsed;
-                oldestHash = hash;
-            }
-        }
-        
-        if (oldestHash != 0) {
-            s_dlCache.erase(oldestHash);
-        }
+    uint32_t offset = DLArenaAlloc(count);
+    if (offset == UINT32_MAX) {
+        return;     // Arena full this generation; retry after AdvanceFrame
+    }
+    memcpy(DLArenaBase(s_dlCurrentGen) + offset, commands, (size_t)count * sizeof(RDPCommand));
+    
+    DLCacheSlot* existing = DLCacheFind(hash);
+    if (existing) {
+        // Same hash: overwrite in place (old commands stay in their arena until recycled)
+        DLCacheEntry& entry = s_dlEntries[existing->entry];
+        entry.address = address;
+        entry.generation = s_dlCurrentGen;
+        entry.commandOffset = offset;
+        entry.commandCount = count;
+        DLLruTouch(existing->entry);
+        return;
     }
     
-    // Add to cache
-    DisplayListCache cache;
-    cache.hash = hash;
-    cache.address = address;
-    cache.commands.assign(commands, commands + count);
-    cache.lastUsed = s_frameCounter;
+    // Evict the least recently used entry if the cache is full
+    while (s_dlCount >= s_config.maxDLCacheSize || s_dlFreeEntry == DL_CACHE_NONE) {
+        if (!DLCacheEvictLRU()) return;
+    }
+    
+    uint32_t index = s_dlFreeEntry;
+    DLCacheEntry& entry = s_dlEntries[index];
+    s_dlFreeEntry = entry.lruNext;
+    entry.hash = hash;
+    entry.address = address;
+    entry.generation = s_dlCurrentGen;
+    entry.commandOffset = offset;
+    entry.commandCount = count;
+    entry.lastUsed = s_frameCounter;
+    DLLruPushFront(index);
     
-    s_dlCache[hash] = cache;
+    DLCacheSlot slot = {};
+    slot.hash = hash;
+    slot.entry = index;
+    DLCacheInsert(slot);
 }
 
 void CV64_RDP_AdvanceFrame() {
     s_frameCounter++;
+    s_dlHeapAllocsLastFrame = s_dlHeapAllocs - s_dlHeapAllocsAtFrameStart;
+    s_dlHeapAllocsAtFrameStart = s_dlHeapAllocs;
+    
+    if (s_dlSlots.empty()) return;
+    
+    // Recycle the oldest generation. Survivors move into the generation
+    // that was current until now; everything else is evicted.
+    const uint32_t prevGen = s_dlCurrentGen;
+    const uint32_t recycleGen = (s_dlCurrentGen + 1) % DL_CACHE_GENERATIONS;
+    
+    for (uint32_t i = 0; i <= s_dlSlotMask;) {
+        DLCacheSlot& slot = s_dlSlots[i];
+        if (slot.probe == 0 || s_dlEntries[slot.entry].generation != recycleGen) {
+            i++;
+            continue;
+        }
+        
+        DLCacheEntry& entry = s_dlEntries[slot.entry];
+        bool keep = s_frameCounter - entry.lastUsed <= DL_CACHE_RETAIN_FRAMES;
+        uint32_t offset = UINT32_MAX;
+        if (keep) {
+            offset = DLArenaAlloc(entry.commandCount);
+        }
+        if (offset != UINT32_MAX) {
+            memcpy(DLArenaBase(prevGen) + offset, DLArenaBase(recycleGen) + entry.commandOffset,
+                   (size_t)entry.commandCount * sizeof(RDPCommand));
+            entry.generation = prevGen;
+            entry.commandOffset = offset;
+            i++;
+        } else {
+            // Backward shift may pull another recycleGen entry into slot i
+            DLCacheErase(&slot);
+            s_dlEvictions++;
+        }
+    }
+    
+    s_dlArenaUsed[recycleGen] = 0;
+    s_dlCurrentGen = recycleGen;
 }
 
 /*===========================================================================
@@ -318,7 +995,11 @@ uint32_t CV64_RDP_GetOverdrawCount() {
 
 void CV64_RDP_SetConfig(const CV64_RDPConfig* config) {
     if (config) {
+        bool resizeCache = !s_dlSlots.empty() && config->maxDLCacheSize != s_config.maxDLCacheSize;
         s_config = *config;
+        if (resizeCache) {
+            DLCacheAllocate(s_config.maxDLCacheSize);
+        }
         
         OutputDebugStringA("[CV64_RDP] RDP optimizations configured:\n");
         OutputDebugStringA(s_config.enableCommandBatching ? "  ? Command batching\n" : "  ? Command batching\n");
@@ -342,7 +1023,10 @@ void CV64_RDP_GetStats(CV64_RDPStats* stats) {
     stats->commandsProcessed = s_rdpState.commandsProcessed;
     stats->dlCacheHits = s_rdpState.dlCacheHits;
     stats->dlCacheMisses = s_rdpState.dlCacheMisses;
-    stats->dlCacheSize = s_dlCache.size();
+    stats->dlCacheSize = s_dlCount;
+    stats->dlCacheEvictions = s_dlEvictions;
+    stats->dlCacheHeapAllocs = s_dlHeapAllocs;
+    stats->dlCacheHeapAllocsLastFrame = s_dlHeapAllocsLastFrame;
     stats->overdrawPixels = s_overdrawCounter;
     
     // Calculate culling effectiveness
@@ -363,6 +1047,7 @@ void CV64_RDP_ResetStats() {
     s_rdpState.commandsProcessed = 0;
     s_rdpState.dlCacheHits = 0;
     s_rdpState.dlCacheMisses = 0;
+    s_dlEvictions = 0;
 }
 
 bool CV64_RDP_Initialize() {
@@ -384,8 +1069,7 @@ bool CV64_RDP_Initialize() {
     s_config.maxDLCacheSize = 256; // 256 display lists
     
     // Clear caches
-    s_dlCache.clear();
-    s_dlCache.reserve(s_config.maxDLCacheSize);
+    DLCacheAllocate(s_config.maxDLCacheSize);
     
     OutputDebugStringA("[CV64_RDP] RDP optimizations initialized:\n");
     OutputDebugStringA("  ? Command batching (512 commands/batch)\n");
@@ -413,7 +1097,7 @@ void CV64_RDP_Shutdown() {
         "  State Changes: %llu\n"
         "  Commands Processed: %llu\n"
         "  DL Cache: %llu hits, %llu misses (%.1f%% hit rate)\n"
-        "  DL Cache Size: %zu entries\n",
+        "  DL Cache Size: %zu entries, %llu evictions, %llu heap allocations\n",
         stats.trianglesProcessed,
         stats.trianglesCulled,
         stats.cullingEffectiveness,
@@ -422,10 +1106,12 @@ void CV64_RDP_Shutdown() {
         stats.dlCacheHits,
         stats.dlCacheMisses,
         stats.dlCacheHitRate,
-        stats.dlCacheSize
+        stats.dlCacheSize,
+        stats.dlCacheEvictions,
+        stats.dlCacheHeapAllocs
     );
     OutputDebugStringA(buffer);
     
     // Clear caches
-    s_dlCache.clear();
+    DLCacheRelease();
 }
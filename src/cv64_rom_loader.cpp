@@ -8,12 +8,17 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "../include/cv64_rom_loader.h"
+#include "../include/cv64_cpu_features.h"
 #include <Windows.h>
+#include <psapi.h>
 #include <string>
 #include <filesystem>
 #include <fstream>
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 
 /*===========================================================================
  * Static Variables
@@ -55,6 +60,193 @@ static std::filesystem::path GetExecutableDirectory() {
     return std::filesystem::path(path).parent_path();
 }
 
+static f64 GetPrivateMB() {
+    PROCESS_MEMORY_COUNTERS_EX pmc = {};
+    pmc.cb = sizeof(pmc);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
+        return 0.0;
+    }
+    return (f64)pmc.PrivateUsage / (1024.0 * 1024.0);
+}
+
+static const char* GetFormatName(int format) {
+    switch (format) {
+        case 0:  return "z64";
+        case 1:  return "n64";
+        case 2:  return "v64";
+        default: return "unknown";
+    }
+}
+
+/*===========================================================================
+ * Byte Order Conversion
+ *===========================================================================*/
+
+typedef void (*RomSwapFunc)(u8* dst, const u8* src, size_t size);
+
+/* n64 -> z64: reverse each 32-bit word. A trailing partial word is copied. */
+static void RomSwapWordsScalar(u8* dst, const u8* src, size_t size) {
+    size_t words = size / 4;
+    for (size_t i = 0; i < words; i++) {
+        u32 w;
+        memcpy(&w, src + i * 4, 4);
+        w = SwapEndian32(w);
+        memcpy(dst + i * 4, &w, 4);
+    }
+    if (dst != src) {
+        memcpy(dst + words * 4, src + words * 4, size - words * 4);
+    }
+}
+
+/* v64 -> z64: swap each byte pair. A trailing odd byte is copied. */
+static void RomSwapHalvesScalar(u8* dst, const u8* src, size_t size) {
+    size_t pairs = size / 2;
+    for (size_t i = 0; i < pairs; i++) {
+        u8 a = src[i * 2];
+        u8 b = src[i * 2 + 1];
+        dst[i * 2] = b;
+        dst[i * 2 + 1] = a;
+    }
+    if (size & 1) {
+        dst[size - 1] = src[size - 1];
+    }
+}
+
+#ifdef CV64_CPU_X64
+
+alignas(16) static const u8 ROM_SHUFFLE_WORDS[16] = {
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+};
+alignas(16) static const u8 ROM_SHUFFLE_HALVES[16] = {
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+};
+
+/* 32 bytes per iteration; returns the bytes converted */
+CV64_CPU_TARGET("ssse3")
+static size_t RomShuffleSsse3(u8* dst, const u8* src, size_t size, const u8* pattern) {
+    const __m128i mask = _mm_load_si128((const __m128i*)pattern);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(a, mask));
+        _mm_storeu_si128((__m128i*)(dst + i + 16), _mm_shuffle_epi8(b, mask));
+    }
+    return i;
+}
+
+/* 64 bytes per iteration; the pattern repeats in both 128-bit lanes */
+CV64_CPU_TARGET("avx2")
+static size_t RomShuffleAvx2(u8* dst, const u8* src, size_t size, const u8* pattern) {
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)pattern));
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(a, mask));
+        _mm256_storeu_si256((__m256i*)(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+    }
+    return i;
+}
+
+static void RomSwapWordsSsse3(u8* dst, const u8* src, size_t size) {
+    size_t done = RomShuffleSsse3(dst, src, size, ROM_SHUFFLE_WORDS);
+    RomSwapWordsScalar(dst + done, src + done, size - done);
+}
+
+static void RomSwapHalvesSsse3(u8* dst, const u8* src, size_t size) {
+    size_t done = RomShuffleSsse3(dst, src, size, ROM_SHUFFLE_HALVES);
+    RomSwapHalvesScalar(dst + done, src + done, size - done);
+}
+
+static void RomSwapWordsAvx2(u8* dst, const u8* src, size_t size) {
+    size_t done = RomShuffleAvx2(dst, src, size, ROM_SHUFFLE_WORDS);
+    RomSwapWordsScalar(dst + done, src + done, size - done);
+}
+
+static void RomSwapHalvesAvx2(u8* dst, const u8* src, size_t size) {
+    size_t done = RomShuffleAvx2(dst, src, size, ROM_SHUFFLE_HALVES);
+    RomSwapHalvesScalar(dst + done, src + done, size - done);
+}
+
+#endif /* CV64_CPU_X64 */
+
+#ifdef CV64_CPU_ARM64
+
+static void RomSwapWordsNeon(u8* dst, const u8* src, size_t size) {
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        uint8x16_t a = vld1q_u8(src + i);
+        uint8x16_t b = vld1q_u8(src + i + 16);
+        uint8x16_t c = vld1q_u8(src + i + 32);
+        uint8x16_t d = vld1q_u8(src + i + 48);
+        vst1q_u8(dst + i, vrev32q_u8(a));
+        vst1q_u8(dst + i + 16, vrev32q_u8(b));
+        vst1q_u8(dst + i + 32, vrev32q_u8(c));
+        vst1q_u8(dst + i + 48, vrev32q_u8(d));
+    }
+    RomSwapWordsScalar(dst + i, src + i, size - i);
+}
+
+static void RomSwapHalvesNeon(u8* dst, const u8* src, size_t size) {
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        uint8x16_t a = vld1q_u8(src + i);
+        uint8x16_t b = vld1q_u8(src + i + 16);
+        uint8x16_t c = vld1q_u8(src + i + 32);
+        uint8x16_t d = vld1q_u8(src + i + 48);
+        vst1q_u8(dst + i, vrev16q_u8(a));
+        vst1q_u8(dst + i + 16, vrev16q_u8(b));
+        vst1q_u8(dst + i + 32, vrev16q_u8(c));
+        vst1q_u8(dst + i + 48, vrev16q_u8(d));
+    }
+    RomSwapHalvesScalar(dst + i, src + i, size - i);
+}
+
+#endif /* CV64_CPU_ARM64 */
+
+struct RomSwapBackend {
+    RomSwapFunc words;
+    RomSwapFunc halves;
+    const char* name;
+};
+
+static RomSwapBackend SelectRomSwapBackend() {
+#ifdef CV64_CPU_X64
+    if (CV64_Cpu_HasAVX2()) return { RomSwapWordsAvx2, RomSwapHalvesAvx2, "avx2" };
+    /* SSE4.1 implies SSSE3 (pshufb) */
+    if (CV64_Cpu_HasSSE41()) return { RomSwapWordsSsse3, RomSwapHalvesSsse3, "ssse3" };
+#endif
+#ifdef CV64_CPU_ARM64
+    return { RomSwapWordsNeon, RomSwapHalvesNeon, "neon" };
+#else
+    return { RomSwapWordsScalar, RomSwapHalvesScalar, "scalar" };
+#endif
+}
+
+static const RomSwapBackend& GetRomSwapBackend() {
+    static const RomSwapBackend backend = SelectRomSwapBackend();
+    return backend;
+}
+
+void CV64_Rom_ConvertToZ64(u8* dst, const u8* src, u64 size, int format) {
+    if (!dst || !src || size == 0) {
+        return;
+    }
+
+    if (format == 1) {
+        GetRomSwapBackend().words(dst, src, (size_t)size);
+    } else if (format == 2) {
+        GetRomSwapBackend().halves(dst, src, (size_t)size);
+    } else if (dst != src) {
+        memcpy(dst, src, (size_t)size);
+    }
+}
+
+const char* CV64_Rom_GetSwapBackend(void) {
+    return GetRomSwapBackend().name;
+}
+
 /*===========================================================================
  * ROM Format Detection
  *===========================================================================*/
@@ -85,21 +277,14 @@ bool CV64_Rom_Byteswap(u8* data, u64 size) {
     
     if (format == 1) {
         // Little-endian (n64) - swap 32-bit words
-        u32* words = (u32*)data;
-        for (u64 i = 0; i < size / 4; i++) {
-            words[i] = SwapEndian32(words[i]);
-        }
+        CV64_Rom_ConvertToZ64(data, data, size, format);
         LogInfo("Converted ROM from little-endian (n64) to big-endian (z64)");
         return true;
     }
     
     if (format == 2) {
         // Byte-swapped (v64) - swap adjacent bytes
-        for (u64 i = 0; i < size; i += 2) {
-            u8 temp = data[i];
-            data[i] = data[i + 1];
-            data[i + 1] = temp;
-        }
+        CV64_Rom_ConvertToZ64(data, data, size, format);
         LogInfo("Converted ROM from byte-swapped (v64) to big-endian (z64)");
         return true;
     }
@@ -262,6 +447,160 @@ bool CV64_Rom_Load(const char* path, CV64_RomInfo* info) {
     return true;
 }
 
+/*===========================================================================
+ * ROM Image Loading
+ *===========================================================================*/
+
+bool CV64_Rom_OpenImage(const char* path, bool writable, CV64_RomImage* image) {
+    if (!path || !image) {
+        SetError("Invalid parameters");
+        return false;
+    }
+    
+    memset(image, 0, sizeof(CV64_RomImage));
+    auto start = std::chrono::steady_clock::now();
+    
+    if (!CV64_MappedFile_Open(path, &image->file)) {
+        SetError(std::string("Failed to open ROM file: ") + path);
+        return false;
+    }
+    
+    image->size = image->file.size;
+    if (image->size < 0x1000) {
+        CV64_MappedFile_Close(&image->file);
+        SetError("ROM file too small");
+        return false;
+    }
+    
+    image->file_format = CV64_Rom_DetectFormat(image->file.data);
+    bool needsSwap = (image->file_format == 1 || image->file_format == 2);
+    
+    if (!needsSwap && !writable) {
+        // Native order and read-only use: hand out the mapping itself
+        image->data = image->file.data;
+    } else {
+        image->buffer = (u8*)malloc((size_t)image->size);
+        if (!image->buffer) {
+            CV64_MappedFile_Close(&image->file);
+            SetError("Out of memory for ROM image");
+            return false;
+        }
+        CV64_Rom_ConvertToZ64(image->buffer, image->file.data, image->size, image->file_format);
+        CV64_MappedFile_Close(&image->file);
+        image->data = image->buffer;
+    }
+    
+    image->load_ms = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    char logBuf[256];
+    sprintf_s(logBuf, sizeof(logBuf), "ROM image: %.2f MB %s, %s in %.2f ms",
+              image->size / (1024.0 * 1024.0), GetFormatName(image->file_format),
+              image->buffer ? (needsSwap ? "converted" : "copied") : "mapped (zero-copy)",
+              image->load_ms);
+    LogInfo(logBuf);
+    
+    return true;
+}
+
+void CV64_Rom_CloseImage(CV64_RomImage* image) {
+    if (!image) {
+        return;
+    }
+    CV64_MappedFile_Close(&image->file);
+    free(image->buffer);
+    memset(image, 0, sizeof(CV64_RomImage));
+}
+
+bool CV64_Rom_RunLoadBenchmark(const char* path, CV64_RomLoadBenchResult* result) {
+    using Clock = std::chrono::steady_clock;
+    CV64_RomLoadBenchResult r = {};
+    
+    // Warm the file cache so both paths read from memory
+    CV64_RomImage image;
+    if (!CV64_Rom_OpenImage(path, true, &image)) {
+        return false;
+    }
+    r.size = image.size;
+    r.file_format = image.file_format;
+    CV64_Rom_CloseImage(&image);
+    
+    // Both paths end by copying into a buffer standing in for the core's
+    // ROM copy (M64CMD_ROM_OPEN), allocated up front so it is not counted
+    std::vector<u8> coreRom((size_t)r.size, 1);
+    
+    // Previous path: read the whole file into a heap buffer, convert in place
+    f64 before = GetPrivateMB();
+    auto start = Clock::now();
+    std::vector<u8> data;
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        SetError("Failed to open ROM file");
+        return false;
+    }
+    data.resize((size_t)r.size);
+    size_t bytesRead = fread(data.data(), 1, data.size(), file);
+    fclose(file);
+    if (bytesRead != data.size()) {
+        SetError("Failed to read ROM file");
+        return false;
+    }
+    if (r.file_format == 1) {
+        RomSwapWordsScalar(data.data(), data.data(), data.size());
+    } else if (r.file_format == 2) {
+        RomSwapHalvesScalar(data.data(), data.data(), data.size());
+    }
+    memcpy(coreRom.data(), data.data(), data.size());
+    r.read_ms = std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+    r.read_private_mb = GetPrivateMB() - before;
+    
+    std::vector<u8>().swap(data);
+    
+    // Image path
+    before = GetPrivateMB();
+    start = Clock::now();
+    if (!CV64_Rom_OpenImage(path, false, &image)) {
+        return false;
+    }
+    memcpy(coreRom.data(), image.data, (size_t)image.size);
+    r.image_ms = std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+    r.image_private_mb = GetPrivateMB() - before;
+    
+    // Conversion throughput on the ROM-sized buffer (v64 kernel for v64
+    // files, n64 kernel otherwise)
+    RomSwapFunc scalar = (r.file_format == 2) ? RomSwapHalvesScalar : RomSwapWordsScalar;
+    RomSwapFunc dispatched = (r.file_format == 2) ? GetRomSwapBackend().halves : GetRomSwapBackend().words;
+    const int iterations = 8;
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        scalar(coreRom.data(), image.data, (size_t)image.size);
+    }
+    f64 scalarSeconds = std::chrono::duration<f64>(Clock::now() - start).count();
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        dispatched(coreRom.data(), image.data, (size_t)image.size);
+    }
+    f64 swapSeconds = std::chrono::duration<f64>(Clock::now() - start).count();
+    f64 totalMB = (f64)image.size * iterations / (1024.0 * 1024.0);
+    r.scalar_swap_mbps = scalarSeconds > 0.0 ? totalMB / scalarSeconds : 0.0;
+    r.swap_mbps = swapSeconds > 0.0 ? totalMB / swapSeconds : 0.0;
+    
+    CV64_Rom_CloseImage(&image);
+    
+    char logBuf[256];
+    sprintf_s(logBuf, sizeof(logBuf), "Load benchmark (%.2f MB %s): read %.2f ms / %.1f MB private, image %.2f ms / %.1f MB private",
+              r.size / (1024.0 * 1024.0), GetFormatName(r.file_format),
+              r.read_ms, r.read_private_mb, r.image_ms, r.image_private_mb);
+    LogInfo(logBuf);
+    sprintf_s(logBuf, sizeof(logBuf), "Load benchmark: byte-order conversion scalar %.0f MB/s, %s %.0f MB/s",
+              r.scalar_swap_mbps, CV64_Rom_GetSwapBackend(), r.swap_mbps);
+    LogInfo(logBuf);
+    
+    if (result) {
+        *result = r;
+    }
+    return true;
+}
+
 bool CV64_Rom_IsCV64(const CV64_RomInfo* info) {
     return info && info->is_valid && info->is_cv64;
 }
@@ -4,13 +4,19 @@
  */
 
 #include "../include/cv64_rom_reader.h"
+#include "../include/cv64_mapped_file.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <windows.h>
+#include <algorithm>
+#include <vector>
+
+// Requests closer together than this are prefetched as one range
+#define ROM_READV_MERGE_GAP (64 * 1024)
 
 struct CV64_ROMFile_t {
-    FILE* file;
+    CV64_MappedFile map;
     size_t size;
     char path[512];
 };
@@ -20,26 +26,24 @@ CV64_ROMFile CV64_ROM_Open(const char* romPath) {
         return NULL;
     }
     
-    CV64_ROMFile rom = (CV64_ROMFile)malloc(sizeof(struct CV64_ROMFile_t));
+    CV64_ROMFile rom = (CV64_ROMFile)calloc(1, sizeof(struct CV64_ROMFile_t));
     if (!rom) {
         return NULL;
     }
     
-    fopen_s(&rom->file, romPath, "rb");
-    if (!rom->file) {
+    if (!CV64_MappedFile_Open(romPath, &rom->map)) {
         free(rom);
         return NULL;
     }
+    rom->size = rom->map.size;
     
-    // Get file size
-    fseek(rom->file, 0, SEEK_END);
-    rom->size = ftell(rom->file);
-    fseek(rom->file, 0, SEEK_SET);
+    // Model and asset lookups jump around the ROM; don't read ahead
+    CV64_MappedFile_Advise(&rom->map, 0, rom->size, CV64_MAP_ADVICE_RANDOM);
     
     strcpy_s(rom->path, romPath);
     
     char logMsg[512];
-    sprintf_s(logMsg, "[CV64] ROM opened: %s (size: %zu bytes)\n", romPath, rom->size);
+    sprintf_s(logMsg, "[CV64] ROM opened: %s (size: %zu bytes, mapped)\n", romPath, rom->size);
     OutputDebugStringA(logMsg);
     
     return rom;
@@ -50,15 +54,13 @@ void CV64_ROM_Close(CV64_ROMFile rom) {
         return;
     }
     
-    if (rom->file) {
-        fclose(rom->file);
-    }
+    CV64_MappedFile_Close(&rom->map);
     
     free(rom);
 }
 
 size_t CV64_ROM_Read(CV64_ROMFile rom, uint32_t offset, void* buffer, size_t size) {
-    if (!rom || !rom->file || !buffer) {
+    if (!rom || !rom->map.data || !buffer) {
         return 0;
     }
     
@@ -66,12 +68,78 @@ size_t CV64_ROM_Read(CV64_ROMFile rom, uint32_t offset, void* buffer, size_t siz
         return 0;
     }
     
-    fseek(rom->file, offset, SEEK_SET);
-    size_t bytesRead = fread(buffer, 1, size, rom->file);
+    size_t bytesRead = std::min(size, rom->size - offset);
+    memcpy(buffer, rom->map.data + offset, bytesRead);
     
     return bytesRead;
 }
 
+const void* CV64_ROM_Map(CV64_ROMFile rom, uint32_t offset, size_t size) {
+    if (!rom || !rom->map.data) {
+        return NULL;
+    }
+    
+    if (offset >= rom->size || size > rom->size - offset) {
+        return NULL;
+    }
+    
+    return rom->map.data + offset;
+}
+
+size_t CV64_ROM_ReadV(CV64_ROMFile rom, CV64_ROMReadRequest* requests, size_t count) {
+    if (!rom || !rom->map.data || !requests || count == 0) {
+        return 0;
+    }
+    
+    // Visit requests in offset order
+    std::vector<uint32_t> order;
+    order.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        requests[i].bytesRead = 0;
+        if (requests[i].offset < rom->size && requests[i].size > 0) {
+            order.push_back((uint32_t)i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [requests](uint32_t a, uint32_t b) {
+        return requests[a].offset < requests[b].offset;
+    });
+    
+    // Prefetch merged ranges first so the reads below find the pages resident
+    size_t spanStart = 0;
+    size_t spanEnd = 0;
+    for (size_t i = 0; i < order.size(); i++) {
+        const CV64_ROMReadRequest& req = requests[order[i]];
+        size_t start = req.offset;
+        size_t end = std::min((size_t)req.offset + req.size, rom->size);
+        if (i > 0 && start <= spanEnd + ROM_READV_MERGE_GAP) {
+            spanEnd = std::max(spanEnd, end);
+            continue;
+        }
+        if (i > 0) {
+            CV64_MappedFile_Advise(&rom->map, spanStart, spanEnd - spanStart, CV64_MAP_ADVICE_WILLNEED);
+        }
+        spanStart = start;
+        spanEnd = end;
+    }
+    if (!order.empty()) {
+        CV64_MappedFile_Advise(&rom->map, spanStart, spanEnd - spanStart, CV64_MAP_ADVICE_WILLNEED);
+    }
+    
+    size_t total = 0;
+    for (uint32_t index : order) {
+        CV64_ROMReadRequest& req = requests[index];
+        if (!req.buffer) {
+            continue;
+        }
+        size_t bytes = std::min((size_t)req.size, rom->size - req.offset);
+        memcpy(req.buffer, rom->map.data + req.offset, bytes);
+        req.bytesRead = (uint32_t)bytes;
+        total += bytes;
+    }
+    
+    return total;
+}
+
 size_t CV64_ROM_GetSize(CV64_ROMFile rom) {
     if (!rom) {
         return 0;
@@ -81,5 +149,5 @@ size_t CV64_ROM_GetSize(CV64_ROMFile rom) {
 }
 
 bool CV64_ROM_IsValid(CV64_ROMFile rom) {
-    return rom && rom->file && rom->size > 0;
+    return rom && rom->map.data && rom->size > 0;
 }
@@ -8,14 +8,20 @@
  * IMPLEMENTATION NOTES:
  * =====================
  * 1. Graphics Thread: Handles OpenGL context and frame presentation.
- *    The main emulation thread queues frames, graphics thread presents them.
- *    This allows triple-buffering without blocking the CPU.
+ *    The emulation thread writes frames into a lock-free three-slot
+ *    mailbox and the graphics thread presents them (newest-wins or FIFO).
+ *    Slot memory is reused, so handing off a frame never allocates.
  * 
  * 2. Audio Thread: SDL's audio callback runs in a separate thread.
- *    We add a ring buffer for smoother audio with less underruns.
+ *    We add a lock-free SPSC ring buffer between the emulation thread and
+ *    the callback so neither can block the other.
  * 
  * 3. Worker Pool: General purpose thread pool for async tasks like
  *    texture loading, shader compilation, config file I/O, etc.
+ *    Each worker owns a Chase-Lev deque and steals from the others when
+ *    it runs dry. Submits from non-worker threads go through lock-free
+ *    per-priority injection queues. Tasks live in a fixed pool, so a
+ *    submit never allocates and never takes a lock.
  * 
  * 4. RSP Threading: EXPERIMENTAL - Most RSP tasks must be synchronous
  *    because they modify shared memory. Audio mixing is the exception.
@@ -26,6 +32,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "../include/cv64_threading.h"
+#include "../include/cv64_spsc_ring.h"
 
 #include <Windows.h>
 #include <thread>
@@ -36,30 +43,182 @@
 #include <vector>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <algorithm>
 
 /*===========================================================================
  * Internal Structures
  *===========================================================================*/
 
-// Frame data for async presentation
-struct QueuedFrame {
+// Frame mailbox slot states
+enum FrameSlotState : u32 {
+    FRAME_SLOT_FREE = 0,
+    FRAME_SLOT_WRITING,      // Owned by the producer
+    FRAME_SLOT_READY,        // Published, waiting for the presenter
+    FRAME_SLOT_PRESENTING    // Owned by the presenter
+};
+
+// Frame mailbox slot. state packs (sequence << 8) | FrameSlotState so a
+// single CAS moves a slot between owners. Buffer fields belong to whichever
+// side currently owns the slot.
+struct FrameSlot {
+    std::atomic<u64> state;
     void* data;
+    size_t capacity;
     int width;
     int height;
-    std::chrono::high_resolution_clock::time_point queueTime;
+    std::atomic<u64> acquireNs;
+    std::atomic<u64> submitNs;
+    std::atomic<u64> presentNs;
 };
 
-// Worker task
+// Worker pool sizing (all powers of two)
+static constexpr u32 WORKER_TASK_POOL_SIZE = 4096;
+static constexpr u32 WORKER_TASK_INDEX_BITS = 12;      // log2(WORKER_TASK_POOL_SIZE)
+static constexpr u32 WORKER_DEQUE_CAPACITY = 1024;
+static constexpr u32 WORKER_INVALID_INDEX = 0xFFFFFFFFu;
+static constexpr int MAX_WORKER_THREADS = 64;
+
+// Worker task (pooled, referenced by slot index)
+// id is (sequence << WORKER_TASK_INDEX_BITS) | slot while the task is in
+// flight and 0 once it has completed. queuedId holds the same id until some
+// thread claims the task to run it, so a task queued on a worker can be
+// taken back and run by the thread waiting for it. The slot has two
+// references (the queue entry and the run) and is freed after both.
 struct WorkerTask {
-    u32 id;
+    std::atomic<u32> id;
+    std::atomic<u32> queuedId;
+    std::atomic<u32> refs;
+    std::atomic<u32> nextFree;
     CV64_TaskFunc func;
     void* param;
     CV64_TaskCallback callback;
     void* userdata;
-    std::atomic<bool> completed;
     void* result;
 };
 
+// Chase-Lev work-stealing deque of task slot indices.
+// The owning worker pushes/pops at the bottom, thieves steal from the top.
+struct alignas(64) WorkStealingDeque {
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::atomic<u32> slots[WORKER_DEQUE_CAPACITY];
+
+    bool Push(u32 task) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(WORKER_DEQUE_CAPACITY)) {
+            return false;
+        }
+        slots[b & (WORKER_DEQUE_CAPACITY - 1)].store(task, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Pop(u32* task) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Empty
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        *task = slots[b & (WORKER_DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last element - race against thieves for it
+            bool won = top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    bool Steal(u32* task) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return false;
+        }
+
+        u32 value = slots[t & (WORKER_DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        *task = value;
+        return true;
+    }
+};
+
+// Bounded MPMC queue (Vyukov) used to inject tasks from non-worker threads.
+// Capacity equals the task pool size, so a push can never fail.
+struct InjectionQueue {
+    struct Cell {
+        std::atomic<u32> sequence;
+        u32 task;
+    };
+
+    alignas(64) Cell cells[WORKER_TASK_POOL_SIZE];
+    alignas(64) std::atomic<u32> enqueuePos{0};
+    alignas(64) std::atomic<u32> dequeuePos{0};
+
+    void Reset() {
+        for (u32 i = 0; i < WORKER_TASK_POOL_SIZE; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    bool Push(u32 task) {
+        u32 pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & (WORKER_TASK_POOL_SIZE - 1)];
+            u32 seq = cell.sequence.load(std::memory_order_acquire);
+            int32_t diff = static_cast<int32_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.task = task;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool Pop(u32* task) {
+        u32 pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & (WORKER_TASK_POOL_SIZE - 1)];
+            u32 seq = cell.sequence.load(std::memory_order_acquire);
+            int32_t diff = static_cast<int32_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    *task = cell.task;
+                    cell.sequence.store(pos + WORKER_TASK_POOL_SIZE, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
 // RSP task for async processing
 struct RSPTask {
     CV64_RSPTaskType type;
@@ -77,8 +236,8 @@ static CV64_ThreadConfig s_config = {
     .enableAsyncAudio = true,
     .enableWorkerThreads = true,
     .workerThreadCount = 0,  // Auto-detect
-    .graphicsQueueDepth = 2, // Double buffering default
-    .enableParallelRSP = false // Disabled by default - experimental
+    .enableParallelRSP = false, // Disabled by default - experimental
+    .framePolicy = CV64_FRAME_POLICY_LATEST
 };
 
 // State
@@ -89,27 +248,37 @@ static std::atomic<bool> s_shutdownRequested(false);
 static CV64_ThreadStats s_stats = {};
 static std::mutex s_statsMutex;
 
-// Graphics thread
+// Graphics thread + frame mailbox
 static std::thread s_graphicsThread;
-static std::mutex s_graphicsMutex;
-static std::condition_variable s_graphicsCV;
-static std::queue<QueuedFrame> s_frameQueue;
+static FrameSlot s_frameSlots[CV64_FRAME_SLOT_COUNT];
+static int s_producerSlot = -1;                 // Slot the producer is writing
+static std::atomic<u64> s_frameSubmitSeq(0);    // Bumped on submit (presenter waits on it)
 static std::atomic<int> s_targetFPS(60);
-static std::atomic<bool> s_graphicsReady(false);
 
-// Audio ring buffer
-static std::mutex s_audioMutex;
-static std::vector<s16> s_audioBuffer;
-static std::atomic<size_t> s_audioReadPos(0);
-static std::atomic<size_t> s_audioWritePos(0);
+// Audio ring buffer (emulation thread -> audio callback)
+static CV64_SpscRing<s16> s_audioRing;
 static constexpr size_t AUDIO_BUFFER_SIZE = 48000 * 4; // ~1 second at 48kHz stereo
 
 // Worker thread pool
 static std::vector<std::thread> s_workerThreads;
-static std::mutex s_workerMutex;
-static std::condition_variable s_workerCV;
-static std::queue<std::shared_ptr<WorkerTask>> s_taskQueue;
-static std::atomic<u32> s_nextTaskId(1);
+static std::unique_ptr<WorkStealingDeque[]> s_workerDeques;
+static int s_workerCount = 0;
+static WorkerTask s_taskPool[WORKER_TASK_POOL_SIZE];
+static std::atomic<u64> s_taskFreeHead(0);              // (tag << 32) | index
+static InjectionQueue s_injectQueues[CV64_TASK_PRIORITY_COUNT];
+static std::atomic<u32> s_nextTaskSeq(1);
+static std::atomic<u32> s_pendingTasks(0);
+static std::atomic<u32> s_workerWakeEpoch(0);
+static std::atomic<int> s_sleepingWorkers(0);
+static std::atomic<u32> s_submitsInFlight(0);          // Submits past the shutdown check
+static thread_local int s_currentWorker = -1;
+
+// Worker statistics (merged into s_stats by CV64_Threading_GetStats)
+static std::atomic<u64> s_workerTasksQueued(0);
+static std::atomic<u64> s_workerTasksCompleted(0);
+static std::atomic<u64> s_workerTasksStolen(0);
+static std::atomic<u64> s_workerTasksRejected(0);
+static std::atomic<u64> s_workerTasksReclaimed(0);
 
 // RSP threading (experimental)
 static std::thread s_rspThread;
@@ -140,79 +309,134 @@ static void ThreadLogFmt(const char* fmt, ...) {
  * Graphics Thread Implementation
  *===========================================================================*/
 
+static u64 FrameNowNs() {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static inline u32 FrameSlotStateOf(u64 word) { return static_cast<u32>(word & 0xFF); }
+static inline u64 FrameSlotSeqOf(u64 word) { return word >> 8; }
+static inline u64 MakeFrameSlotWord(u64 seq, u32 state) { return (seq << 8) | state; }
+
+static void ResetFrameSlots() {
+    for (auto& slot : s_frameSlots) {
+        free(slot.data);
+        slot.data = nullptr;
+        slot.capacity = 0;
+        slot.width = 0;
+        slot.height = 0;
+        slot.state.store(MakeFrameSlotWord(0, FRAME_SLOT_FREE));
+        slot.acquireNs.store(0, std::memory_order_relaxed);
+        slot.submitNs.store(0, std::memory_order_relaxed);
+        slot.presentNs.store(0, std::memory_order_relaxed);
+    }
+    s_producerSlot = -1;
+}
+
+static bool HasReadyFrame() {
+    for (const auto& slot : s_frameSlots) {
+        if (FrameSlotStateOf(slot.state.load(std::memory_order_acquire)) == FRAME_SLOT_READY) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Presenter: claim a READY slot (newest for LATEST, oldest for FIFO).
+// With LATEST, older READY frames are released as dropped.
+static int TakeReadyFrame() {
+    const bool latest = s_config.framePolicy != CV64_FRAME_POLICY_FIFO;
+    
+    for (;;) {
+        int best = -1;
+        u64 bestWord = 0;
+        for (int i = 0; i < CV64_FRAME_SLOT_COUNT; ++i) {
+            u64 word = s_frameSlots[i].state.load(std::memory_order_acquire);
+            if (FrameSlotStateOf(word) != FRAME_SLOT_READY) continue;
+            if (best < 0 ||
+                (latest ? FrameSlotSeqOf(word) > FrameSlotSeqOf(bestWord)
+                        : FrameSlotSeqOf(word) < FrameSlotSeqOf(bestWord))) {
+                best = i;
+                bestWord = word;
+            }
+        }
+        if (best < 0) return -1;
+        
+        // The producer may recycle a READY slot under us (LATEST) - retry
+        if (!s_frameSlots[best].state.compare_exchange_strong(bestWord,
+                MakeFrameSlotWord(FrameSlotSeqOf(bestWord), FRAME_SLOT_PRESENTING),
+                std::memory_order_acq_rel)) {
+            continue;
+        }
+        
+        if (latest) {
+            for (int i = 0; i < CV64_FRAME_SLOT_COUNT; ++i) {
+                u64 word = s_frameSlots[i].state.load(std::memory_order_acquire);
+                if (i != best && FrameSlotStateOf(word) == FRAME_SLOT_READY &&
+                    s_frameSlots[i].state.compare_exchange_strong(word,
+                        MakeFrameSlotWord(FrameSlotSeqOf(word), FRAME_SLOT_FREE),
+                        std::memory_order_acq_rel)) {
+                    std::lock_guard<std::mutex> lock(s_statsMutex);
+                    s_stats.framesDropped++;
+                }
+            }
+        }
+        return best;
+    }
+}
+
 static void GraphicsThreadFunc() {
     ThreadLog("Graphics thread started");
     
     // Set thread name for debugging
     SetThreadDescription(GetCurrentThread(), L"CV64_GraphicsThread");
     
-    auto lastPresentTime = std::chrono::high_resolution_clock::now();
-    const double targetFrameTimeMs = 1000.0 / s_targetFPS.load();
+    auto lastPresentTime = std::chrono::steady_clock::now();
     
     while (!s_shutdownRequested.load()) {
-        QueuedFrame frame;
-        bool hasFrame = false;
-        
-        {
-            std::unique_lock<std::mutex> lock(s_graphicsMutex);
-            
-            // Wait for frame or shutdown
-            s_graphicsCV.wait_for(lock, std::chrono::milliseconds(16), [&]() {
-                return !s_frameQueue.empty() || s_shutdownRequested.load();
-            });
-            
-            if (!s_frameQueue.empty()) {
-                frame = s_frameQueue.front();
-                s_frameQueue.pop();
-                hasFrame = true;
-            }
+        // Sleep until the producer publishes something. The sequence is read
+        // before checking the slots so a submit in between isn't missed.
+        u64 seq = s_frameSubmitSeq.load();
+        if (!HasReadyFrame()) {
+            s_frameSubmitSeq.wait(seq);
+            continue;
         }
         
-        if (hasFrame && frame.data != nullptr) {
-            auto now = std::chrono::high_resolution_clock::now();
-            
-            // Calculate latency
-            double latencyMs = std::chrono::duration<double, std::milli>(
-                now - frame.queueTime).count();
-            
-            // Frame pacing - wait if we're presenting too fast
-            auto timeSinceLastPresent = std::chrono::duration<double, std::milli>(
-                now - lastPresentTime).count();
-            
-            if (timeSinceLastPresent < targetFrameTimeMs) {
-                double waitTime = targetFrameTimeMs - timeSinceLastPresent;
-                std::this_thread::sleep_for(
-                    std::chrono::microseconds(static_cast<int>(waitTime * 1000)));
-            }
-            
-            // Present frame
-            // NOTE: In a real implementation, this would call OpenGL swap buffers
-            // or similar. For now, we just track the frame.
-            // glfwSwapBuffers() or similar would go here
-            
-            lastPresentTime = std::chrono::high_resolution_clock::now();
-            
-            // Update stats
-            {
-                std::lock_guard<std::mutex> lock(s_statsMutex);
-                s_stats.framesPresentedAsync++;
-                // Running average
-                s_stats.avgPresentLatencyMs = 
-                    (s_stats.avgPresentLatencyMs * 0.95) + (latencyMs * 0.05);
-            }
-            
-            // Free frame data
-            free(frame.data);
+        // Frame pacing: wait out the rest of this frame period *before*
+        // picking a slot, so a newer frame submitted meanwhile wins.
+        auto frameTime = std::chrono::nanoseconds(1000000000LL / s_targetFPS.load());
+        auto nextPresent = lastPresentTime + frameTime;
+        if (std::chrono::steady_clock::now() < nextPresent) {
+            std::this_thread::sleep_until(nextPresent);
         }
-    }
-    
-    // Cleanup any remaining frames
-    {
-        std::lock_guard<std::mutex> lock(s_graphicsMutex);
-        while (!s_frameQueue.empty()) {
-            auto& f = s_frameQueue.front();
-            if (f.data) free(f.data);
-            s_frameQueue.pop();
+        
+        int slotIndex = TakeReadyFrame();
+        if (slotIndex < 0) continue;
+        
+        FrameSlot& slot = s_frameSlots[slotIndex];
+        u64 presentNs = FrameNowNs();
+        slot.presentNs.store(presentNs, std::memory_order_relaxed);
+        double latencyMs = (presentNs - slot.submitNs.load(std::memory_order_relaxed)) / 1e6;
+        
+        // Present frame
+        // NOTE: In a real implementation, this would call OpenGL swap buffers
+        // or similar. For now, we just track the frame.
+        // glfwSwapBuffers() or similar would go here
+        
+        lastPresentTime = std::chrono::steady_clock::now();
+        
+        // Hand the slot back to the producer
+        u64 word = slot.state.load(std::memory_order_relaxed);
+        slot.state.store(MakeFrameSlotWord(FrameSlotSeqOf(word), FRAME_SLOT_FREE),
+                         std::memory_order_release);
+        
+        // Update stats
+        {
+            std::lock_guard<std::mutex> lock(s_statsMutex);
+            s_stats.framesPresentedAsync++;
+            // Running average
+            s_stats.avgPresentLatencyMs = 
+                (s_stats.avgPresentLatencyMs * 0.95) + (latencyMs * 0.05);
         }
     }
     
@@ -223,6 +447,154 @@ static void GraphicsThreadFunc() {
  * Worker Thread Implementation
  *===========================================================================*/
 
+static void ResetTaskPool() {
+    for (u32 i = 0; i < WORKER_TASK_POOL_SIZE; ++i) {
+        s_taskPool[i].id.store(0, std::memory_order_relaxed);
+        s_taskPool[i].queuedId.store(0, std::memory_order_relaxed);
+        s_taskPool[i].refs.store(0, std::memory_order_relaxed);
+        s_taskPool[i].nextFree.store(
+            (i + 1 < WORKER_TASK_POOL_SIZE) ? i + 1 : WORKER_INVALID_INDEX,
+            std::memory_order_relaxed);
+    }
+    s_taskFreeHead.store(0, std::memory_order_release);
+
+    for (auto& queue : s_injectQueues) {
+        queue.Reset();
+    }
+    s_pendingTasks.store(0);
+}
+
+static u32 AllocTaskSlot() {
+    u64 head = s_taskFreeHead.load(std::memory_order_acquire);
+    for (;;) {
+        u32 index = static_cast<u32>(head);
+        if (index == WORKER_INVALID_INDEX) {
+            return WORKER_INVALID_INDEX;
+        }
+        u32 next = s_taskPool[index].nextFree.load(std::memory_order_relaxed);
+        u64 newHead = ((head >> 32) + 1) << 32 | next;
+        if (s_taskFreeHead.compare_exchange_weak(head, newHead,
+                std::memory_order_acquire, std::memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+static void FreeTaskSlot(u32 index) {
+    u64 head = s_taskFreeHead.load(std::memory_order_relaxed);
+    for (;;) {
+        s_taskPool[index].nextFree.store(static_cast<u32>(head), std::memory_order_relaxed);
+        u64 newHead = ((head >> 32) + 1) << 32 | index;
+        if (s_taskFreeHead.compare_exchange_weak(head, newHead,
+                std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+static void WakeWorker() {
+    s_workerWakeEpoch.fetch_add(1);
+    if (s_sleepingWorkers.load() > 0) {
+        s_workerWakeEpoch.notify_one();
+    }
+}
+
+// Take the right to run a task. Fails once any thread has claimed it, or
+// if the slot has moved on to another task.
+static bool ClaimTask(WorkerTask& task, u32 id) {
+    u32 expected = id;
+    return id != 0 && task.queuedId.compare_exchange_strong(expected, 0,
+        std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+static void ReleaseTaskRef(u32 index) {
+    if (s_taskPool[index].refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        FreeTaskSlot(index);
+    }
+}
+
+// Run a claimed task and drop its run reference
+static void RunClaimedTask(u32 index) {
+    WorkerTask& task = s_taskPool[index];
+    
+    task.result = task.func(task.param);
+    
+    // Call completion callback if provided
+    if (task.callback) {
+        task.callback(task.result, task.userdata);
+    }
+    
+    // Clearing the id is what CV64_Worker_WaitTask observes as completion
+    task.id.store(0, std::memory_order_release);
+    task.id.notify_all();
+    
+    s_workerTasksCompleted.fetch_add(1, std::memory_order_relaxed);
+    if (s_pendingTasks.fetch_sub(1) == 1) {
+        s_pendingTasks.notify_all();
+    }
+    ReleaseTaskRef(index);
+}
+
+// Handle a task index popped from a queue. The task may already have been
+// taken back by its waiter, in which case only the queue reference is left.
+static void ExecuteTask(u32 index) {
+    WorkerTask& task = s_taskPool[index];
+    if (ClaimTask(task, task.id.load(std::memory_order_acquire))) {
+        RunClaimedTask(index);
+    }
+    ReleaseTaskRef(index);
+}
+
+// Run everything still queued on the calling thread. Used at shutdown once
+// the workers have exited, so nothing a waiter depends on is abandoned.
+static u32 DrainQueuedTasks() {
+    u32 drained = 0;
+    u32 index;
+    for (int priority = 0; priority < CV64_TASK_PRIORITY_COUNT; ++priority) {
+        while (s_injectQueues[priority].Pop(&index)) {
+            ExecuteTask(index);
+            drained++;
+        }
+    }
+    for (int i = 0; i < s_workerCount; ++i) {
+        while (s_workerDeques[i].Steal(&index)) {
+            ExecuteTask(index);
+            drained++;
+        }
+    }
+    return drained;
+}
+
+// Find the next task for a worker: own deque, high priority injections,
+// normal injections, steal from a sibling, then low priority injections.
+static bool FindTask(int self, u32* index) {
+    if (self >= 0 && s_workerDeques[self].Pop(index)) {
+        return true;
+    }
+    if (s_injectQueues[CV64_TASK_PRIORITY_HIGH].Pop(index) ||
+        s_injectQueues[CV64_TASK_PRIORITY_NORMAL].Pop(index)) {
+        return true;
+    }
+    
+    if (s_workerCount > 1) {
+        // Random victim order spreads thieves across the pool
+        static thread_local u32 rng = 0x9E3779B9u ^ static_cast<u32>(self + 1);
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        int start = static_cast<int>(rng % static_cast<u32>(s_workerCount));
+        for (int i = 0; i < s_workerCount; ++i) {
+            int victim = (start + i) % s_workerCount;
+            if (victim != self && s_workerDeques[victim].Steal(index)) {
+                s_workerTasksStolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    
+    return s_injectQueues[CV64_TASK_PRIORITY_LOW].Pop(index);
+}
+
 static void WorkerThreadFunc(int threadId) {
     char threadName[64];
     snprintf(threadName, sizeof(threadName), "CV64_Worker%d", threadId);
@@ -231,40 +603,45 @@ static void WorkerThreadFunc(int threadId) {
     MultiByteToWideChar(CP_UTF8, 0, threadName, -1, wThreadName, 64);
     SetThreadDescription(GetCurrentThread(), wThreadName);
     
+    s_currentWorker = threadId;
     ThreadLogFmt("Worker thread %d started", threadId);
     
-    while (!s_shutdownRequested.load()) {
-        std::shared_ptr<WorkerTask> task;
+    for (;;) {
+        u32 index;
+        if (FindTask(threadId, &index)) {
+            ExecuteTask(index);
+            continue;
+        }
         
-        {
-            std::unique_lock<std::mutex> lock(s_workerMutex);
-            
-            s_workerCV.wait(lock, [&]() {
-                return !s_taskQueue.empty() || s_shutdownRequested.load();
-            });
-            
-            if (s_shutdownRequested.load() && s_taskQueue.empty()) {
-                break;
-            }
-            
-            if (!s_taskQueue.empty()) {
-                task = s_taskQueue.front();
-                s_taskQueue.pop();
-            }
+        // Brief spin before parking keeps burst latency low
+        bool found = false;
+        for (int spin = 0; spin < 32 && !found; ++spin) {
+            std::this_thread::yield();
+            found = FindTask(threadId, &index);
+        }
+        if (found) {
+            ExecuteTask(index);
+            continue;
         }
         
-        if (task && task->func) {
-            // Execute task
-            task->result = task->func(task->param);
-            task->completed.store(true);
-            
-            // Call completion callback if provided
-            if (task->callback) {
-                task->callback(task->result, task->userdata);
-            }
+        // Park. The epoch is read before the final check so a submit that
+        // lands in between changes it and the wait returns immediately.
+        u32 epoch = s_workerWakeEpoch.load();
+        s_sleepingWorkers.fetch_add(1);
+        if (FindTask(threadId, &index)) {
+            s_sleepingWorkers.fetch_sub(1);
+            ExecuteTask(index);
+            continue;
         }
+        if (s_shutdownRequested.load()) {
+            s_sleepingWorkers.fetch_sub(1);
+            break;
+        }
+        s_workerWakeEpoch.wait(epoch);
+        s_sleepingWorkers.fetch_sub(1);
     }
     
+    s_currentWorker = -1;
     ThreadLogFmt("Worker thread %d exiting", threadId);
 }
 
@@ -357,30 +734,38 @@ bool CV64_Threading_Init(const CV64_ThreadConfig* config) {
     ThreadLogFmt("  Async Graphics: %s", s_config.enableAsyncGraphics ? "YES" : "NO");
     ThreadLogFmt("  Async Audio: %s", s_config.enableAsyncAudio ? "YES" : "NO");
     ThreadLogFmt("  Worker Threads: %d", s_config.workerThreadCount);
-    ThreadLogFmt("  Graphics Queue Depth: %d", s_config.graphicsQueueDepth);
     ThreadLogFmt("  Parallel RSP: %s (EXPERIMENTAL)", 
                  s_config.enableParallelRSP ? "YES" : "NO");
     
     s_shutdownRequested.store(false);
     
     // Initialize audio buffer
-    s_audioBuffer.resize(AUDIO_BUFFER_SIZE, 0);
-    s_audioReadPos.store(0);
-    s_audioWritePos.store(0);
+    if (!s_audioRing.Init(AUDIO_BUFFER_SIZE)) {
+        ThreadLog("WARNING: Failed to allocate audio ring");
+    }
     
     // Start graphics thread
     if (s_config.enableAsyncGraphics) {
+        ResetFrameSlots();
         s_graphicsThread = std::thread(GraphicsThreadFunc);
-        ThreadLog("Graphics thread created");
+        ThreadLogFmt("Graphics thread created (%d-slot mailbox, %s policy)",
+                     CV64_FRAME_SLOT_COUNT,
+                     s_config.framePolicy == CV64_FRAME_POLICY_FIFO ? "FIFO" : "latest-wins");
     }
     
     // Start worker threads
     if (s_config.enableWorkerThreads) {
+        s_config.workerThreadCount = std::min(s_config.workerThreadCount, MAX_WORKER_THREADS);
+        s_workerCount = s_config.workerThreadCount;
+        s_workerDeques.reset(new WorkStealingDeque[s_workerCount]);
+        ResetTaskPool();
+        
         s_workerThreads.reserve(s_config.workerThreadCount);
         for (int i = 0; i < s_config.workerThreadCount; ++i) {
             s_workerThreads.emplace_back(WorkerThreadFunc, i);
         }
-        ThreadLogFmt("Created %d worker threads", s_config.workerThreadCount);
+        ThreadLogFmt("Created %d worker threads (work-stealing, %u task slots)",
+                     s_config.workerThreadCount, WORKER_TASK_POOL_SIZE);
     }
     
     // Start RSP thread (experimental)
@@ -404,10 +789,23 @@ void CV64_Threading_Shutdown() {
     
     s_shutdownRequested.store(true);
     
-    // Wake up all threads
-    s_graphicsCV.notify_all();
-    s_workerCV.notify_all();
+    // Submits that passed the shutdown check before the flag was set finish
+    // queueing first; every later submit is refused.
+    while (s_submitsInFlight.load() != 0) {
+        std::this_thread::yield();
+    }
+    
+    // Wake up all threads, and every task waiter so it sees the flag
+    s_frameSubmitSeq.fetch_add(1);
+    s_frameSubmitSeq.notify_all();
+    s_workerWakeEpoch.fetch_add(1);
+    s_workerWakeEpoch.notify_all();
     s_rspCV.notify_all();
+    for (u32 i = 0; i < WORKER_TASK_POOL_SIZE; ++i) {
+        if (s_taskPool[i].id.load(std::memory_order_relaxed) != 0) {
+            s_taskPool[i].id.notify_all();
+        }
+    }
     
     // Join graphics thread
     if (s_graphicsThread.joinable()) {
@@ -422,6 +820,14 @@ void CV64_Threading_Shutdown() {
         }
     }
     s_workerThreads.clear();
+    if (s_workerDeques) {
+        u32 drained = DrainQueuedTasks();
+        if (drained != 0) {
+            ThreadLogFmt("Ran %u tasks left queued at shutdown", drained);
+        }
+    }
+    s_workerDeques.reset();
+    s_workerCount = 0;
     ThreadLog("Worker threads joined");
     
     // Join RSP thread
@@ -430,17 +836,10 @@ void CV64_Threading_Shutdown() {
         ThreadLog("RSP thread joined");
     }
     
-    // Clear queues
-    {
-        std::lock_guard<std::mutex> lock(s_graphicsMutex);
-        while (!s_frameQueue.empty()) {
-            auto& f = s_frameQueue.front();
-            if (f.data) free(f.data);
-            s_frameQueue.pop();
-        }
-    }
+    // Release frame slot memory
+    ResetFrameSlots();
     
-    s_audioBuffer.clear();
+    s_audioRing.Release();
     s_initialized.store(false);
     
     ThreadLog("Threading system shutdown complete");
@@ -451,59 +850,152 @@ void CV64_Threading_GetStats(CV64_ThreadStats* stats) {
     
     std::lock_guard<std::mutex> lock(s_statsMutex);
     *stats = s_stats;
+    stats->audioUnderruns = s_audioRing.Underruns();
+    stats->audioOverruns = s_audioRing.Overruns();
+    stats->workerTasksQueued = s_workerTasksQueued.load(std::memory_order_relaxed);
+    stats->workerTasksCompleted = s_workerTasksCompleted.load(std::memory_order_relaxed);
+    stats->workerTasksStolen = s_workerTasksStolen.load(std::memory_order_relaxed);
+    stats->workerTasksRejected = s_workerTasksRejected.load(std::memory_order_relaxed);
+    stats->workerTasksReclaimed = s_workerTasksReclaimed.load(std::memory_order_relaxed);
 }
 
 void CV64_Threading_ResetStats() {
     std::lock_guard<std::mutex> lock(s_statsMutex);
     memset(&s_stats, 0, sizeof(s_stats));
+    s_workerTasksQueued.store(0, std::memory_order_relaxed);
+    s_workerTasksCompleted.store(0, std::memory_order_relaxed);
+    s_workerTasksStolen.store(0, std::memory_order_relaxed);
+    s_workerTasksRejected.store(0, std::memory_order_relaxed);
+    s_workerTasksReclaimed.store(0, std::memory_order_relaxed);
 }
 
 bool CV64_Threading_IsAsyncGraphicsEnabled() {
     return s_initialized.load() && s_config.enableAsyncGraphics;
 }
 
+bool CV64_Threading_IsAsyncAudioEnabled() {
+    return s_initialized.load() && s_config.enableAsyncAudio && s_audioRing.IsValid();
+}
+
 /*===========================================================================
  * Graphics Thread API
  *===========================================================================*/
 
-bool CV64_Graphics_QueueFrame(void* frameData, int width, int height) {
-    if (!s_initialized.load() || !s_config.enableAsyncGraphics) {
-        // If not using async graphics, just free the data
-        if (frameData) free(frameData);
-        return false;
+void* CV64_Graphics_AcquireFrame(int width, int height) {
+    if (!s_initialized.load() || !s_config.enableAsyncGraphics ||
+        width <= 0 || height <= 0) {
+        return nullptr;
     }
     
-    {
-        std::lock_guard<std::mutex> lock(s_graphicsMutex);
+    // Re-acquiring without a submit keeps writing the same slot
+    if (s_producerSlot < 0) {
+        const bool latest = s_config.framePolicy != CV64_FRAME_POLICY_FIFO;
         
-        // Check queue depth
-        if (static_cast<int>(s_frameQueue.size()) >= s_config.graphicsQueueDepth) {
-            // Queue full - drop oldest frame
-            auto& oldest = s_frameQueue.front();
-            if (oldest.data) free(oldest.data);
-            s_frameQueue.pop();
+        for (int attempt = 0; attempt < 8 && s_producerSlot < 0; ++attempt) {
+            // Prefer a free slot
+            for (int i = 0; i < CV64_FRAME_SLOT_COUNT; ++i) {
+                u64 word = s_frameSlots[i].state.load(std::memory_order_acquire);
+                if (FrameSlotStateOf(word) == FRAME_SLOT_FREE &&
+                    s_frameSlots[i].state.compare_exchange_strong(word,
+                        MakeFrameSlotWord(FrameSlotSeqOf(word), FRAME_SLOT_WRITING),
+                        std::memory_order_acq_rel)) {
+                    s_producerSlot = i;
+                    break;
+                }
+            }
+            if (s_producerSlot >= 0 || !latest) break;
             
-            std::lock_guard<std::mutex> statsLock(s_statsMutex);
-            s_stats.framesSyncWaits++;
+            // Latest-wins: overwrite the oldest frame the presenter hasn't taken
+            int oldest = -1;
+            u64 oldestWord = 0;
+            for (int i = 0; i < CV64_FRAME_SLOT_COUNT; ++i) {
+                u64 word = s_frameSlots[i].state.load(std::memory_order_acquire);
+                if (FrameSlotStateOf(word) == FRAME_SLOT_READY &&
+                    (oldest < 0 || FrameSlotSeqOf(word) < FrameSlotSeqOf(oldestWord))) {
+                    oldest = i;
+                    oldestWord = word;
+                }
+            }
+            if (oldest >= 0 && s_frameSlots[oldest].state.compare_exchange_strong(oldestWord,
+                    MakeFrameSlotWord(FrameSlotSeqOf(oldestWord), FRAME_SLOT_WRITING),
+                    std::memory_order_acq_rel)) {
+                s_producerSlot = oldest;
+                std::lock_guard<std::mutex> lock(s_statsMutex);
+                s_stats.framesDropped++;
+            }
         }
         
-        QueuedFrame frame;
-        frame.data = frameData;
-        frame.width = width;
-        frame.height = height;
-        frame.queueTime = std::chrono::high_resolution_clock::now();
-        
-        s_frameQueue.push(frame);
+        if (s_producerSlot < 0) {
+            std::lock_guard<std::mutex> lock(s_statsMutex);
+            s_stats.framesSyncWaits++;
+            return nullptr;
+        }
+    }
+    
+    FrameSlot& slot = s_frameSlots[s_producerSlot];
+    size_t needed = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    if (slot.capacity < needed) {
+        // Only on first use or a resolution increase
+        void* grown = realloc(slot.data, needed);
+        if (!grown) {
+            u64 word = slot.state.load(std::memory_order_relaxed);
+            slot.state.store(MakeFrameSlotWord(FrameSlotSeqOf(word), FRAME_SLOT_FREE),
+                             std::memory_order_release);
+            s_producerSlot = -1;
+            return nullptr;
+        }
+        slot.data = grown;
+        slot.capacity = needed;
     }
+    slot.width = width;
+    slot.height = height;
+    slot.acquireNs.store(FrameNowNs(), std::memory_order_relaxed);
+    slot.submitNs.store(0, std::memory_order_relaxed);
+    slot.presentNs.store(0, std::memory_order_relaxed);
+    return slot.data;
+}
+
+bool CV64_Graphics_SubmitFrame() {
+    if (s_producerSlot < 0) return false;
+    
+    FrameSlot& slot = s_frameSlots[s_producerSlot];
+    s_producerSlot = -1;
+    
+    u64 seq = s_frameSubmitSeq.load(std::memory_order_relaxed) + 1;
+    slot.submitNs.store(FrameNowNs(), std::memory_order_relaxed);
+    slot.state.store(MakeFrameSlotWord(seq, FRAME_SLOT_READY), std::memory_order_release);
     
-    s_graphicsCV.notify_one();
+    s_frameSubmitSeq.fetch_add(1);
+    s_frameSubmitSeq.notify_one();
+    return true;
+}
+
+bool CV64_Graphics_QueueFrame(const void* frameData, int width, int height) {
+    if (!frameData) return false;
+    
+    void* dst = CV64_Graphics_AcquireFrame(width, height);
+    if (!dst) return false;
+    
+    memcpy(dst, frameData, static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+    return CV64_Graphics_SubmitFrame();
+}
+
+bool CV64_Graphics_GetFrameSlotInfo(int slot, CV64_FrameSlotInfo* info) {
+    if (!info || slot < 0 || slot >= CV64_FRAME_SLOT_COUNT) return false;
+    
+    const FrameSlot& src = s_frameSlots[slot];
+    info->sequence = FrameSlotSeqOf(src.state.load(std::memory_order_acquire));
+    info->acquireNs = src.acquireNs.load(std::memory_order_relaxed);
+    info->submitNs = src.submitNs.load(std::memory_order_relaxed);
+    info->presentNs = src.presentNs.load(std::memory_order_relaxed);
+    info->width = src.width;
+    info->height = src.height;
     return true;
 }
 
 void CV64_Graphics_OnVIInterrupt() {
-    // Notify graphics thread of frame boundary
-    // This helps with frame pacing
-    s_graphicsCV.notify_one();
+    // Frame boundary. The presenter wakes on submit, so there is nothing
+    // to signal here; kept as a hook for VI-synchronised pacing.
 }
 
 void CV64_Graphics_WaitForPresent() {
@@ -511,13 +1003,18 @@ void CV64_Graphics_WaitForPresent() {
         return;
     }
     
-    // Wait until frame queue is empty
-    std::unique_lock<std::mutex> lock(s_graphicsMutex);
-    while (!s_frameQueue.empty() && !s_shutdownRequested.load()) {
-        s_graphicsCV.notify_one();
-        lock.unlock();
+    // Wait until the presenter has released every submitted frame
+    for (;;) {
+        bool busy = false;
+        for (const auto& slot : s_frameSlots) {
+            u32 state = FrameSlotStateOf(slot.state.load(std::memory_order_acquire));
+            if (state == FRAME_SLOT_READY || state == FRAME_SLOT_PRESENTING) {
+                busy = true;
+                break;
+            }
+        }
+        if (!busy || s_shutdownRequested.load()) break;
         std::this_thread::sleep_for(std::chrono::microseconds(100));
-        lock.lock();
     }
 }
 
@@ -530,98 +1027,470 @@ void CV64_Graphics_SetTargetFPS(int fps) {
  *===========================================================================*/
 
 bool CV64_Audio_QueueSamples(const s16* samples, size_t count, int frequency) {
+    (void)frequency;
     if (!samples || count == 0) return false;
     
-    std::lock_guard<std::mutex> lock(s_audioMutex);
-    
-    size_t writePos = s_audioWritePos.load();
-    size_t readPos = s_audioReadPos.load();
-    
-    // Check available space
-    size_t used = (writePos >= readPos) 
-        ? (writePos - readPos)
-        : (AUDIO_BUFFER_SIZE - readPos + writePos);
-    
-    size_t available = AUDIO_BUFFER_SIZE - used - 1;
-    
-    if (count > available) {
-        // Buffer full - audio underrun likely
-        std::lock_guard<std::mutex> statsLock(s_statsMutex);
-        s_stats.audioUnderruns++;
-        return false;
-    }
-    
-    // Copy samples to ring buffer
-    for (size_t i = 0; i < count; ++i) {
-        s_audioBuffer[writePos] = samples[i];
-        writePos = (writePos + 1) % AUDIO_BUFFER_SIZE;
-    }
-    
-    s_audioWritePos.store(writePos);
-    return true;
+    // Wait-free: a full ring drops the tail and counts an overrun
+    return s_audioRing.Write(samples, count) == count;
+}
+
+size_t CV64_Audio_DequeueSamples(s16* out, size_t count) {
+    if (!out || count == 0) return 0;
+    return s_audioRing.Read(out, count);
 }
 
 size_t CV64_Audio_GetQueueDepth() {
-    size_t writePos = s_audioWritePos.load();
-    size_t readPos = s_audioReadPos.load();
-    
-    return (writePos >= readPos)
-        ? (writePos - readPos)
-        : (AUDIO_BUFFER_SIZE - readPos + writePos);
+    return s_audioRing.Size();
 }
 
 void CV64_Audio_OnDMAComplete() {
     // Signal that DMA is complete - can be used for timing
 }
 
+bool CV64_Audio_RunRingStressTest(const CV64_AudioRingStressConfig* config,
+                                  CV64_AudioRingStressResult* result) {
+    if (!result) return false;
+    
+    // Default: producer at ~60 Hz VI cadence, consumer pulling small
+    // device-sized chunks slightly faster so both edges get exercised
+    CV64_AudioRingStressConfig cfg = {};
+    if (config) {
+        cfg = *config;
+    } else {
+        cfg.producerChunk = 1470;
+        cfg.producerIntervalUs = 16667;
+        cfg.consumerChunk = 512;
+        cfg.consumerIntervalUs = 5000;
+    }
+    if (cfg.durationMs == 0) cfg.durationMs = 2000;
+    if (cfg.ringSamples == 0) cfg.ringSamples = 4096;
+    if (cfg.producerChunk == 0) cfg.producerChunk = 1;
+    if (cfg.consumerChunk == 0) cfg.consumerChunk = 1;
+    
+    CV64_SpscRing<s16> ring;
+    if (!ring.Init(cfg.ringSamples)) return false;
+    
+    memset(result, 0, sizeof(*result));
+    std::atomic<bool> stop(false);
+    std::atomic<bool> producerDone(false);
+    
+    // Producer writes a running counter; the consumer checks that it reads
+    // back an unbroken sequence (short writes just delay the counter).
+    std::thread producer([&]() {
+        std::vector<s16> chunk(cfg.producerChunk);
+        u16 next = 0;
+        auto wake = std::chrono::steady_clock::now();
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (u32 i = 0; i < cfg.producerChunk; ++i) {
+                chunk[i] = static_cast<s16>(static_cast<u16>(next + i));
+            }
+            size_t written = ring.Write(chunk.data(), chunk.size());
+            next = static_cast<u16>(next + written);
+            result->samplesProduced += written;
+            
+            if (cfg.producerIntervalUs) {
+                wake += std::chrono::microseconds(cfg.producerIntervalUs);
+                std::this_thread::sleep_until(wake);
+            }
+        }
+        producerDone.store(true);
+    });
+    
+    std::thread consumer([&]() {
+        std::vector<s16> chunk(cfg.consumerChunk);
+        u16 expected = 0;
+        auto wake = std::chrono::steady_clock::now();
+        for (;;) {
+            bool finished = producerDone.load();
+            size_t got = ring.Read(chunk.data(), chunk.size());
+            for (size_t i = 0; i < got; ++i) {
+                if (static_cast<u16>(chunk[i]) != expected) {
+                    result->sequenceErrors++;
+                    expected = static_cast<u16>(chunk[i]);
+                }
+                expected++;
+            }
+            result->samplesConsumed += got;
+            
+            // Drain whatever the producer left behind before exiting
+            if (finished && ring.Size() == 0) break;
+            
+            if (cfg.consumerIntervalUs && !finished) {
+                wake += std::chrono::microseconds(cfg.consumerIntervalUs);
+                std::this_thread::sleep_until(wake);
+            }
+        }
+    });
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(cfg.durationMs));
+    stop.store(true);
+    producer.join();
+    consumer.join();
+    
+    result->underruns = ring.Underruns();
+    result->overruns = ring.Overruns();
+    result->passed = result->sequenceErrors == 0 &&
+                     result->samplesProduced == result->samplesConsumed;
+    
+    ThreadLogFmt("Audio ring stress: %s - produced %llu, consumed %llu, "
+                 "underruns %llu, overruns %llu, sequence errors %llu",
+                 result->passed ? "PASS" : "FAIL",
+                 (unsigned long long)result->samplesProduced,
+                 (unsigned long long)result->samplesConsumed,
+                 (unsigned long long)result->underruns,
+                 (unsigned long long)result->overruns,
+                 (unsigned long long)result->sequenceErrors);
+    return true;
+}
+
 /*===========================================================================
  * Worker Thread Pool API
  *===========================================================================*/
 
 u32 CV64_Worker_QueueTask(CV64_TaskFunc func, void* param,
                           CV64_TaskCallback callback, void* userdata) {
+    return CV64_Worker_QueueTaskEx(func, param, callback, userdata,
+                                   CV64_TASK_PRIORITY_NORMAL);
+}
+
+u32 CV64_Worker_QueueTaskEx(CV64_TaskFunc func, void* param,
+                            CV64_TaskCallback callback, void* userdata,
+                            CV64_TaskPriority priority) {
     if (!s_initialized.load() || !s_config.enableWorkerThreads || !func) {
         return 0;
     }
+    if (priority < 0 || priority >= CV64_TASK_PRIORITY_COUNT) {
+        priority = CV64_TASK_PRIORITY_NORMAL;
+    }
     
-    auto task = std::make_shared<WorkerTask>();
-    task->id = s_nextTaskId.fetch_add(1);
-    task->func = func;
-    task->param = param;
-    task->callback = callback;
-    task->userdata = userdata;
-    task->completed.store(false);
-    task->result = nullptr;
+    // Shutdown waits for s_submitsInFlight to drain after setting its flag,
+    // so a submit that gets past this check is always queued before the
+    // workers are joined.
+    s_submitsInFlight.fetch_add(1);
+    if (s_shutdownRequested.load()) {
+        s_submitsInFlight.fetch_sub(1);
+        return 0;
+    }
     
-    {
-        std::lock_guard<std::mutex> lock(s_workerMutex);
-        s_taskQueue.push(task);
+    u32 index = AllocTaskSlot();
+    if (index == WORKER_INVALID_INDEX) {
+        s_submitsInFlight.fetch_sub(1);
+        // Every slot is in flight - refuse rather than allocate
+        if (s_workerTasksRejected.fetch_add(1, std::memory_order_relaxed) == 0) {
+            ThreadLog("WARNING: worker task pool exhausted, rejecting submits");
+        }
+        return 0;
+    }
+    
+    // Sequence is never 0, so neither is the id
+    u32 seq = s_nextTaskSeq.fetch_add(1, std::memory_order_relaxed) &
+              ((1u << (32 - WORKER_TASK_INDEX_BITS)) - 1);
+    if (seq == 0) seq = 1;
+    u32 id = (seq << WORKER_TASK_INDEX_BITS) | index;
+    
+    WorkerTask& task = s_taskPool[index];
+    task.func = func;
+    task.param = param;
+    task.callback = callback;
+    task.userdata = userdata;
+    task.result = nullptr;
+    task.refs.store(2, std::memory_order_relaxed);
+    task.queuedId.store(id, std::memory_order_relaxed);
+    task.id.store(id, std::memory_order_relaxed);
+    
+    s_pendingTasks.fetch_add(1);
+    s_workerTasksQueued.fetch_add(1, std::memory_order_relaxed);
+    
+    // Normal-priority work spawned by a worker stays local for cache reuse;
+    // everything else goes through the shared injection queues.
+    int self = s_currentWorker;
+    if (!(priority == CV64_TASK_PRIORITY_NORMAL && self >= 0 &&
+          s_workerDeques[self].Push(index))) {
+        s_injectQueues[priority].Push(index);
     }
+    s_submitsInFlight.fetch_sub(1);
     
-    s_workerCV.notify_one();
-    return task->id;
+    WakeWorker();
+    return id;
 }
 
 bool CV64_Worker_WaitTask(u32 taskId, u32 timeoutMs) {
-    // Note: This is a simplified implementation
-    // In production, we'd track tasks by ID for proper waiting
-    (void)taskId;
-    (void)timeoutMs;
+    if (taskId == 0) return false;
+    if (!s_initialized.load()) return true;
+    
+    u32 slot = taskId & (WORKER_TASK_POOL_SIZE - 1);
+    WorkerTask& task = s_taskPool[slot];
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    int self = s_currentWorker;
+    
+    while (task.id.load(std::memory_order_acquire) == taskId) {
+        // The workers may be exiting: run the task here if none started it
+        if (s_shutdownRequested.load() && ClaimTask(task, taskId)) {
+            RunClaimedTask(slot);
+            return true;
+        }
+        
+        // A worker waiting on another task helps out instead of blocking,
+        // otherwise a pool full of waiters could deadlock.
+        u32 index;
+        if (self >= 0 && FindTask(self, &index)) {
+            ExecuteTask(index);
+        } else if (timeoutMs == 0) {
+            task.id.wait(taskId, std::memory_order_acquire);
+        } else {
+            std::this_thread::yield();
+        }
+        
+        if (timeoutMs != 0 && std::chrono::steady_clock::now() >= deadline) {
+            return task.id.load(std::memory_order_acquire) != taskId;
+        }
+    }
     return true;
 }
 
+bool CV64_Worker_WaitOrRunTask(u32 taskId, u32 timeoutMs) {
+    if (taskId == 0) return false;
+    if (timeoutMs != 0 && CV64_Worker_WaitTask(taskId, timeoutMs)) return true;
+    
+    // No worker has finished it in time. If none has started it either,
+    // take it back; otherwise it is running and will complete.
+    u32 slot = taskId & (WORKER_TASK_POOL_SIZE - 1);
+    if (ClaimTask(s_taskPool[slot], taskId)) {
+        s_workerTasksReclaimed.fetch_add(1, std::memory_order_relaxed);
+        RunClaimedTask(slot);
+        return true;
+    }
+    return CV64_Worker_WaitTask(taskId, 0);
+}
+
+void CV64_Worker_RunAll(CV64_TaskFunc func, void* const* params, u32 count, u32 timeoutMs) {
+    if (!func || !params || count == 0) return;
+
+    std::vector<u32> taskIds(count, 0);
+    std::vector<std::thread> threads;
+    for (u32 i = 1; i < count; i++) {
+        taskIds[i] = CV64_Worker_QueueTaskEx(func, params[i], nullptr, nullptr,
+                                             CV64_TASK_PRIORITY_HIGH);
+        if (taskIds[i] == 0) {
+            threads.emplace_back(func, params[i]);
+        }
+    }
+
+    func(params[0]);
+
+    for (u32 i = 1; i < count; i++) {
+        if (taskIds[i] != 0) {
+            CV64_Worker_WaitOrRunTask(taskIds[i], timeoutMs);
+        }
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+}
+
 void CV64_Worker_WaitAll() {
     if (!s_initialized.load()) return;
     
-    // Wait until task queue is empty
-    while (true) {
+    int self = s_currentWorker;
+    u32 pending;
+    while ((pending = s_pendingTasks.load()) != 0) {
+        u32 index;
+        if (self >= 0) {
+            // Called from inside a task: the caller itself is pending, so
+            // only drain what is runnable and return.
+            if (!FindTask(self, &index)) break;
+            ExecuteTask(index);
+        } else {
+            s_pendingTasks.wait(pending);
+        }
+    }
+}
+
+/*===========================================================================
+ * Worker Pool Benchmark
+ *===========================================================================*/
+
+namespace {
+
+// Per-task timing record for the benchmark
+struct BenchRecord {
+    u64 submitNs;
+    u64 startNs;
+    u32 workIterations;
+    std::atomic<u32>* remaining;
+};
+
+u64 BenchNowNs() {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void* BenchTaskFunc(void* param) {
+    BenchRecord* rec = static_cast<BenchRecord*>(param);
+    rec->startNs = BenchNowNs();
+    
+    // Simulated work that the optimizer can't drop
+    volatile u32 sink = 0;
+    for (u32 i = 0; i < rec->workIterations; ++i) {
+        sink = sink + i;
+    }
+    
+    // The record may be reused as soon as the count hits zero
+    std::atomic<u32>* remaining = rec->remaining;
+    if (remaining->fetch_sub(1) == 1) {
+        remaining->notify_all();
+    }
+    return nullptr;
+}
+
+// The pool design this module used before work stealing: one queue of
+// shared_ptr tasks behind one mutex/condition variable.
+class LegacyBenchPool {
+public:
+    explicit LegacyBenchPool(int threadCount) {
+        for (int i = 0; i < threadCount; ++i) {
+            m_threads.emplace_back([this]() { Run(); });
+        }
+    }
+    
+    ~LegacyBenchPool() {
         {
-            std::lock_guard<std::mutex> lock(s_workerMutex);
-            if (s_taskQueue.empty()) break;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
         }
-        s_workerCV.notify_all();
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        m_cv.notify_all();
+        for (auto& t : m_threads) t.join();
     }
+    
+    void Submit(CV64_TaskFunc func, void* param) {
+        auto task = std::make_shared<std::pair<CV64_TaskFunc, void*>>(func, param);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push(task);
+        }
+        m_cv.notify_one();
+    }
+    
+private:
+    void Run() {
+        for (;;) {
+            std::shared_ptr<std::pair<CV64_TaskFunc, void*>> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&]() { return !m_queue.empty() || m_stop; });
+                if (m_queue.empty()) return;
+                task = m_queue.front();
+                m_queue.pop();
+            }
+            task->first(task->second);
+        }
+    }
+    
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::queue<std::shared_ptr<std::pair<CV64_TaskFunc, void*>>> m_queue;
+    bool m_stop = false;
+};
+
+// Runs one burst and fills throughput/latency. submit() must not fail.
+template <typename SubmitFn>
+void RunBenchBurst(std::vector<BenchRecord>& records, u32 producers,
+                   std::atomic<u32>& remaining, SubmitFn submit,
+                   double* tasksPerSec, double* avgLatencyUs, double* p99LatencyUs) {
+    remaining.store(static_cast<u32>(records.size()));
+    for (auto& rec : records) {
+        rec.remaining = &remaining;
+        rec.startNs = 0;
+    }
+    
+    u64 begin = BenchNowNs();
+    std::vector<std::thread> threads;
+    size_t perProducer = (records.size() + producers - 1) / producers;
+    for (u32 p = 0; p < producers; ++p) {
+        size_t first = p * perProducer;
+        size_t last = std::min(records.size(), first + perProducer);
+        threads.emplace_back([&records, &submit, first, last]() {
+            for (size_t i = first; i < last; ++i) {
+                records[i].submitNs = BenchNowNs();
+                submit(&records[i]);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    
+    u32 left;
+    while ((left = remaining.load()) != 0) {
+        remaining.wait(left);
+    }
+    u64 end = BenchNowNs();
+    
+    std::vector<u64> latencies;
+    latencies.reserve(records.size());
+    double sum = 0.0;
+    for (const auto& rec : records) {
+        u64 lat = rec.startNs > rec.submitNs ? rec.startNs - rec.submitNs : 0;
+        latencies.push_back(lat);
+        sum += static_cast<double>(lat);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    
+    double seconds = static_cast<double>(end - begin) / 1e9;
+    *tasksPerSec = seconds > 0.0 ? records.size() / seconds : 0.0;
+    *avgLatencyUs = sum / records.size() / 1000.0;
+    *p99LatencyUs = latencies[(latencies.size() * 99) / 100] / 1000.0;
+}
+
+} // namespace
+
+bool CV64_Worker_RunBenchmark(const CV64_WorkerBenchConfig* config,
+                              CV64_WorkerBenchResult* result) {
+    if (!result || !s_initialized.load() || !s_config.enableWorkerThreads) {
+        return false;
+    }
+    
+    CV64_WorkerBenchConfig cfg = {};
+    if (config) cfg = *config;
+    if (cfg.taskCount == 0) cfg.taskCount = 100000;
+    if (cfg.producerThreads == 0) cfg.producerThreads = 1;
+    
+    std::vector<BenchRecord> records(cfg.taskCount);
+    for (auto& rec : records) {
+        rec.workIterations = cfg.workIterations;
+    }
+    
+    memset(result, 0, sizeof(*result));
+    std::atomic<u32> remaining(0);
+    
+    // Work-stealing pool. Retry when the fixed task pool is saturated.
+    RunBenchBurst(records, cfg.producerThreads, remaining,
+        [](BenchRecord* rec) {
+            while (CV64_Worker_QueueTaskEx(BenchTaskFunc, rec, nullptr, nullptr,
+                                           CV64_TASK_PRIORITY_NORMAL) == 0) {
+                std::this_thread::yield();
+            }
+        },
+        &result->stealingTasksPerSec, &result->stealingAvgLatencyUs,
+        &result->stealingP99LatencyUs);
+    
+    // Reference single-lock pool with the same number of threads
+    {
+        LegacyBenchPool legacy(s_workerCount);
+        RunBenchBurst(records, cfg.producerThreads, remaining,
+            [&legacy](BenchRecord* rec) { legacy.Submit(BenchTaskFunc, rec); },
+            &result->legacyTasksPerSec, &result->legacyAvgLatencyUs,
+            &result->legacyP99LatencyUs);
+    }
+    
+    ThreadLogFmt("Worker benchmark: %u tasks, %u producers, %u work iterations, %d workers",
+                 cfg.taskCount, cfg.producerThreads, cfg.workIterations, s_workerCount);
+    ThreadLogFmt("  work-stealing: %.0f tasks/s, latency avg %.2f us, p99 %.2f us",
+                 result->stealingTasksPerSec, result->stealingAvgLatencyUs,
+                 result->stealingP99LatencyUs);
+    ThreadLogFmt("  single-lock:   %.0f tasks/s, latency avg %.2f us, p99 %.2f us",
+                 result->legacyTasksPerSec, result->legacyAvgLatencyUs,
+                 result->legacyP99LatencyUs);
+    return true;
 }
 
 /*===========================================================================
@@ -8,19 +8,15 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "../include/cv64_window_title.h"
-#include "../include/cv64_memory_map.h"
+#include "../include/cv64_memory_hook.h"
 #include <Windows.h>
 #include <cstring>
 #include <cstdio>
-#include <atomic>
 
 /*===========================================================================
  * Static State
  *===========================================================================*/
 
-static std::atomic<uint8_t*> s_rdram{nullptr};
-static std::atomic<uint32_t> s_rdram_size{0};
-
 static struct {
     uint8_t playerCharacter;    // 0=Reinhardt, 1=Carrie
     uint8_t difficultyMode;     // 0=Easy, 1=Normal
@@ -28,36 +24,15 @@ static struct {
     char titleBuffer[256];
 } s_state = {0, 0, false, ""};
 
-/*===========================================================================
- * Safe Memory Access
- *===========================================================================*/
-
-static inline uint8_t SafeReadU8(uint32_t addr) {
-    uint8_t* rdram = s_rdram.load(std::memory_order_acquire);
-    uint32_t size = s_rdram_size.load(std::memory_order_acquire);
-
-    if (!rdram || size == 0) return 0;
-
-    return CV64_ReadU8(rdram, addr);
-}
-
-static inline uint16_t SafeReadU16(uint32_t addr) {
-    uint8_t* rdram = s_rdram.load(std::memory_order_acquire);
-    uint32_t size = s_rdram_size.load(std::memory_order_acquire);
-
-    if (!rdram || size == 0) return 0;
-
-    return CV64_ReadU16(rdram, addr);
-}
-
 /*===========================================================================
  * API Implementation
  *===========================================================================*/
 
 void CV64_WindowTitle_Init(uint8_t* rdram, uint32_t rdram_size) {
-    s_rdram.store(rdram, std::memory_order_release);
-    s_rdram_size.store(rdram_size, std::memory_order_release);
-    
+    /* Game state comes from the memory hook's published CV64_GameInfo */
+    (void)rdram;
+    (void)rdram_size;
+
     s_state.playerCharacter = 0xFF;
     s_state.difficultyMode = 0xFF;
     s_state.isValid = false;
@@ -87,9 +62,11 @@ bool CV64_WindowTitle_IsGameActive(void) {
 }
 
 const char* CV64_WindowTitle_Update(void) {
-    // Read current game state — player character is s16 in decomp (LH instruction)
-    uint16_t character = SafeReadU16(CV64_ADDR_PLAYER_CHARACTER);
-    uint8_t difficulty = SafeReadU8(CV64_ADDR_DIFFICULTY_MODE);
+    // Read the game info published by the emulation thread (lock-free, any thread)
+    CV64_GameInfo info;
+    bool running = CV64_Memory_GetGameInfo(&info);
+    uint16_t character = running ? (uint16_t)info.character : 0xFFFF;
+    uint8_t difficulty = running ? info.difficulty : 0xFF;
     
     // Validate values (0 or 1 only)
     uint8_t charVal = (character > 1) ? 0xFF : (uint8_t)character;